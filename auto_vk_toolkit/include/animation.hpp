@@ -1,6 +1,7 @@
 #pragma once
 
 #include "model_types.hpp"
+#include "parallel_for.hpp"
 
 namespace avk
 {
@@ -165,6 +166,9 @@ namespace avk
 	 */
 	struct animated_node
 	{
+		/** The name of the node in the model's node hierarchy. It identifies the node across different animations of the same model. */
+		std::string mNodeName;
+
 		/**	Animation keys for the positions of this node. */
 		std::vector<position_key> mPositionKeys;
 
@@ -229,6 +233,42 @@ namespace avk
 		model_space,
 	};
 	
+	/** Scratch memory in structure-of-arrays layout, which is used by animation::compute_local_transforms.
+	 *	It is kept between invocations to avoid allocations.
+	 */
+	struct animation_evaluation_scratch
+	{
+		/** Indices of the nodes which have animation keys */
+		std::vector<size_t> mKeyedNodes;
+		/** Per keyed node and per component: the two position keys' values, the interpolation factor, and the result */
+		std::array<std::vector<float>, 3> mTranslationsFrom, mTranslationsTo, mTranslations;
+		std::vector<float> mTranslationFactors;
+		/** Per keyed node: the two rotation keys' values, the interpolation factor, and the result */
+		std::vector<glm::quat> mRotationsFrom, mRotationsTo, mRotations;
+		std::vector<float> mRotationFactors;
+		/** Per keyed node and per component: the two scaling keys' values, the interpolation factor, and the result */
+		std::array<std::vector<float>, 3> mScalingsFrom, mScalingsTo, mScalings;
+		std::vector<float> mScalingFactors;
+		/** Per node (not only keyed ones): the resulting local transformation matrix */
+		std::vector<glm::mat4> mLocalTransforms;
+	};
+
+	/**	Playback state of one instance of an animation, i.e., its pose. Multiple instances can be animated
+	 *	with the same animation (which holds the keys, the hierarchy, and the inverse bind pose matrices)
+	 *	at different points in time, where each instance only needs its own animation_playback_state.
+	 *	It also remembers the most recently used keys of every track, s.t. the keys for the next point
+	 *	in time can be found incrementally.
+	 */
+	struct animation_playback_state
+	{
+		/** Per animated node: the indices of the most recently used position, rotation, and scaling keys */
+		std::vector<std::array<size_t, 3>> mKeyCursors;
+		/** Per animated node: the global transform of the most recent evaluation */
+		std::vector<glm::mat4> mGlobalTransforms;
+		/** Scratch memory for the evaluation */
+		animation_evaluation_scratch mScratch;
+	};
+
 	class model_t;
 
 	/**	Class that represents one specific animation for one or multiple meshes
@@ -280,12 +320,13 @@ namespace avk
 
 			double timeInTicks = aTime * aClip.mTicksPerSecond;
 
+			// Get the node-local TRS transformation matrices of all nodes:
+			compute_local_transforms(timeInTicks, mPlaybackState);
+
 			const auto an = mAnimationData.size();
 			for (size_t ai = 0; ai < an; ++ai) {
 				auto& anode = mAnimationData[ai];
-
-				// Get the node-local TRS transformation matrix:
-				auto localTransform = compute_node_local_transform(anode, timeInTicks);
+				const auto& localTransform = mPlaybackState.mScratch.mLocalTransforms[ai];
 
 				// Calculate the node's global transform, using its local transform and the transforms of its parents:
 				if (anode.mAnimatedParentIndex.has_value()) {
@@ -456,6 +497,31 @@ namespace avk
 		 */
 		void animate_into_single_target_buffer(const animation_clip_data& aClip, double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory);
 
+		/**	Calculates the bone animation for one instance, and writes all of its bone matrices into one single contiguous piece
+		 *	of memory, like animate_into_single_target_buffer. In contrast to that, this animation is not modified,
+		 *	but only the given playback state is. Hence, multiple instances can be animated with the same animation
+		 *	concurrently, as long as each one uses its own playback state.
+		 *
+		 *	@param	aClip				Animation clip to use for the animation
+		 *	@param	aTime				Time in seconds to calculate the bone matrices at.
+		 *	@param	aPlaybackState		The instance's playback state, which is updated
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone matrix shall be written to
+		 */
+		void animate_instance_into_single_target_buffer(const animation_clip_data& aClip, double aTime, animation_playback_state& aPlaybackState, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory) const;
+
+		/**	Calculates the bone animations of multiple instances in parallel, see animate_instance_into_single_target_buffer.
+		 *	All spans must have the same size, i.e., one entry per instance.
+		 *
+		 *	@param	aClip				Animation clip to use for the animation
+		 *	@param	aTimes				Per instance: time in seconds to calculate the bone matrices at.
+		 *	@param	aPlaybackStates		Per instance: the playback state, which is updated. Keep them between invocations.
+		 *	@param	aTargetMemories		Per instance: pointer to the memory location where the instance's first bone matrix shall be written to
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+		 *	@param	aMaxThreads			Maximum number of threads to use, including the calling thread.
+		 */
+		void animate_instances(const animation_clip_data& aClip, std::span<const double> aTimes, std::span<animation_playback_state> aPlaybackStates, std::span<glm::mat4* const> aTargetMemories, bone_matrices_space aTargetSpace = bone_matrices_space::mesh_space, size_t aMaxThreads = parallel_for_max_threads()) const;
+
 		/**	Returns all the unique keyframe time-values of the given animation.
 		 *	@param	aClip				Animation clip which to extract the unique keyframe time-values from
 		 *	@return	A collection of unique keyframe times in ticks
@@ -524,28 +590,78 @@ namespace avk
 		auto get_animated_nodes() const { return mAnimationData; }
 
 	private:
+		/**	Computes the node-local transformation matrices of all nodes at the given animation time (in ticks),
+		 *	and stores them in aPlaybackState.mScratch.mLocalTransforms. The results are exactly the same as those
+		 *	of compute_node_local_transform, but the computations are performed in stages over all nodes at once:
+		 *	First, the keys of all nodes are found and gathered into structure-of-arrays layout. Then, translations
+		 *	and scalings of all nodes are interpolated component-wise in loops which the compiler can vectorize,
+		 *	followed by the rotations, and finally, the matrices are composed.
+		 *	(The results can only differ in the last bits if the compiler contracts floating point operations
+		 *	differently for the two code paths, e.g., into FMA instructions with -ffp-contract=fast.)
+		 *	@param	aTimeInTicks		Animation time
+		 *	@param	aPlaybackState		Playback state which the key cursors are taken from and stored into
+		 */
+		void compute_local_transforms(double aTimeInTicks, animation_playback_state& aPlaybackState) const;
+
+		/** Maximum number of keys which find_positions_in_keys steps forward from a cursor
+		 *	before it falls back to binary search.
+		 */
+		static constexpr size_t sMaxIncrementalKeySteps = 4;
+
+		/** Helper function which returns the index of the last key at or after aFirst whose mTime is
+		 *	less than or equal to aTime, or aFirst if there is no such key. The keys must be sorted by mTime.
+		 */
+		template <typename T>
+		static size_t find_key_by_binary_search(const T& aCollection, double aTime, size_t aFirst)
+		{
+			auto it = std::upper_bound(std::begin(aCollection) + aFirst, std::end(aCollection), aTime, [](double aT, const auto& aKey) { return aT < aKey.mTime; });
+			const auto index = static_cast<size_t>(std::distance(std::begin(aCollection), it));
+			return index > aFirst ? index - 1 : aFirst;
+		}
+
 		/** Helper function used during animate() to find two positions of key-elements
 		 *	between which the given aTime lies.
+		 *	@param	aCursor		The key index which has been found for this track the last time. If aTime has
+		 *						advanced by only a few keys since then, the keys are found by stepping forward
+		 *						from there, otherwise (e.g., after seeking or looping) by binary search.
+		 *						It is updated with the new key index.
 		 */
 		template <typename T>
-		std::tuple<size_t, size_t> find_positions_in_keys(const T& aCollection, double aTime) const
+		std::tuple<size_t, size_t> find_positions_in_keys(const T& aCollection, double aTime, size_t& aCursor) const
 		{
 			const auto maxIndex = aCollection.size() - 1;
-			
-			size_t pos1 = 0;
-			while (pos1 + 1 <= maxIndex && aCollection[pos1 + 1].mTime <= aTime) {
-				++pos1;
+
+			size_t pos1 = std::min(aCursor, maxIndex);
+			if (aCollection[pos1].mTime <= aTime) {
+				size_t steps = 0;
+				while (pos1 + 1 <= maxIndex && aCollection[pos1 + 1].mTime <= aTime && steps < sMaxIncrementalKeySteps) {
+					++pos1;
+					++steps;
+				}
+				if (pos1 + 1 <= maxIndex && aCollection[pos1 + 1].mTime <= aTime) {
+					pos1 = find_key_by_binary_search(aCollection, aTime, pos1 + 1);
+				}
 			}
-			
-			size_t pos2 = pos1 + (pos1 < maxIndex ? 1 : 0);
-			while (pos2 + 1 < maxIndex && aCollection[pos2 + 1].mTime < aTime) {
-				LOG_WARNING(std::format("Now that's strange: keys[{}].mTime {} < {}, despite keys[{}].mTime {} <= {}", pos2 + 1, aCollection[pos2 + 1].mTime, aTime, pos1, aCollection[pos1].mTime, aTime));
-				++pos2;
+			else {
+				// Time went backwards:
+				pos1 = find_key_by_binary_search(aCollection, aTime, 0);
 			}
-			
+			aCursor = pos1;
+
+			size_t pos2 = pos1 + (pos1 < maxIndex ? 1 : 0);
 			return std::make_tuple(pos1, pos2);
 		}
 
+		/** Helper function used during animate() to find two positions of key-elements
+		 *	between which the given aTime lies. Like the overload above, but without a cursor.
+		 */
+		template <typename T>
+		std::tuple<size_t, size_t> find_positions_in_keys(const T& aCollection, double aTime) const
+		{
+			size_t cursor = 0;
+			return find_positions_in_keys(aCollection, aTime, cursor);
+		}
+
 		/**	For two given keys (each of which must contain a .mTime member of type
 		 *	double), and a given aTime value, return the corresponding interpolation
 		 *	factor in the range [0..1].
@@ -574,6 +690,9 @@ namespace avk
 		 */
 		size_t mMaxNumBoneMatrices;
 
+		/** Playback state used by animate, which is not serialized. */
+		animation_playback_state mPlaybackState;
+
 		/** Make serialize a friend, so the serializer can access private data members.
 		 *  (see custom serialization functions in serializer.hpp)
 		 */
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "animation.hpp"
+
+namespace avk
+{
+	/** Determines how an animation layer is combined with the other layers of an animation_blender. */
+	enum struct animation_layer_mode
+	{
+		/** The pose which results from all previous blend layers is interpolated towards the layer's pose by the layer's
+		 *	weight (times its bone mask value), i.e., a layer with weight 1 overrides all previous blend layers. */
+		blend,
+
+		/** The layer's difference to its reference pose (its pose at the start of its clip) is added on top
+		 *	of the blended pose, scaled by its weight. */
+		additive,
+	};
+
+	/**	Evaluates poses which are combined from multiple animation clips, e.g. to crossfade between clips, or to
+	 *	play back an additive clip on top of others, or to restrict a clip to some bones via a bone mask.
+	 *
+	 *	The layers are evaluated per node like a stack: Starting from the node's local transform from the model, every
+	 *	blend layer, in the order of add_layer, interpolates the pose towards its own pose by w = weight * mask value,
+	 *	clamped to [0, 1]. Afterwards, the additive layers are applied on top, scaled by w. For example, to crossfade
+	 *	from clip A to clip B, add A with weight 1 and B with a weight which goes from 0 to 1. To play back clip B only
+	 *	on the upper body, add it after A with weight 1 and a bone mask which is 1 for the upper body's nodes.
+	 *
+	 *	The translation, rotation, and scale of every node are sampled per layer (via animation::compute_node_local_translation,
+	 *	animation::compute_node_local_rotation, and animation::compute_node_local_scale) and combined, and only then a single
+	 *	local transformation matrix is composed per node. I.e., blending N clips does not compute N full animations.
+	 *
+	 *	All layers must have been prepared for the same model and the same meshes as the skeleton animation, which
+	 *	defines the node hierarchy and the bone matrix targets. Nodes are matched across animations by their names.
+	 */
+	class animation_blender
+	{
+	public:
+		/**	Creates a blender without any layers.
+		 *	@param	aSkeleton	Animation which defines the node hierarchy and the bone matrix targets, usually one of
+		 *						the animations which are added as layers. It must outlive the blender.
+		 */
+		explicit animation_blender(const animation& aSkeleton);
+		animation_blender(animation_blender&&) noexcept = default;
+		animation_blender(const animation_blender&) = default;
+		animation_blender& operator=(animation_blender&&) noexcept = default;
+		animation_blender& operator=(const animation_blender&) = default;
+		~animation_blender() = default;
+
+		/**	Adds a layer which plays back the given clip.
+		 *	@param	aAnimation	Animation for the clip's animation index, prepared for the same model and meshes as the skeleton. It must outlive the blender.
+		 *	@param	aClip		The clip to play back
+		 *	@param	aWeight		The weight of the layer
+		 *	@param	aMode		How the layer is combined with the other layers
+		 *	@return	The index of the new layer
+		 */
+		size_t add_layer(const animation& aAnimation, const animation_clip_data& aClip, float aWeight = 1.0f, animation_layer_mode aMode = animation_layer_mode::blend);
+
+		/** Returns the number of layers */
+		size_t number_of_layers() const { return mLayers.size(); }
+
+		/** Sets the weight of the given layer. Blend layers with weight 0 are skipped entirely. */
+		void set_layer_weight(size_t aLayerIndex, float aWeight);
+
+		/** Returns the weight of the given layer. */
+		float layer_weight(size_t aLayerIndex) const;
+
+		/** Sets the time in seconds at which the given layer's clip is sampled. */
+		void set_layer_time(size_t aLayerIndex, double aTime);
+
+		/**	Restricts the given layer to some nodes. The layer's weight is multiplied with the node's mask value, i.e.,
+		 *	nodes with mask value 0 keep the pose of the previous layers, and nodes with mask value 1 get the full weight.
+		 *	@param	aLayerIndex		The layer
+		 *	@param	aNodeWeights	One value per node of the skeleton animation (see animation::number_of_animated_nodes), or empty to affect all nodes fully.
+		 */
+		void set_layer_bone_mask(size_t aLayerIndex, std::vector<float> aNodeWeights);
+
+		/**	Creates a bone mask for set_layer_bone_mask which contains 1 for the node with the given name and all of its
+		 *	animated descendants, and 0 for all other nodes.
+		 *	@param	aNodeName	Name of the root node of the masked sub-hierarchy, e.g. "Spine"
+		 */
+		std::vector<float> bone_mask_for_subtree(const std::string& aNodeName) const;
+
+		/**	Evaluates the combined pose and writes the bone matrices into contiguous strided memory,
+		 *	like animation::animate_into_strided_target_per_mesh.
+		 *
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone matrix shall be written to
+		 *	@param	aMeshStride			Offset in BYTES between the first memory target location for mesh i, and the first memory target location for mesh i+1
+		 *	@param	aMatricesStride		Offset in BYTES between two consecutive bone matrices that are assigned to the same mesh. By default, it will be set to sizeof(glm::mat4)
+		 *	@param	aMaxMeshes			The maximum number of meshes to write out bone matrices for.
+		 *	@param	aMaxBonesPerMesh	The maximum number of bones to write out bone matrices for per mesh.
+		 */
+		void animate_into_strided_target_per_mesh(bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory, size_t aMeshStride, std::optional<size_t> aMatricesStride = {}, std::optional<size_t> aMaxMeshes = {}, std::optional<size_t> aMaxBonesPerMesh = {});
+
+		/**	Evaluates the combined pose and writes the bone matrices into one single contiguous piece of memory,
+		 *	like animation::animate_into_single_target_buffer.
+		 *
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone matrix shall be written to
+		 */
+		void animate_into_single_target_buffer(bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory);
+
+	private:
+		struct layer
+		{
+			const animation* mAnimation;
+			animation_clip_data mClip;
+			double mTime;
+			float mWeight;
+			animation_layer_mode mMode;
+			std::vector<float> mBoneMask;
+			/** Per skeleton node: the index of the corresponding node of mAnimation, if there is one */
+			std::vector<std::optional<size_t>> mNodeMapping;
+			/** Per skeleton node: the reference pose of additive layers */
+			std::vector<glm::vec3> mReferenceTranslations;
+			std::vector<glm::quat> mReferenceRotations;
+			std::vector<glm::vec3> mReferenceScales;
+		};
+
+		/** Computes the combined local transforms and the global transforms of all skeleton nodes, and
+		 *	invokes aWriteBoneMatrix(bone_mesh_data, global transform) for every bone mesh target. */
+		template <typename F>
+		void evaluate(F&& aWriteBoneMatrix);
+
+		const animation* mSkeleton;
+		std::vector<layer> mLayers;
+		std::vector<glm::mat4> mGlobalTransforms;
+	};
+}
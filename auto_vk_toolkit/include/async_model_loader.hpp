@@ -0,0 +1,184 @@
+#pragma once
+
+#include "event.hpp"
+#include "image_data.hpp"
+#include "model.hpp"
+#include "orca_scene.hpp"
+
+namespace avk
+{
+	/** The vertex data of a single mesh, which has been extracted on a background thread by an async_model_loader. */
+	struct streamed_mesh
+	{
+		/** The request which this mesh belongs to, as returned by async_model_loader::request_model */
+		size_t mRequestIndex;
+		/** The model which this mesh belongs to */
+		avk::model mModel;
+		/** The index of the mesh within mModel */
+		mesh_index_t mMeshIndex;
+		std::vector<glm::vec3> mPositions;
+		std::vector<uint32_t> mIndices;
+		std::vector<glm::vec3> mNormals;
+		/** Texture coordinates of the first UV set, or empty if the mesh has none */
+		std::vector<glm::vec2> mTextureCoordinates;
+
+		/** The number of bytes of staging memory which this mesh occupies */
+		size_t size_in_bytes() const;
+	};
+
+	/** A texture which has been decoded on a background thread by an async_model_loader.
+	 *	It can be uploaded with create_image_from_image_data.
+	 */
+	struct streamed_texture
+	{
+		/** The request which has referenced this texture first */
+		size_t mRequestIndex;
+		/** The path of the texture, as stored in material_config */
+		std::string mPath;
+		/** The decoded image data */
+		image_data mImageData;
+
+		/** The number of bytes of staging memory which this texture occupies */
+		size_t size_in_bytes() const;
+	};
+
+	/**	Loads models on background threads, and hands out their meshes and textures one by one as soon as
+	 *	they have been decoded. This allows an application to start rendering while the remaining meshes
+	 *	are still being streamed in.
+	 *
+	 *	The decoded data which has not been taken yet occupies staging memory. The loader's worker threads
+	 *	wait as long as the staging memory budget is exhausted, i.e., the amount of decoded data in memory
+	 *	is bounded by the budget plus at most one texture per worker thread. Staging memory is freed as soon
+	 *	as the data is taken via take_ready_meshes or take_ready_textures.
+	 *
+	 *	Readiness can be observed through the updater:
+	 *	@code
+	 *	mUpdater->on(mLoader->mesh_ready_event()).invoke([this]() {
+	 *		for (auto& mesh : mLoader->take_ready_meshes(16 * 1024 * 1024)) {
+	 *			// create buffers, record upload commands...
+	 *		}
+	 *	});
+	 *	@endcode
+	 */
+	class async_model_loader
+	{
+	public:
+		/**	Creates a loader and starts its worker threads.
+		 *	@param	aStagingBudgetInBytes	Maximum amount of decoded data which has not been taken yet.
+		 *	@param	aNumWorkerThreads		Number of background threads which import models and decode meshes and textures.
+		 */
+		explicit async_model_loader(size_t aStagingBudgetInBytes = 256 * 1024 * 1024, size_t aNumWorkerThreads = 2);
+		async_model_loader(async_model_loader&&) noexcept = delete;
+		async_model_loader(const async_model_loader&) = delete;
+		async_model_loader& operator=(async_model_loader&&) noexcept = delete;
+		async_model_loader& operator=(const async_model_loader&) = delete;
+		/** Stops all worker threads. Data which has not been taken yet is discarded. */
+		~async_model_loader();
+
+		/**	Requests a model to be loaded in the background.
+		 *	@param	aPath					Path to the model file
+		 *	@param	aAssimpFlags			Flags which are passed on to model_t::load_from_file
+		 *	@param	aLoadTextures			If true, all textures referenced by the model's materials are decoded, too.
+		 *	@param	aLoadTexturesInSrgb		If true, "diffuse textures", "ambient textures", and "extra textures" are decoded in sRGB format if applicable.
+		 *	@param	aFlipTextures			If true, textures are flipped vertically.
+		 *	@return	The index of the request, which can be used to identify the model, its meshes, and its textures.
+		 */
+		size_t request_model(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate, bool aLoadTextures = true, bool aLoadTexturesInSrgb = false, bool aFlipTextures = false);
+
+		/**	Requests all models of the given ORCA scene to be loaded in the background. The scene should have been loaded
+		 *	with orca_scene_t::load_from_file with aLoadModels set to false. Assign the loaded models to the scene's
+		 *	model_data::mLoadedModel when they are handed out by take_loaded_models.
+		 *	@return	The request indices, in the order of aScene.models()
+		 */
+		std::vector<size_t> request_orca_scene_models(const orca_scene_t& aScene, model_t::aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate | aiProcess_PreTransformVertices, bool aLoadTextures = true, bool aLoadTexturesInSrgb = false, bool aFlipTextures = false);
+
+		/** Event which occurs whenever models have been imported and can be taken via take_loaded_models. */
+		std::shared_ptr<event> model_loaded_event() const { return mModelLoadedEvent; }
+
+		/** Event which occurs whenever meshes have been decoded and can be taken via take_ready_meshes. */
+		std::shared_ptr<event> mesh_ready_event() const { return mMeshReadyEvent; }
+
+		/** Event which occurs whenever textures have been decoded and can be taken via take_ready_textures. */
+		std::shared_ptr<event> texture_ready_event() const { return mTextureReadyEvent; }
+
+		/**	Takes the models which have been imported since the last invocation. Their meshes are handed out separately.
+		 *	@return	Tuples of request index and model. Shared ownership is enabled for the models.
+		 */
+		std::vector<std::tuple<size_t, avk::model>> take_loaded_models();
+
+		/**	Takes decoded meshes, in the order in which they have been decoded, and frees their staging memory.
+		 *	@param	aMaxBytes	Maximum total size of the returned meshes, which allows to limit the amount of data uploaded per frame.
+		 *						At least one mesh is returned if any is ready, even if it exceeds aMaxBytes.
+		 */
+		std::vector<streamed_mesh> take_ready_meshes(size_t aMaxBytes = std::numeric_limits<size_t>::max());
+
+		/**	Takes decoded textures, in the order in which they have been decoded, and frees their staging memory.
+		 *	@param	aMaxBytes	Maximum total size of the returned textures. At least one texture is returned if any is ready.
+		 */
+		std::vector<streamed_texture> take_ready_textures(size_t aMaxBytes = std::numeric_limits<size_t>::max());
+
+		/** Takes the requests which have failed, together with an error message each. Each request is reported at most once,
+		 *	with the message of its first failure. */
+		std::vector<std::tuple<size_t, std::string>> take_failed_requests();
+
+		/** Returns true if all requests have been processed, and all their data has been taken. */
+		bool is_finished() const;
+
+		/** Returns the amount of decoded data which has not been taken yet. */
+		size_t staged_bytes() const;
+
+	private:
+		/** The events are handed out as shared_ptrs, i.e., they can outlive the loader => detached by its destructor */
+		class ready_event : public event
+		{
+		public:
+			ready_event(std::function<bool()> aPredicate) : mPredicate{ std::move(aPredicate) } {}
+			bool update(event_data& aData) override
+			{
+				std::scoped_lock lock(mPredicateMutex);
+				return mPredicate && mPredicate();
+			}
+			void detach()
+			{
+				std::scoped_lock lock(mPredicateMutex);
+				mPredicate = {};
+			}
+		private:
+			std::mutex mPredicateMutex;
+			std::function<bool()> mPredicate;
+		};
+
+		void worker();
+		void enqueue_job(std::function<void()> aJob, bool aPrioritize);
+		bool acquire_staging_memory(size_t aBytes);
+		void load_model(size_t aRequestIndex, const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags, bool aLoadTextures, bool aLoadTexturesInSrgb, bool aFlipTextures);
+		void decode_mesh(size_t aRequestIndex, const avk::model& aModel, mesh_index_t aMeshIndex);
+		void decode_texture(size_t aRequestIndex, const std::string& aPath, bool aLoadInSrgb, bool aFlip);
+		void record_failure(size_t aRequestIndex, const std::string& aMessage);
+
+		const size_t mStagingBudget;
+		size_t mStagedBytes = 0;
+		size_t mNextRequestIndex = 0;
+		size_t mRunningJobs = 0;
+		bool mStopping = false;
+
+		mutable std::mutex mMutex;
+		std::condition_variable mJobAvailable;
+		std::condition_variable mStagingMemoryFreed;
+		std::deque<std::function<void()>> mJobs;
+		std::unordered_set<std::string> mRequestedTextures;
+
+		std::vector<std::tuple<size_t, avk::model>> mLoadedModels;
+		std::deque<streamed_mesh> mReadyMeshes;
+		std::deque<streamed_texture> mReadyTextures;
+		std::vector<std::tuple<size_t, std::string>> mFailedRequests;
+		// All requests which have failed so far, s.t. each of them is reported only once:
+		std::unordered_set<size_t> mFailedRequestIndices;
+
+		std::shared_ptr<ready_event> mModelLoadedEvent;
+		std::shared_ptr<ready_event> mMeshReadyEvent;
+		std::shared_ptr<ready_event> mTextureReadyEvent;
+
+		std::vector<std::thread> mWorkers;
+	};
+}
@@ -27,6 +27,7 @@
 #include <atomic>
 #include <mutex>
 #include <condition_variable>
+#include <thread>
 #include <cstdlib>
 #include <typeindex>
 #include <type_traits>
@@ -34,8 +35,12 @@
 #include <cstdint>
 #include <chrono>
 #include <filesystem>
+#include <span>
+#include <numeric>
+#include <limits>
 
 #include <cstdio>
+#include <cstring>
 #include <cassert>
 
 // ----------------------- externals -----------------------
@@ -65,6 +70,7 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/packing.hpp>
 #include <glm/ext/quaternion_float.hpp>
 #include <glm/ext/quaternion_common.hpp>
 #include <glm/ext/quaternion_geometric.hpp>
@@ -97,6 +103,9 @@
 #define AVK_LOG_DEBUG			LOG_DEBUG
 #define AVK_LOG_DEBUG_VERBOSE	LOG_DEBUG_VERBOSE
 #include "log.hpp"
+#include "deferred_log.hpp"
+#include "log_sinks.hpp"
+#include "cpu_profiler.hpp"
 
 // Before including the Auto-Vk header, we define some settings
 // that influence Auto-Vk's behavior/workings:
@@ -112,4 +121,5 @@
 
 // -------------------- Auto-Vk-Toolkit Includes --------------------
 #include "format_for.hpp"
+#include "packed_vertex_formats.hpp"
 #include "window.hpp"
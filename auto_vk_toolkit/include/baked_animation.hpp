@@ -0,0 +1,225 @@
+#pragma once
+
+#include "animation.hpp"
+#include "packed_vertex_formats.hpp"
+#include "serializer.hpp"
+
+namespace avk
+{
+	/** A unit quaternion in smallest-three encoding with 48 bits: The largest component (by absolute value) is omitted,
+	 *	since it can be reconstructed from the other three, and the quaternion is negated if required, s.t. the omitted
+	 *	component is positive. The remaining three components are within [-1/sqrt(2), 1/sqrt(2)] and are stored with
+	 *	15 bits each in the lower bits of mValue. The index of the omitted component is stored in the highest bits
+	 *	of mValue.x and mValue.y.
+	 */
+	struct quantized_rotation_3x16
+	{
+		glm::u16vec3 mValue;
+	};
+
+	/** A vector quantized to 16-bit unsigned normalized values per component, relative to a range,
+	 *	which is stored as position_dequantization. */
+	struct quantized_vec3_3x16
+	{
+		glm::u16vec3 mValue;
+	};
+
+	/** Packs the given unit quaternion into smallest-three encoding with 48 bits. */
+	extern quantized_rotation_3x16 pack_rotation_smallest_three(const glm::quat& aRotation);
+
+	/** Unpacks a quaternion which has been packed with `pack_rotation_smallest_three`. */
+	extern glm::quat unpack_rotation_smallest_three(const quantized_rotation_3x16& aValue);
+
+	/** Uniformly sampled and quantized values of a translation or scaling track of a baked_animation. */
+	struct baked_vec3_track
+	{
+		/** The range which the samples have been quantized against */
+		position_dequantization mRange;
+		/** One sample per baked_animation sample, or only one sample if the value is constant. */
+		std::vector<quantized_vec3_3x16> mSamples;
+	};
+
+	/** Uniformly sampled and quantized values of a rotation track of a baked_animation. */
+	struct baked_rotation_track
+	{
+		/** One sample per baked_animation sample, or only one sample if the rotation is constant. */
+		std::vector<quantized_rotation_3x16> mSamples;
+	};
+
+	/** The tracks of a single node of a baked_animation, and the hierarchy information to compute its bone matrices. */
+	struct baked_animation_node
+	{
+		baked_vec3_track mTranslations;
+		baked_rotation_track mRotations;
+		baked_vec3_track mScales;
+		/** See animated_node::mAnimatedParentIndex */
+		std::optional<size_t> mAnimatedParentIndex;
+		/** See animated_node::mParentTransform */
+		glm::mat4 mParentTransform;
+		/** See animated_node::mBoneMeshTargets */
+		std::vector<bone_mesh_data> mBoneMeshTargets;
+	};
+
+	/**	An animation clip which has been resampled at a fixed rate, and whose translations, rotations, and scales
+	 *	have been quantized to 48 bits per sample. In contrast to an animation, which has to search for the keys which
+	 *	surround a given time, a baked_animation reads two samples at a computed index per node and interpolates
+	 *	between them. It does not reference the animation or model which it has been baked from, and it can be
+	 *	serialized, e.g., via bake_animation_cached.
+	 *
+	 *	The quantization error of translations and scales is at most half a step of the respective track's range
+	 *	divided by 65535, and the error of rotations is below 6e-5 per quaternion component. Rotations are
+	 *	interpolated linearly and normalized afterwards, i.e., they are not interpolated with constant angular
+	 *	velocity between two samples.
+	 */
+	class baked_animation
+	{
+	public:
+		baked_animation() = default;
+		baked_animation(baked_animation&&) noexcept = default;
+		baked_animation(const baked_animation&) = default;
+		baked_animation& operator=(baked_animation&&) noexcept = default;
+		baked_animation& operator=(const baked_animation&) = default;
+		~baked_animation() = default;
+
+		/**	Resamples the given clip of the given animation at a fixed rate, and quantizes the samples.
+		 *	@param	aAnimation			The animation which has been created for aClip's animation index
+		 *	@param	aClip				The clip to bake
+		 *	@param	aSamplesPerSecond	The sample rate. If not set, it is derived from the smallest distance between the clip's
+		 *								key times (see animation::animation_key_times_for_clip_in_ticks), limited to at most
+		 *								sMaxDerivedSamplesPerSecond. The rate is adapted slightly, s.t. the last sample is
+		 *								located exactly at the end of the clip.
+		 */
+		static baked_animation bake(const animation& aAnimation, const animation_clip_data& aClip, std::optional<double> aSamplesPerSecond = {});
+
+		/** Upper limit for sample rates which are derived from key times by bake */
+		static constexpr double sMaxDerivedSamplesPerSecond = 120.0;
+
+		/** The time in seconds of the first sample, i.e., the start of the baked clip */
+		double start_time() const { return mStartTime; }
+
+		/** The time in seconds of the last sample, i.e., the end of the baked clip */
+		double end_time() const { return mStartTime + static_cast<double>(mNumSamples > 0 ? mNumSamples - 1 : 0) / mSamplesPerSecond; }
+
+		/** The number of samples per second */
+		double samples_per_second() const { return mSamplesPerSecond; }
+
+		/** The number of samples of non-constant tracks */
+		size_t number_of_samples() const { return mNumSamples; }
+
+		/** The number of baked nodes, which corresponds to animation::number_of_animated_nodes of the baked animation */
+		size_t number_of_nodes() const { return mNodes.size(); }
+
+		/** Returns the node at the given index */
+		const baked_animation_node& node_at(size_t aNodeIndex) const { return mNodes[aNodeIndex]; }
+
+		/** The number of bytes which the samples of all tracks occupy */
+		size_t size_in_bytes() const;
+
+		/**	Computes the node-local transformation matrices of all nodes at the given time.
+		 *	@param	aTime				Time in seconds, which is clamped to [start_time(), end_time()]
+		 *	@param	aLocalTransforms	Target memory with one matrix per node
+		 */
+		void compute_local_transforms(double aTime, std::span<glm::mat4> aLocalTransforms) const;
+
+		/**	Calculates the bone animation at the given time, and writes all bone matrices into one single contiguous piece
+		 *	of memory, like animation::animate_into_single_target_buffer. A baked_animation is not modified by playback,
+		 *	i.e., this method may be invoked concurrently.
+		 *	@param	aTime				Time in seconds, which is clamped to [start_time(), end_time()]
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+		 *	@param	aTargetMemory		Pointer to the memory location where the first bone matrix shall be written to
+		 */
+		void animate_into_single_target_buffer(double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory) const;
+
+		/**	Calculates the bone animations of multiple instances in parallel, see animate_into_single_target_buffer.
+		 *	@param	aTimes				Per instance: time in seconds
+		 *	@param	aTargetMemories		Per instance: pointer to the memory location where the instance's first bone matrix shall be written to
+		 *	@param	aTargetSpace		The target space into which the vertices shall be transformed by multiplying them with the bone matrices
+		 *	@param	aMaxThreads			Maximum number of threads to use, including the calling thread.
+		 */
+		void animate_instances(std::span<const double> aTimes, std::span<glm::mat4* const> aTargetMemories, bone_matrices_space aTargetSpace = bone_matrices_space::mesh_space, size_t aMaxThreads = parallel_for_max_threads()) const;
+
+	private:
+		double mStartTime = 0.0;
+		double mSamplesPerSecond = 1.0;
+		size_t mNumSamples = 0;
+		std::vector<baked_animation_node> mNodes;
+
+		/** Make serialize a friend, so the serializer can access private data members. */
+		template<typename Archive>
+		friend void serialize(Archive& aArchive, baked_animation& aValue);
+	};
+
+	/**	Bakes the given clip of the given animation if the serializer is in serialize mode, or loads it otherwise.
+	 *	@param  aSerializer			The serializer for the baked animation.
+	 *	@param	aAnimation			The animation. Only used if the serializer is in serialize mode.
+	 *	@param	aClip				The clip to bake. Only used if the serializer is in serialize mode.
+	 *	@param	aSamplesPerSecond	The sample rate, see baked_animation::bake. Only used if the serializer is in serialize mode.
+	 */
+	extern baked_animation bake_animation_cached(avk::serializer& aSerializer, const animation& aAnimation, const animation_clip_data& aClip, std::optional<double> aSamplesPerSecond = {});
+
+	/** Serialization/deserialization method for quantized_rotation_3x16.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, quantized_rotation_3x16& aValue)
+	{
+		aArchive(aValue.mValue.x, aValue.mValue.y, aValue.mValue.z);
+	}
+
+	/** Serialization/deserialization method for quantized_vec3_3x16.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, quantized_vec3_3x16& aValue)
+	{
+		aArchive(aValue.mValue.x, aValue.mValue.y, aValue.mValue.z);
+	}
+
+	/** Serialization/deserialization method for baked_vec3_track.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, baked_vec3_track& aValue)
+	{
+		aArchive(aValue.mRange, aValue.mSamples);
+	}
+
+	/** Serialization/deserialization method for baked_rotation_track.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, baked_rotation_track& aValue)
+	{
+		aArchive(aValue.mSamples);
+	}
+
+	/** Serialization/deserialization method for baked_animation_node.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, baked_animation_node& aValue)
+	{
+		aArchive(aValue.mTranslations, aValue.mRotations, aValue.mScales, aValue.mAnimatedParentIndex, aValue.mParentTransform, aValue.mBoneMeshTargets);
+	}
+
+	/** Serialization/deserialization method for baked_animation.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, baked_animation& aValue)
+	{
+		aArchive(aValue.mStartTime, aValue.mSamplesPerSecond, aValue.mNumSamples, aValue.mNodes);
+	}
+}
@@ -4,6 +4,7 @@
 #include "composition_interface.hpp"
 #include "context_vulkan.hpp"
 #include "timer_interface.hpp"
+#include "task_graph_invoker.hpp"
 
 #define SINGLE_THREADED 1
 
@@ -148,6 +149,29 @@ namespace avk
 #endif
 		}
 
+		/** Swaps the input buffers on the main thread, s.t. the input of the next frame becomes the current input */
+		void swap_input_buffers()
+		{
+			auto* windowForCursorActions = context().window_in_focus();
+			// The buffer which has been updated becomes the buffer which will be consumed in the next frame
+			//  update-buffer = previous frame, i.e. done
+			//  consumer-index = updated in the next frame, i.e. to be done
+			input_buffer::prepare_for_next_frame(
+				mInputBuffers[mInputBufferBackgroundIndex], 
+				mInputBuffers[mInputBufferForegroundIndex], 
+				windowForCursorActions);
+			std::swap(mInputBufferForegroundIndex, mInputBufferBackgroundIndex);
+
+			// TODO: This is a bit (read: a lot) stupid, that this is tied to the main_window => support multiple windows here gracefully:
+			int width = 0, height = 0;
+		    glfwGetFramebufferSize(context().main_window()->handle()->mHandle, &width, &height);
+		    while (width == 0 || height == 0) {
+		        glfwGetFramebufferSize(context().main_window()->handle()->mHandle, &width, &height);
+		        glfwWaitEvents();
+		    }
+			context().main_window()->update_resolution();
+		}
+
 		static void signal_input_buffers_have_been_swapped()
 		{
 #if !SINGLE_THREADED
@@ -160,6 +184,7 @@ namespace avk
 		{
 #if !SINGLE_THREADED
 			using namespace std::chrono_literals;
+			AVK_PROFILE_SCOPE("composition::wait_for_input_buffers_swapped");
 			
 			std::unique_lock<std::mutex> lk(sCompMutex);
 			if (thiz->mInputBufferSwapPending) {
@@ -193,17 +218,24 @@ namespace avk
 #endif
 		}
 
-		/** Rendering thread's main function */
-		template <typename UC, typename RC>
-		static void render_thread(composition* thiz, UC aUpdateCallback, RC aRenderCallback)
+		/** Rendering thread's main function
+		 *	@param	aFrameCallback		Invokes the update() and render() methods of one frame, see start_render_loop_with_frame_callback
+		 */
+		template <typename FC>
+		static void render_thread(composition* thiz, FC aFrameCallback)
 		{
 			// Used to distinguish between "simulation" and "render"-frames
 			auto frameType = timer_frame_type::none;
 
 #if !SINGLE_THREADED
+			set_cpu_profile_thread_name("render thread");
 			while (!thiz->mShouldStop)
 			{
 #endif
+				// Accumulate the profiled zones of the previous frame, including its composition::frame zone:
+				end_cpu_profile_frame();
+				AVK_PROFILE_SCOPE("composition::frame");
+
 				thiz->add_pending_elements();
 
 				// signal context
@@ -219,30 +251,17 @@ namespace avk
 					e->handle_enabling();
 				}
 
-				// 3. update
-				if ((frameType & timer_frame_type::update) == timer_frame_type::update)
-				{
-					aUpdateCallback(static_cast<const std::vector<invokee*>&>(thiz->mElements));
-
+				// 3. update and 4. render:
+				const std::function<void()> updatesDone = []() {
 					// signal context:
 					context().update_stage_done();
 					awake_main_thread(); // Let the main thread work concurrently
-				}
-
-				if ((frameType & timer_frame_type::render) == timer_frame_type::render)
-				{
-					// Tell the main thread that we'd like to have the new input buffers from A) here:
-					please_swap_input_buffers(thiz);
-
-					// 4. render:
-					aRenderCallback(static_cast<const std::vector<invokee*>&>(thiz->mElements));
-				}
-				else
-				{
-					// If not performed from inside the positive if-branch, tell the main thread of our 
-					// input buffer update desire here:
+				};
+				const std::function<void()> requestInputBufferSwap = [thiz]() {
+					// Tell the main thread that we'd like to have the new input buffers:
 					please_swap_input_buffers(thiz);
-				}
+				};
+				aFrameCallback(static_cast<const std::vector<invokee*>&>(thiz->mElements), frameType, updatesDone, requestInputBufferSwap);
 
 				// 5. check and possibly issue on_disable event handlers
 				for (auto& e : thiz->mElements) {
@@ -307,16 +326,69 @@ namespace avk
 		 *	The loop will run as long as its internal mShouldStop is false, which can be changed via composition_interface::stop.
 		 *	You must pass two callback functions as parameters:
 		 *	@param	aUpdateCallback		A function which must invoke all the passed invokee's update() methods if they are enabled.
-		 *                              Hint: You could use avk::sequential_invoker for this task.
+		 *                              Hint: You could use avk::sequential_invoker or avk::parallel_invoker for this task.
 		 *                              Required signature of the callback: void(const std::vector<invokee*>&)
 		 *	@param	aRenderCallback		A function which must invoke all the passed invokee's render() methods if they are enabled.
-		 *                              Hint: You could use avk::sequential_invoker for this task.
+		 *                              Hint: You could use avk::sequential_invoker or avk::parallel_invoker for this task.
 		 *                              Furthermore, if windows are used, window::sync_before_render must be invoked for every active
 		 *                              window before the render() invokations, and window::render_frame must be invoked afterwards.
 		 *                              Required signature of the callback: void(const std::vector<invokee*>&)
 		 */
 		template <typename UC, typename RC>
 		void start_render_loop(UC aUpdateCallback, RC aRenderCallback)
+		{
+			start_render_loop_with_frame_callback(
+				[lUpdateCallback = std::move(aUpdateCallback), lRenderCallback = std::move(aRenderCallback)](const std::vector<invokee*>& aElements, timer_frame_type aFrameType, const std::function<void()>& aUpdatesDone, const std::function<void()>& aRequestInputBufferSwap) mutable {
+					// 3. update
+					if ((aFrameType & timer_frame_type::update) == timer_frame_type::update) {
+						lUpdateCallback(aElements);
+						aUpdatesDone();
+					}
+
+					// Tell the main thread that we'd like to have the new input buffers from A) here:
+					aRequestInputBufferSwap();
+
+					// 4. render:
+					if ((aFrameType & timer_frame_type::render) == timer_frame_type::render) {
+						lRenderCallback(aElements);
+					}
+				}
+			);
+		}
+
+		/**	Start the render loop for the (previously configured) composition, in which the given invoker schedules
+		 *	the update() and render() invocations of each frame as a frame_task_graph. It also takes care of
+		 *	window::sync_before_render and window::render_frame. Depending on the invoker's configuration, the
+		 *	render() calls of a frame overlap with the update() calls of the next frame (see task_graph_invoker).
+		 *	The loop will run as long as its internal mShouldStop is false, which can be changed via composition_interface::stop.
+		 *	@param	aInvoker			The invoker which builds and executes the task graph of each frame
+		 */
+		void start_render_loop(task_graph_invoker& aInvoker)
+		{
+			start_render_loop_with_frame_callback(
+				[this, &aInvoker](const std::vector<invokee*>& aElements, timer_frame_type aFrameType, const std::function<void()>& aUpdatesDone, const std::function<void()>& aRequestInputBufferSwap) {
+#if SINGLE_THREADED
+					// The graph is executed on the main thread => swap the input buffers in its last task, which
+					// depends on all tasks which could read the current input buffer, instead of afterwards:
+					aInvoker.invoke_frame(aElements, aFrameType, aUpdatesDone, [this]() { swap_input_buffers(); });
+#else
+					aInvoker.invoke_frame(aElements, aFrameType, aUpdatesDone, aRequestInputBufferSwap);
+#endif
+				}
+			);
+		}
+
+		/**	Start the render loop for the (previously configured) composition, with one callback per frame.
+		 *	The loop will run as long as its internal mShouldStop is false, which can be changed via composition_interface::stop.
+		 *	@param	aFrameCallback		A function which must invoke the update() methods of all the passed invokees if the frame type
+		 *								contains timer_frame_type::update, followed by the first passed function, and their render()
+		 *								methods if the frame type contains timer_frame_type::render. It must invoke the second passed
+		 *								function once per frame, when the current input buffer is no longer needed by update() calls.
+		 *								Required signature of the callback: void(const std::vector<invokee*>&, timer_frame_type,
+		 *								const std::function<void()>& aUpdatesDone, const std::function<void()>& aRequestInputBufferSwap)
+		 */
+		template <typename FC>
+		void start_render_loop_with_frame_callback(FC aFrameCallback)
 		{
 			context().work_off_event_handlers();
 
@@ -344,12 +416,13 @@ namespace avk
 
 			// game-/render-loop:
 			mIsRunning = true;
+			set_cpu_profile_thread_name("main thread");
 
 #if !SINGLE_THREADED
 			// off it goes
 			std::thread renderThread(
-				render_thread<decltype(aUpdateCallback), decltype(aRenderCallback)>,
-				this, std::move(aUpdateCallback), std::move(aRenderCallback));
+				render_thread<FC>,
+				this, std::move(aFrameCallback));
 #endif
 			
 			while (!mShouldStop)
@@ -360,30 +433,13 @@ namespace avk
 #if !SINGLE_THREADED
 				std::unique_lock<std::mutex> lk(sCompMutex);
 #else
-				render_thread(this, std::move(aUpdateCallback), std::move(aRenderCallback));
+				render_thread(this, aFrameCallback);
 #endif
 				if (mInputBufferSwapPending) {
-					auto* windowForCursorActions = context().window_in_focus();
-					// The buffer which has been updated becomes the buffer which will be consumed in the next frame
-					//  update-buffer = previous frame, i.e. done
-					//  consumer-index = updated in the next frame, i.e. to be done
-					input_buffer::prepare_for_next_frame(
-						mInputBuffers[mInputBufferBackgroundIndex], 
-						mInputBuffers[mInputBufferForegroundIndex], 
-						windowForCursorActions);
-					std::swap(mInputBufferForegroundIndex, mInputBufferBackgroundIndex);
+					swap_input_buffers();
 
 					// reset flag:
 					mInputBufferSwapPending = false;
-
-					// TODO: This is a bit (read: a lot) stupid, that this is tied to the main_window => support multiple windows here gracefully:
-					int width = 0, height = 0;
-				    glfwGetFramebufferSize(context().main_window()->handle()->mHandle, &width, &height);
-				    while (width == 0 || height == 0) {
-				        glfwGetFramebufferSize(context().main_window()->handle()->mHandle, &width, &height);
-				        glfwWaitEvents();
-				    }
-					context().main_window()->update_resolution();
 					
 #if !SINGLE_THREADED
 					// resume render_thread:
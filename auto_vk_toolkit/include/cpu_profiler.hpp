@@ -0,0 +1,159 @@
+#pragma once
+
+namespace avk
+{
+	// Set AVK_CPU_PROFILING to 0 to compile all AVK_PROFILE_SCOPE zones out. Otherwise, profiling can still be
+	// turned off at runtime via set_cpu_profiling_enabled.
+	#if !defined(AVK_CPU_PROFILING)
+	#define AVK_CPU_PROFILING 1
+	#endif
+
+	// Number of zones which are kept per thread, for statistics and for export_cpu_profile_chrome_trace:
+	#if !defined(CPU_PROFILE_EVENTS_PER_THREAD)
+	#define CPU_PROFILE_EVENTS_PER_THREAD 16384
+	#endif
+
+	// Number of frames over which profile_zone_statistics are computed:
+	#if !defined(CPU_PROFILE_STATISTICS_FRAMES)
+	#define CPU_PROFILE_STATISTICS_FRAMES 120
+	#endif
+
+	/** One recorded zone, i.e., a named interval of time on one thread */
+	struct cpu_profile_event
+	{
+		uint32_t mNameId;
+		int64_t mBeginNs;
+		int64_t mEndNs;
+	};
+
+	/**	The timings of one zone name, which are accumulated per frame, i.e., if a zone has been recorded
+	 *	multiple times during a frame, its durations are summed up. Frames without any such zone are not counted.
+	 */
+	struct profile_zone_statistics
+	{
+		std::string_view mName;
+		double mLastMs;
+		double mAverageMs;
+		double mMinMs;
+		double mMaxMs;
+		uint32_t mCallsInLastFrame;
+		uint32_t mNumFrames;
+	};
+
+	/**	Accumulates the durations of zones per name and frame, and computes their profile_zone_statistics over the
+	 *	last CPU_PROFILE_STATISTICS_FRAMES frames. Used by the CPU profiler and by gpu_profiler. Not thread-safe.
+	 */
+	class profile_statistics_accumulator
+	{
+	public:
+		/** Adds the duration of one zone to the current frame */
+		void add(uint32_t aNameId, double aDurationMs);
+
+		/** Completes the current frame, and starts the next one */
+		void end_frame();
+
+		/** Returns the statistics of all zone names which have been added during the recent frames */
+		std::vector<profile_zone_statistics> statistics() const;
+
+	private:
+		struct history
+		{
+			std::array<double, CPU_PROFILE_STATISTICS_FRAMES> mFrameMs{};
+			uint32_t mNumFrames = 0;
+			uint64_t mLastFrame = 0;
+			double mCurrentMs = 0.0;
+			uint32_t mCurrentCalls = 0;
+			uint32_t mLastCalls = 0;
+		};
+
+		std::vector<history> mHistories; // Indexed by name id
+		std::vector<uint32_t> mNameIdsInCurrentFrame;
+		uint64_t mFrame = 1;
+	};
+
+	/** A name id which is never handed out by cpu_profile_name_id. Zones which are constructed with it are not recorded. */
+	inline constexpr uint32_t cpu_profile_no_name_id = std::numeric_limits<uint32_t>::max();
+
+	/** Returns the current time in nanoseconds, as used by all cpu_profile_events */
+	extern int64_t cpu_profile_now_ns();
+
+	/**	Returns the id of the given zone name, which is added to the set of known names if necessary.
+	 *	This involves a lookup under a lock, so prefer to cache the result (as AVK_PROFILE_SCOPE does).
+	 *	@param	aName		The name of a zone
+	 */
+	extern uint32_t cpu_profile_name_id(std::string_view aName);
+
+	/**	Returns the id of the zone name which consists of aPrefix directly followed by aSuffix,
+	 *	e.g., for zones which are named after an invokee.
+	 */
+	extern uint32_t cpu_profile_name_id(std::string_view aPrefix, std::string_view aSuffix);
+
+	/** Returns the zone name of the given id, which stays valid until the end of the program */
+	extern std::string_view cpu_profile_name(uint32_t aNameId);
+
+	/** Enables or disables recording of zones at runtime. It is enabled by default. */
+	extern void set_cpu_profiling_enabled(bool aEnabled);
+
+	/** Returns whether zones are currently being recorded */
+	extern bool is_cpu_profiling_enabled();
+
+	/** Sets the name under which the calling thread's zones are exported */
+	extern void set_cpu_profile_thread_name(std::string_view aName);
+
+	/**	Records one zone on the calling thread. Usually, zones are recorded through cpu_profile_zone instead.
+	 *	@param	aNameId		The zone's name, see cpu_profile_name_id
+	 *	@param	aBeginNs	Begin of the zone, see cpu_profile_now_ns
+	 *	@param	aEndNs		End of the zone, see cpu_profile_now_ns
+	 */
+	extern void record_cpu_profile_event(uint32_t aNameId, int64_t aBeginNs, int64_t aEndNs);
+
+	/**	Accumulates the zones which all threads have recorded since the previous call into the statistics of
+	 *	the current frame, and starts the next frame. This is invoked by the composition once per frame.
+	 */
+	extern void end_cpu_profile_frame();
+
+	/** Returns the statistics of all zone names which have been recorded during the last CPU_PROFILE_STATISTICS_FRAMES frames */
+	extern std::vector<profile_zone_statistics> cpu_profile_statistics_of_recent_frames();
+
+	/**	Writes all zones which are still kept by the threads' buffers (see CPU_PROFILE_EVENTS_PER_THREAD) to a file in the
+	 *	Chrome trace event format, which can be opened with chrome://tracing, Perfetto, or Speedscope. The buffers of
+	 *	threads which have exited are released by end_cpu_profile_frame, i.e., their zones are no longer exported then.
+	 *	@param	aPath		Path to the JSON file which is written
+	 */
+	extern void export_cpu_profile_chrome_trace(const std::filesystem::path& aPath);
+
+	/**	Records the time between its construction and its destruction as a zone of the calling thread,
+	 *	if profiling is enabled. Zones may be nested.
+	 */
+	class cpu_profile_zone
+	{
+	public:
+		explicit cpu_profile_zone(uint32_t aNameId);
+		~cpu_profile_zone();
+		cpu_profile_zone(const cpu_profile_zone&) = delete;
+		cpu_profile_zone(cpu_profile_zone&&) = delete;
+		cpu_profile_zone& operator=(const cpu_profile_zone&) = delete;
+		cpu_profile_zone& operator=(cpu_profile_zone&&) = delete;
+
+	private:
+		static constexpr uint32_t sNoZone = cpu_profile_no_name_id;
+		uint32_t mNameId;
+		int64_t mBeginNs;
+	};
+
+	#define AVK_PROFILE_CONCAT_IMPL(a, b) a##b
+	#define AVK_PROFILE_CONCAT(a, b) AVK_PROFILE_CONCAT_IMPL(a, b)
+
+	#if AVK_CPU_PROFILING
+	/** Records a zone with the given name from here to the end of the enclosing scope. The name must be the same at every invocation. */
+	#define AVK_PROFILE_SCOPE(name) \
+		static const uint32_t AVK_PROFILE_CONCAT(sProfileNameId, __LINE__) = avk::cpu_profile_name_id(name); \
+		const avk::cpu_profile_zone AVK_PROFILE_CONCAT(lProfileZone, __LINE__){ AVK_PROFILE_CONCAT(sProfileNameId, __LINE__) }
+	/** Records a zone with a name which has already been obtained via cpu_profile_name_id, from here to the end of the enclosing scope */
+	#define AVK_PROFILE_SCOPE_ID(nameId) \
+		const avk::cpu_profile_zone AVK_PROFILE_CONCAT(lProfileZone, __LINE__){ nameId }
+	#else
+	#define AVK_PROFILE_SCOPE(name)
+	#define AVK_PROFILE_SCOPE_ID(nameId)
+	#endif
+}
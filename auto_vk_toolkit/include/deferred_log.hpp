@@ -0,0 +1,130 @@
+#pragma once
+
+namespace avk
+{
+	/** Identifies the type of an argument which has been encoded by encode_log_argument */
+	enum struct log_argument_tag : uint8_t
+	{
+		int64,
+		uint64,
+		float32,
+		float64,
+		boolean,
+		character,
+		string,
+		pointer
+	};
+
+	/** True for the (cv-unqualified, non-reference) argument types which encode_log_argument supports */
+	template <typename T>
+	inline constexpr bool is_deferrable_log_argument_v =
+		(std::is_arithmetic_v<T> && !std::is_same_v<T, long double>)
+		|| std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>
+		|| std::is_same_v<T, const char*> || std::is_same_v<T, char*>
+		|| std::is_same_v<T, const void*> || std::is_same_v<T, void*>
+		|| (std::is_array_v<T> && std::is_same_v<std::remove_cv_t<std::remove_extent_t<T>>, char>);
+
+	/**	Appends a tag, which identifies the argument's type, and the argument's value to aOut. Strings are stored
+	 *	with their length and characters, all other values in their native representation.
+	 *	@param	aOut	The buffer to append to
+	 *	@param	aArg	The argument, whose type must fulfill is_deferrable_log_argument_v
+	 */
+	template <typename T>
+	void encode_log_argument(std::string& aOut, const T& aArg)
+	{
+		static_assert(is_deferrable_log_argument_v<T>);
+		auto put = [&aOut](log_argument_tag aTag, const void* aData, size_t aSize) {
+			aOut.push_back(static_cast<char>(aTag));
+			aOut.append(static_cast<const char*>(aData), aSize);
+		};
+		if constexpr (std::is_same_v<T, bool>) {
+			put(log_argument_tag::boolean, &aArg, sizeof(bool));
+		}
+		else if constexpr (std::is_same_v<T, char>) {
+			put(log_argument_tag::character, &aArg, sizeof(char));
+		}
+		else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+			const int64_t value = aArg;
+			put(log_argument_tag::int64, &value, sizeof(value));
+		}
+		else if constexpr (std::is_integral_v<T>) {
+			const uint64_t value = aArg;
+			put(log_argument_tag::uint64, &value, sizeof(value));
+		}
+		else if constexpr (std::is_same_v<T, float>) {
+			put(log_argument_tag::float32, &aArg, sizeof(float));
+		}
+		else if constexpr (std::is_floating_point_v<T>) {
+			const double value = aArg;
+			put(log_argument_tag::float64, &value, sizeof(value));
+		}
+		else if constexpr (std::is_same_v<T, const void*> || std::is_same_v<T, void*>) {
+			const uint64_t value = reinterpret_cast<uintptr_t>(aArg);
+			put(log_argument_tag::pointer, &value, sizeof(value));
+		}
+		else {
+			std::string_view value;
+			if constexpr (std::is_pointer_v<T>) {
+				value = nullptr == aArg ? std::string_view{} : std::string_view{ aArg };
+			}
+			else {
+				value = std::string_view{ aArg };
+			}
+			const auto size = static_cast<uint32_t>(value.size());
+			put(log_argument_tag::string, &size, sizeof(size));
+			aOut.append(value.data(), size);
+		}
+	}
+
+	/**	A format string which is checked at compile time against the given argument types, like std::format_string,
+	 *	but which also provides access to the string itself.
+	 */
+	template <typename... Args>
+	struct log_format_string
+	{
+		template <typename S> requires std::is_convertible_v<const S&, std::string_view>
+		consteval log_format_string(const S& aFormat)
+			: mFormat{ aFormat }
+		{
+			[[maybe_unused]] const std::format_string<Args...> check{ aFormat };
+		}
+
+		std::string_view mFormat;
+	};
+
+	/** A buffer for encoding arguments, which is reused by all messages which are logged on the calling thread */
+	extern std::string& thread_local_log_argument_buffer();
+
+	/**	Appends the complete text of a deferred message to aOut, i.e., the site's prefix, the formatted arguments,
+	 *	and the site's file and line.
+	 *	@param	aOut			The string to append to
+	 *	@param	aSite			The message's call site
+	 *	@param	aFormat			The format string, which may contain all replacement fields which std::format supports
+	 *	@param	aArguments		The arguments, encoded via encode_log_argument
+	 */
+	extern void append_log_message(std::string& aOut, const log_site& aSite, std::string_view aFormat, std::string_view aArguments);
+
+	/** Returns the complete text of a message which has already been formatted, like append_log_message does. */
+	extern std::string compose_log_message(const log_site& aSite, std::string_view aFormatted);
+
+	/**	Dispatches a log message, which is used by all LOG_* macros. If all arguments are of types which
+	 *	can be encoded (see is_deferrable_log_argument_v), they are encoded into a thread-local buffer and
+	 *	the message is formatted on the logger thread, or by a log_sink. Otherwise, it is formatted immediately.
+	 *	@param	aSite			The call site, which must have static storage duration
+	 *	@param	aFormat			The format string, which is checked at compile time
+	 *	@param	aArgs			The arguments
+	 */
+	template <typename... Args>
+	void dispatch_log_deferred(const log_site& aSite, std::type_identity_t<log_format_string<Args...>> aFormat, Args&&... aArgs)
+	{
+		if constexpr ((is_deferrable_log_argument_v<std::remove_cvref_t<Args>> && ...)) {
+			auto& buffer = thread_local_log_argument_buffer();
+			buffer.clear();
+			(encode_log_argument<std::remove_cvref_t<Args>>(buffer, aArgs), ...);
+			dispatch_log(aSite, aFormat.mFormat, buffer);
+		}
+		else {
+			dispatch_log(log_pack{ compose_log_message(aSite, std::vformat(aFormat.mFormat, std::make_format_args(aArgs...))), aSite.mLogType, aSite.mLogImportance });
+		}
+	}
+}
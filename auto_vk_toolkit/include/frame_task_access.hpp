@@ -0,0 +1,80 @@
+#pragma once
+
+namespace avk
+{
+	/**	Declares which resources a task of a frame_task_graph reads and writes. Resources are identified by arbitrary names.
+	 *	Two tasks conflict if one of them writes a resource which the other one reads or writes, and conflicting tasks
+	 *	are executed in the order in which they have been added to the graph. All other tasks may run concurrently.
+	 *
+	 *	A default-constructed frame_task_access is exclusive, i.e., the task is assumed to access everything and conflicts
+	 *	with all tasks which access any resource. Declaring any read or write, or calling independent(), turns it into
+	 *	a non-exclusive access.
+	 */
+	class frame_task_access
+	{
+	public:
+		/** Declares that the task reads the given resource */
+		frame_task_access& reads(std::string aResource)
+		{
+			mReads.push_back(std::move(aResource));
+			mExclusive = false;
+			return *this;
+		}
+
+		/** Declares that the task writes the given resource */
+		frame_task_access& writes(std::string aResource)
+		{
+			mWrites.push_back(std::move(aResource));
+			mExclusive = false;
+			return *this;
+		}
+
+		/** Declares that the task does not access any other resources than those declared via reads and writes */
+		frame_task_access& independent()
+		{
+			mExclusive = false;
+			return *this;
+		}
+
+		/** True if nothing has been declared, i.e., if the task may access anything */
+		bool is_exclusive() const { return mExclusive; }
+
+		/** The declared resources which are read */
+		const std::vector<std::string>& read_resources() const { return mReads; }
+
+		/** The declared resources which are written */
+		const std::vector<std::string>& written_resources() const { return mWrites; }
+
+		/** True if tasks with the given accesses must not run concurrently */
+		static bool conflict(const frame_task_access& aFirst, const frame_task_access& aSecond)
+		{
+			if (aFirst.accesses_nothing() || aSecond.accesses_nothing()) {
+				return false;
+			}
+			if (aFirst.mExclusive || aSecond.mExclusive) {
+				return true;
+			}
+			auto contains = [](const std::vector<std::string>& aResources, const std::string& aResource) {
+				return std::find(std::begin(aResources), std::end(aResources), aResource) != std::end(aResources);
+			};
+			for (const auto& w : aFirst.mWrites) {
+				if (contains(aSecond.mReads, w) || contains(aSecond.mWrites, w)) {
+					return true;
+				}
+			}
+			for (const auto& w : aSecond.mWrites) {
+				if (contains(aFirst.mReads, w)) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+	private:
+		bool accesses_nothing() const { return !mExclusive && mReads.empty() && mWrites.empty(); }
+
+		std::vector<std::string> mReads;
+		std::vector<std::string> mWrites;
+		bool mExclusive = true;
+	};
+}
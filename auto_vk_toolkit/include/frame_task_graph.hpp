@@ -0,0 +1,69 @@
+#pragma once
+
+#include "frame_task_access.hpp"
+#include "parallel_invoker.hpp"
+
+namespace avk
+{
+	/**	A graph of the tasks of a frame, whose dependencies are derived from the resources which the tasks declare to
+	 *	read and write (see frame_task_access), and from explicitly added dependencies. Tasks which do not depend on
+	 *	each other, directly or indirectly, may be executed concurrently.
+	 *
+	 *	A task depends on all previously added tasks which it conflicts with, i.e., conflicting tasks are executed in
+	 *	the order in which they have been added. Tasks can be restricted to the calling thread of execute, which is
+	 *	required, e.g., for tasks which submit to queues or which interact with windows.
+	 */
+	class frame_task_graph
+	{
+	public:
+		/** Identifies a task of a frame_task_graph */
+		using task_id = size_t;
+
+		/**	Adds a task, which depends on all previously added tasks that it conflicts with.
+		 *	@param	aName				Name of the task, for debugging purposes
+		 *	@param	aFunc				The function which performs the task
+		 *	@param	aAccess				The resources which the task reads and writes
+		 *	@param	aOnCallingThread	If true, the task is executed on the thread which invokes execute
+		 *	@return	The id of the new task
+		 */
+		task_id add_task(std::string aName, std::function<void()> aFunc, frame_task_access aAccess = {}, bool aOnCallingThread = false);
+
+		/**	Adds an explicit dependency between two tasks.
+		 *	@param	aTask				The task which must not start before aPrerequisite has finished
+		 *	@param	aPrerequisite		A task which has been added before aTask
+		 */
+		void add_dependency(task_id aTask, task_id aPrerequisite);
+
+		/** Removes all tasks */
+		void clear();
+
+		/** The number of tasks */
+		size_t number_of_tasks() const { return mTasks.size(); }
+
+		/** The name of the given task */
+		const std::string& name_of(task_id aTask) const { return mTasks[aTask].mName; }
+
+		/** The tasks which the given task depends on directly */
+		const std::vector<task_id>& dependencies_of(task_id aTask) const { return mTasks[aTask].mDependencies; }
+
+		/**	Executes all tasks. A task is started as soon as all of its dependencies have finished. All tasks have
+		 *	finished when this method returns. If a task throws, no further tasks are started, and the first
+		 *	exception is rethrown after all running tasks have finished.
+		 *	@param	aInvoker			The invoker whose threads execute the tasks
+		 */
+		void execute(parallel_invoker& aInvoker);
+
+	private:
+		struct task
+		{
+			std::string mName;
+			std::function<void()> mFunc;
+			frame_task_access mAccess;
+			bool mOnCallingThread;
+			std::vector<task_id> mDependencies;
+			std::vector<task_id> mDependents;
+		};
+
+		std::vector<task> mTasks;
+	};
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+namespace avk
+{
+	// Maximum number of GPU zones per frame (if not specified otherwise via window::enable_gpu_profiling):
+	#if !defined(GPU_PROFILE_MAX_ZONES_PER_FRAME)
+	#define GPU_PROFILE_MAX_ZONES_PER_FRAME 256
+	#endif
+
+	/** One GPU zone of a frame whose results have been read back */
+	struct gpu_profile_zone_result
+	{
+		std::string_view mName;
+		/** Begin of the zone, relative to the earliest zone of the same frame */
+		double mBeginMs;
+		double mDurationMs;
+	};
+
+	/**	Measures the GPU time of named zones of recorded commands via timestamp queries. Every frame in flight of the
+	 *	window which owns it (see window::enable_gpu_profiling) has its own query pool. The results of a frame are
+	 *	read back in window::sync_before_render, right after the frame's fence has been waited on, i.e., without
+	 *	waiting on the GPU. Hence, the results are available number_of_frames_in_flight() frames after recording.
+	 *
+	 *	Zones must be created during the render() calls of the invokees, i.e., between window::sync_before_render and
+	 *	window::render_frame, and they must be recorded outside of render pass instances, because they reset their queries.
+	 *	Zones of commands which are not submitted before the frame's fence is signalled (e.g., to a different queue)
+	 *	are only reported if their results are available nevertheless.
+	 *
+	 *	The timestamps are interpreted according to the timestampValidBits of the window's presentation queue's family.
+	 *	If that family does not support timestamps, zones return their nested commands without measuring them.
+	 */
+	class gpu_profiler
+	{
+	public:
+		/**	@param	aMaxZonesPerFrame	Maximum number of zones per frame. Further zones are not measured.
+		 */
+		explicit gpu_profiler(uint32_t aMaxZonesPerFrame = GPU_PROFILE_MAX_ZONES_PER_FRAME);
+		gpu_profiler(gpu_profiler&&) = delete;
+		gpu_profiler(const gpu_profiler&) = delete;
+		gpu_profiler& operator=(gpu_profiler&&) = delete;
+		gpu_profiler& operator=(const gpu_profiler&) = delete;
+		~gpu_profiler() = default;
+
+		/**	Creates a command which measures the GPU time of the given nested commands, e.g., of a render pass.
+		 *	@param	aNameId				The zone's name, see cpu_profile_name_id. GPU zones share their names with CPU zones.
+		 *	@param	aNestedCommands		The commands to be measured
+		 *	@return	A command which writes a timestamp before and after the nested commands
+		 */
+		avk::command::action_type_command zone(uint32_t aNameId, std::vector<avk::recorded_commands_t> aNestedCommands);
+
+		/**	Creates a command which measures the GPU time of the given nested commands, see zone(uint32_t, ...)
+		 *	@param	aName				The zone's name
+		 *	@param	aNestedCommands		The commands to be measured
+		 */
+		avk::command::action_type_command zone(std::string_view aName, std::vector<avk::recorded_commands_t> aNestedCommands);
+
+		/**	Reads back the results of the frame which has previously used the given frame in flight, and starts
+		 *	the allocation of that frame's zones. This is invoked by window::sync_before_render after the frame's
+		 *	fence has been waited on.
+		 *	@param	aInFlightIndex			The window's current_in_flight_index()
+		 *	@param	aNumFramesInFlight		The window's number_of_frames_in_flight()
+		 *	@param	aQueueFamilyIndex		Family of the queue which the zones are submitted to. Only evaluated at the first invocation.
+		 */
+		void begin_frame(size_t aInFlightIndex, size_t aNumFramesInFlight, uint32_t aQueueFamilyIndex);
+
+		/** Returns the zones of the most recent frame whose results have been read back, in recording order */
+		std::vector<gpu_profile_zone_result> last_frame_results() const;
+
+		/** Returns the statistics of all zone names which have been measured during the recent frames */
+		std::vector<profile_zone_statistics> statistics() const;
+
+		/** Returns the number of zones which have not been measured, because more than aMaxZonesPerFrame have been created in a frame */
+		uint64_t number_of_dropped_zones() const;
+
+	private:
+		struct frame_queries
+		{
+			avk::query_pool mPool;
+			std::vector<uint32_t> mNameIds; // Zone i uses the queries 2i and 2i+1
+		};
+
+		void read_back(frame_queries& aFrame);
+
+		mutable std::mutex mMutex;
+		uint32_t mMaxZonesPerFrame;
+		double mTimestampPeriodNs;
+		std::optional<uint32_t> mTimestampValidBits; // Set by the first begin_frame
+		uint64_t mTimestampMask;
+		std::vector<frame_queries> mFrames; // One per frame in flight
+		size_t mCurrentInFlightIndex = 0;
+		std::vector<gpu_profile_zone_result> mLastFrameResults;
+		profile_statistics_accumulator mStatistics;
+		uint64_t mNumDroppedZones = 0;
+	};
+}
@@ -145,9 +145,25 @@ namespace avk
 		void set_previous_image_layout(layout::image_layout aIncomingLayout) {
 			mIncomingLayout = aIncomingLayout;
 		}
+
+		/** Shows or hides a window with the timings of the CPU profiler's zones (see cpu_profiler.hpp),
+		 *	i.e., of the stages of a frame and of every invokee's update() and render(), over the recent frames.
+		 *	If GPU profiling has been enabled for the main window (see window::enable_gpu_profiling), the timings
+		 *	of its GPU zones are shown as well. The main window's frame latencies (see window::recent_frame_latencies)
+		 *	are shown, too, and its pipelined acquire can be toggled.
+		 */
+		void set_profiler_overlay_enabled(bool aEnabled) {
+			mProfilerOverlayEnabled = aEnabled;
+		}
+
+		/** Indicates whether or not the profiler overlay is shown, see set_profiler_overlay_enabled */
+		bool is_profiler_overlay_enabled() const {
+			return mProfilerOverlayEnabled;
+		}
 	private:
 		void upload_fonts();
 		void construct_render_pass();
+		void draw_profiler_overlay();
 
 		avk::queue* mQueue;
 		avk::descriptor_pool mDescriptorPool;
@@ -171,6 +187,7 @@ namespace avk
 		bool mUsingSemaphoreInsteadOfFenceForFontUpload;
 		bool mOccupyMouse = false;
 		bool mOccupyMouseLastFrame = false;
+		bool mProfilerOverlayEnabled = false;
 
 		// customization
 		std::function<void(float)> mAlterSettingsBeforeInitialization = {};
@@ -0,0 +1,436 @@
+#pragma once
+
+#include "material_image_helpers.hpp"
+#include "parallel_for.hpp"
+
+namespace avk
+{
+	/** Converts a vertex attribute's value from the type it is read from a model in (Source) into
+	 *	the type it is stored in a vertex buffer (Target). By default, the value is converted via
+	 *	static_cast, which covers, e.g., float to double vectors. Specialize this type to support
+	 *	custom target types, which also require an according `avk::format_for` specialization.
+	 */
+	template <typename Source, typename Target>
+	struct vertex_attribute_converter
+	{
+		static Target convert(const Source& aValue) { return static_cast<Target>(aValue); }
+	};
+
+	/** Stores unit vectors, like normals or tangents, in octahedral encoding, e.g. `vertex_attribute::normal<octahedral_2x16>` */
+	template <>
+	struct vertex_attribute_converter<glm::vec3, octahedral_2x16>
+	{
+		static octahedral_2x16 convert(const glm::vec3& aValue) { return pack_octahedral_2x16(aValue); }
+	};
+
+	/** Stores 2D texture coordinates as half precision floats, e.g. `vertex_attribute::texture_coordinates_2d<half_2x16>`.
+	 *	Quantized positions are not supported since they depend on the bounds of all vertices; see `create_quantized_positions_buffer`.
+	 */
+	template <>
+	struct vertex_attribute_converter<glm::vec2, half_2x16>
+	{
+		static half_2x16 convert(const glm::vec2& aValue) { return pack_half_2x16(aValue); }
+	};
+
+	/** Attribute descriptions to be used with `create_interleaved_vertex_buffer`.
+	 *	Each attribute reads one kind of per-vertex data from an aiMesh and stores it as type T
+	 *	in the vertex buffer, using the vk::Format returned by `avk::format_for<T>()`.
+	 *	Like the `model_t::*_for_mesh` functions, attributes which are not present in a mesh are
+	 *	filled with a default value, and a warning is logged.
+	 */
+	namespace vertex_attribute
+	{
+		/** Reads three-component per-vertex data of a mesh, or a fallback value if the mesh doesn't have it. */
+		struct vec3_reader
+		{
+			const aiVector3D* mAiData = nullptr;
+			const glm::vec3* mGlmData = nullptr;
+			glm::vec3 mFallback{ 0.f };
+
+			glm::vec3 read(size_t aVertexIndex) const
+			{
+				if (nullptr != mGlmData) { return mGlmData[aVertexIndex]; }
+				if (nullptr != mAiData) { return glm::vec3{ mAiData[aVertexIndex].x, mAiData[aVertexIndex].y, mAiData[aVertexIndex].z }; }
+				return mFallback;
+			}
+		};
+
+		/** Reads colors of a mesh, or a fallback value if the mesh doesn't have them. */
+		struct vec4_reader
+		{
+			const aiColor4D* mAiData = nullptr;
+			glm::vec4 mFallback{ 0.f };
+
+			glm::vec4 read(size_t aVertexIndex) const
+			{
+				if (nullptr != mAiData) { return glm::vec4{ mAiData[aVertexIndex].r, mAiData[aVertexIndex].g, mAiData[aVertexIndex].b, mAiData[aVertexIndex].a }; }
+				return mFallback;
+			}
+		};
+
+		/** Reads texture coordinates of a mesh, considering the number of uv components of the set. */
+		struct uv_reader
+		{
+			const aiVector3D* mAiData = nullptr;
+			int mNumComponents = 0;
+
+			glm::vec3 read(size_t aVertexIndex) const
+			{
+				if (nullptr == mAiData) { return glm::vec3{ 0.f }; }
+				return glm::vec3{
+					mAiData[aVertexIndex].x,
+					mNumComponents >= 2 ? mAiData[aVertexIndex].y : 0.f,
+					mNumComponents >= 3 ? mAiData[aVertexIndex].z : 0.f
+				};
+			}
+
+			static uv_reader create(const model_t& aModel, mesh_index_t aMeshIndex, int aSet)
+			{
+				assert(aSet >= 0 && aSet < AI_MAX_NUMBER_OF_TEXTURECOORDS);
+				const aiMesh* paiMesh = aModel.handle()->mMeshes[aMeshIndex];
+				if (nullptr == paiMesh->mTextureCoords[aSet]) {
+					LOG_WARNING(std::format("The mesh at index {} does not contain a texture coordinates at index {}. Will return (0,0) for each vertex.", aMeshIndex, aSet));
+					return {};
+				}
+				const auto nuv = aModel.num_uv_components_for_mesh(aMeshIndex, aSet);
+				if (nuv < 1 || nuv > 3) {
+					throw avk::logic_error(std::format("Can't handle a number of {} uv components for mesh at index {}, set {}.", nuv, aMeshIndex, aSet));
+				}
+				return { paiMesh->mTextureCoords[aSet], nuv };
+			}
+		};
+
+		/** Vertex positions */
+		template <typename T = glm::vec3>
+		struct position
+		{
+			using source_type = glm::vec3;
+			using target_type = T;
+			static constexpr avk::content_description sContent = avk::content_description::position;
+
+			static vec3_reader reader_for(const model_t& aModel, mesh_index_t aMeshIndex)
+			{
+				return { aModel.handle()->mMeshes[aMeshIndex]->mVertices };
+			}
+
+			static source_type read(const vec3_reader& aReader, size_t aVertexIndex) { return aReader.read(aVertexIndex); }
+		};
+
+		/** Vertex normals, see `model_t::normals_for_mesh` */
+		template <typename T = glm::vec3>
+		struct normal
+		{
+			using source_type = glm::vec3;
+			using target_type = T;
+			static constexpr avk::content_description sContent = avk::content_description::normal;
+
+			static vec3_reader reader_for(const model_t& aModel, mesh_index_t aMeshIndex)
+			{
+				const aiMesh* paiMesh = aModel.handle()->mMeshes[aMeshIndex];
+				if (nullptr == paiMesh->mNormals) {
+					LOG_WARNING(std::format("The mesh at index {} does not contain normals. Will return (0,0,1) normals for each vertex.", aMeshIndex));
+				}
+				return { paiMesh->mNormals, nullptr, glm::vec3{ 0.f, 0.f, 1.f } };
+			}
+
+			static source_type read(const vec3_reader& aReader, size_t aVertexIndex) { return aReader.read(aVertexIndex); }
+		};
+
+		/** Vertex tangents, see `model_t::tangents_for_mesh` */
+		template <typename T = glm::vec3>
+		struct tangent
+		{
+			using source_type = glm::vec3;
+			using target_type = T;
+			static constexpr avk::content_description sContent = avk::content_description::tangent;
+
+			static vec3_reader reader_for(const model_t& aModel, mesh_index_t aMeshIndex)
+			{
+				if (const auto* calculated = aModel.calculated_tangent_space_for_mesh(aMeshIndex); nullptr != calculated) {
+					return { nullptr, std::get<0>(*calculated).data() };
+				}
+				const aiMesh* paiMesh = aModel.handle()->mMeshes[aMeshIndex];
+				if (nullptr == paiMesh->mTangents) {
+					LOG_WARNING(std::format("The mesh at index {} does not contain tangents. Will return (1,0,0) tangents for each vertex.", aMeshIndex));
+				}
+				return { paiMesh->mTangents, nullptr, glm::vec3{ 1.f, 0.f, 0.f } };
+			}
+
+			static source_type read(const vec3_reader& aReader, size_t aVertexIndex) { return aReader.read(aVertexIndex); }
+		};
+
+		/** Vertex bitangents, see `model_t::bitangents_for_mesh` */
+		template <typename T = glm::vec3>
+		struct bitangent
+		{
+			using source_type = glm::vec3;
+			using target_type = T;
+			static constexpr avk::content_description sContent = avk::content_description::bitangent;
+
+			static vec3_reader reader_for(const model_t& aModel, mesh_index_t aMeshIndex)
+			{
+				if (const auto* calculated = aModel.calculated_tangent_space_for_mesh(aMeshIndex); nullptr != calculated) {
+					return { nullptr, std::get<1>(*calculated).data() };
+				}
+				const aiMesh* paiMesh = aModel.handle()->mMeshes[aMeshIndex];
+				if (nullptr == paiMesh->mBitangents) {
+					LOG_WARNING(std::format("The mesh at index {} does not contain bitangents. Will return (0,1,0) bitangents for each vertex.", aMeshIndex));
+				}
+				return { paiMesh->mBitangents, nullptr, glm::vec3{ 0.f, 1.f, 0.f } };
+			}
+
+			static source_type read(const vec3_reader& aReader, size_t aVertexIndex) { return aReader.read(aVertexIndex); }
+		};
+
+		/** Vertex colors of the given color set, see `model_t::colors_for_mesh` */
+		template <typename T = glm::vec4, int Set = 0>
+		struct color
+		{
+			using source_type = glm::vec4;
+			using target_type = T;
+			static constexpr avk::content_description sContent = avk::content_description::color;
+
+			static vec4_reader reader_for(const model_t& aModel, mesh_index_t aMeshIndex)
+			{
+				static_assert(Set >= 0 && Set < AI_MAX_NUMBER_OF_COLOR_SETS);
+				const aiMesh* paiMesh = aModel.handle()->mMeshes[aMeshIndex];
+				if (nullptr == paiMesh->mColors[Set]) {
+					LOG_WARNING(std::format("The mesh at index {} does not contain a color set at index {}. Will return opaque magenta for each vertex.", aMeshIndex, Set));
+				}
+				return { paiMesh->mColors[Set], glm::vec4{ 1.f, 0.f, 1.f, 1.f } };
+			}
+
+			static source_type read(const vec4_reader& aReader, size_t aVertexIndex) { return aReader.read(aVertexIndex); }
+		};
+
+		/** 2D texture coordinates of the given UV-set, see `model_t::texture_coordinates_for_mesh` */
+		template <typename T = glm::vec2, int Set = 0>
+		struct texture_coordinates_2d
+		{
+			using source_type = glm::vec2;
+			using target_type = T;
+			static constexpr avk::content_description sContent = avk::content_description::texture_coordinate;
+
+			static uv_reader reader_for(const model_t& aModel, mesh_index_t aMeshIndex) { return uv_reader::create(aModel, aMeshIndex, Set); }
+
+			static source_type read(const uv_reader& aReader, size_t aVertexIndex) { return glm::vec2{ aReader.read(aVertexIndex) }; }
+		};
+
+		/** 2D texture coordinates of the given UV-set with flipped y coordinate, see `get_2d_texture_coordinates_flipped` */
+		template <typename T = glm::vec2, int Set = 0>
+		struct texture_coordinates_2d_flipped
+		{
+			using source_type = glm::vec2;
+			using target_type = T;
+			static constexpr avk::content_description sContent = avk::content_description::texture_coordinate;
+
+			static uv_reader reader_for(const model_t& aModel, mesh_index_t aMeshIndex) { return uv_reader::create(aModel, aMeshIndex, Set); }
+
+			static source_type read(const uv_reader& aReader, size_t aVertexIndex)
+			{
+				const auto uv = aReader.read(aVertexIndex);
+				return glm::vec2{ uv.x, 1.0f - uv.y };
+			}
+		};
+
+		/** 3D texture coordinates of the given UV-set, see `model_t::texture_coordinates_for_mesh` */
+		template <typename T = glm::vec3, int Set = 0>
+		struct texture_coordinates_3d
+		{
+			using source_type = glm::vec3;
+			using target_type = T;
+			static constexpr avk::content_description sContent = avk::content_description::texture_coordinate;
+
+			static uv_reader reader_for(const model_t& aModel, mesh_index_t aMeshIndex) { return uv_reader::create(aModel, aMeshIndex, Set); }
+
+			static source_type read(const uv_reader& aReader, size_t aVertexIndex) { return aReader.read(aVertexIndex); }
+		};
+	}
+
+	/** Memory layout of one vertex consisting of the given attributes, stored in the given order without padding
+	 *	between them. The stride is rounded up to a multiple of four bytes.
+	 */
+	template <typename... Attributes>
+	struct interleaved_vertex_layout
+	{
+		static_assert(sizeof...(Attributes) > 0, "At least one vertex attribute is required.");
+
+		static constexpr std::array<size_t, sizeof...(Attributes)> sSizes = { sizeof(typename Attributes::target_type)... };
+
+		static constexpr std::array<size_t, sizeof...(Attributes)> calculate_offsets()
+		{
+			std::array<size_t, sizeof...(Attributes)> offsets{};
+			size_t offset = 0;
+			for (size_t i = 0; i < sizeof...(Attributes); ++i) {
+				offsets[i] = offset;
+				offset += sSizes[i];
+			}
+			return offsets;
+		}
+
+		static constexpr std::array<size_t, sizeof...(Attributes)> sOffsets = calculate_offsets();
+		static constexpr size_t sStride = (sOffsets.back() + sSizes.back() + 3) / 4 * 4;
+
+		/** Creates the vertex buffer meta data, describing every attribute as a member */
+		static avk::vertex_buffer_meta create_meta(size_t aNumVertices)
+		{
+			auto meta = avk::vertex_buffer_meta::create_from_element_size(sStride, aNumVertices);
+			describe_members(meta, std::make_index_sequence<sizeof...(Attributes)>{});
+			return meta;
+		}
+
+		/** Writes the attributes of all vertices of the given mesh in one pass over the vertices
+		 *	@param	aDestination	Memory of `number_of_vertices_for_mesh() * sStride` bytes to write into
+		 */
+		static void write_vertices(const model_t& aModel, mesh_index_t aMeshIndex, std::byte* aDestination)
+		{
+			write_vertices(aModel, aMeshIndex, aDestination, std::make_index_sequence<sizeof...(Attributes)>{});
+		}
+
+	private:
+		template <size_t... Is>
+		static void describe_members(avk::vertex_buffer_meta& aMeta, std::index_sequence<Is...>)
+		{
+			(aMeta.describe_member(sOffsets[Is], avk::format_for<typename Attributes::target_type>(), Attributes::sContent), ...);
+		}
+
+		template <typename Attribute, typename Reader>
+		static void write_attribute(const Reader& aReader, size_t aVertexIndex, std::byte* aDestination)
+		{
+			const auto value = vertex_attribute_converter<typename Attribute::source_type, typename Attribute::target_type>::convert(Attribute::read(aReader, aVertexIndex));
+			static_assert(sizeof(value) == sizeof(typename Attribute::target_type));
+			// Members are not necessarily aligned to their type's alignment within a vertex:
+			std::memcpy(aDestination, &value, sizeof(value));
+		}
+
+		template <size_t... Is>
+		static void write_vertices(const model_t& aModel, mesh_index_t aMeshIndex, std::byte* aDestination, std::index_sequence<Is...>)
+		{
+			const auto readers = std::make_tuple(Attributes::reader_for(aModel, aMeshIndex)...);
+			const auto n = aModel.number_of_vertices_for_mesh(aMeshIndex);
+			for (size_t v = 0; v < n; ++v) {
+				std::byte* vertex = aDestination + v * sStride;
+				(write_attribute<Attributes>(std::get<Is>(readers), v, vertex + sOffsets[Is]), ...);
+			}
+		}
+	};
+
+	/** Creates a host visible staging buffer and fills it with the interleaved vertex data of all the given meshes.
+	 *	The meshes are processed in parallel, each one writing directly into its range of the staging buffer.
+	 *	@return	A tuple containing the staging buffer, and the total number of vertices in it
+	 */
+	template <typename... Attributes>
+	std::tuple<avk::buffer, size_t> create_interleaved_vertex_staging_buffer(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		using layout = interleaved_vertex_layout<Attributes...>;
+
+		// Determine every mesh's first vertex via a prefix sum over the meshes' vertex counts:
+		std::vector<std::tuple<const avk::model_t*, avk::mesh_index_t, size_t>> meshes;
+		size_t numVertices = 0;
+		for (auto& pair : aModelsAndSelectedMeshes) {
+			const auto& modelRef = std::get<const avk::model_t&>(pair);
+			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
+				meshes.emplace_back(&modelRef, meshIndex, numVertices);
+				numVertices += modelRef.number_of_vertices_for_mesh(meshIndex);
+			}
+		}
+
+		auto sb = context().create_buffer(
+			AVK_STAGING_BUFFER_MEMORY_USAGE,
+			vk::BufferUsageFlagBits::eTransferSrc,
+			avk::generic_buffer_meta::create_from_size(numVertices * layout::sStride)
+		);
+
+		{
+			auto mapping = sb->map_memory(avk::mapping_access::write);
+			auto* data = static_cast<std::byte*>(mapping.get());
+			parallel_for(meshes.size(), [&](size_t i) {
+				const auto& [model, meshIndex, firstVertex] = meshes[i];
+				layout::write_vertices(*model, meshIndex, data + firstVertex * layout::sStride);
+			});
+		}
+
+		return std::make_tuple(std::move(sb), numVertices);
+	}
+
+	/**	Create one device buffer which contains the given attributes of all vertices of the given meshes, interleaved.
+	 *	All attributes are gathered in one pass over each mesh's vertices and written straight into one staging buffer,
+	 *	which is copied into the device buffer with one copy command. The resulting buffer's vertex_buffer_meta
+	 *	describes every attribute as a member, with the format given by `avk::format_for` of the attribute's target type.
+	 *
+	 *	Example: `create_interleaved_vertex_buffer<vertex_attribute::position<>, vertex_attribute::normal<>, vertex_attribute::texture_coordinates_2d<>>(modelsAndMeshes)`
+	 *
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aUsageFlags					Additional usage flags that the buffer is created with.
+	 *	@tparam	Attributes					The attributes of one vertex, in the order they are stored in, e.g. `vertex_attribute::position<>`
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the interleaved vertex data. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Attributes>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_interleaved_vertex_buffer(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		using layout = interleaved_vertex_layout<Attributes...>;
+		auto [sb, numVertices] = create_interleaved_vertex_staging_buffer<Attributes...>(aModelsAndSelectedMeshes);
+
+		auto buffer = context().create_buffer(
+			avk::memory_usage::device, aUsageFlags,
+			layout::create_meta(numVertices)
+		);
+
+		auto actionTypeCommand = avk::copy_buffer_to_another(std::move(sb), buffer, 0, 0, numVertices * layout::sStride);
+		return std::make_tuple(std::move(buffer), std::move(actionTypeCommand));
+	}
+
+	/**	Create one device buffer which contains the given attributes of all vertices of the given meshes, interleaved.
+	 *	See `create_interleaved_vertex_buffer`.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *										May be empty if the serializer is in mode deserialize.
+	 *	@param	aUsageFlags					Additional usage flags that the buffer is created with.
+	 *	@tparam	Attributes					The attributes of one vertex, in the order they are stored in, e.g. `vertex_attribute::position<>`
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the interleaved vertex data. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Attributes>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_interleaved_vertex_buffer_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		using layout = interleaved_vertex_layout<Attributes...>;
+		size_t numVertices = 0;
+		size_t stride = layout::sStride;
+
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			auto [sb, numVerticesInBuffer] = create_interleaved_vertex_staging_buffer<Attributes...>(aModelsAndSelectedMeshes);
+			numVertices = numVerticesInBuffer;
+			aSerializer.archive(numVertices);
+			aSerializer.archive(stride);
+			aSerializer.archive_buffer(*sb);
+
+			auto buffer = context().create_buffer(
+				avk::memory_usage::device, aUsageFlags,
+				layout::create_meta(numVertices)
+			);
+
+			auto actionTypeCommand = avk::copy_buffer_to_another(std::move(sb), buffer, 0, 0, numVertices * layout::sStride);
+			return std::make_tuple(std::move(buffer), std::move(actionTypeCommand));
+		}
+		else {
+			aSerializer.archive(numVertices);
+			aSerializer.archive(stride);
+			if (stride != layout::sStride) {
+				throw avk::runtime_error(std::format("The interleaved vertex data in the cache file has a stride of {} bytes, but the requested vertex attributes require a stride of {} bytes.", stride, layout::sStride));
+			}
+
+			auto buffer = context().create_buffer(
+				avk::memory_usage::device, aUsageFlags,
+				layout::create_meta(numVertices)
+			);
+
+			auto actionTypeCommand = fill_device_buffer_from_cache(aSerializer, buffer, numVertices * layout::sStride);
+			return std::make_tuple(std::move(buffer), std::move(actionTypeCommand));
+		}
+	}
+}
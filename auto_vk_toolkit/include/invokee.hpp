@@ -3,6 +3,7 @@
 
 #include "updater.hpp"
 #include "composition_interface.hpp"
+#include "frame_task_access.hpp"
 
 namespace avk
 {
@@ -63,7 +64,35 @@ namespace avk
 		const std::string& name() const { return mName; }
 
 		/** Sets the name of this invokee */
-		void set_name(std::string aName) { mName = std::move(aName); }
+		void set_name(std::string aName)
+		{
+			mName = std::move(aName);
+			mUpdateProfileNameId = cpu_profile_no_name_id;
+			mRenderProfileNameId = cpu_profile_no_name_id;
+		}
+
+		/**	Returns the id of the CPU profiling zone which the invokers record around update(), i.e., "<name>::update".
+		 *	The id is looked up once and cached afterwards. While profiling is disabled, no lookup happens and
+		 *	cpu_profile_no_name_id is returned. Must only be called by whoever invokes update().
+		 */
+		uint32_t update_profile_name_id()
+		{
+			if (cpu_profile_no_name_id == mUpdateProfileNameId && is_cpu_profiling_enabled()) {
+				mUpdateProfileNameId = cpu_profile_name_id(mName, "::update");
+			}
+			return mUpdateProfileNameId;
+		}
+
+		/**	Returns the id of the CPU profiling zone which the invokers record around render(), i.e., "<name>::render".
+		 *	Same as update_profile_name_id, but must only be called by whoever invokes render().
+		 */
+		uint32_t render_profile_name_id()
+		{
+			if (cpu_profile_no_name_id == mRenderProfileNameId && is_cpu_profiling_enabled()) {
+				mRenderProfileNameId = cpu_profile_name_id(mName, "::render");
+			}
+			return mRenderProfileNameId;
+		}
 
 		/** Returns the desired execution order of this invokee w.r.t. the default time 0.
 		 *	invokees with negative execution orders will get their initialize-, update-,
@@ -72,6 +101,19 @@ namespace avk
 		 */
 		virtual int execution_order() const { return 0; }
 
+		/**	Declares which resources update() reads and writes. A task_graph_invoker uses this information to invoke
+		 *	update() concurrently with the update() and render() methods of other invokees which access different
+		 *	resources, on any thread. If nothing is declared (default), update() is assumed to access anything, and it is
+		 *	invoked on the composition's thread. Reading the current input buffer should be declared via
+		 *	task_graph_invoker::sInputResource, and accessing windows via task_graph_invoker::sWindowsResource.
+		 */
+		virtual void declare_update_access(frame_task_access& aAccess) const {}
+
+		/**	Declares which resources render() reads and writes, see declare_update_access.
+		 *	render() methods are always invoked one after the other on the composition's thread.
+		 */
+		virtual void declare_render_access(frame_task_access& aAccess) const {}
+
 		/**	@brief Initialize this invokee
 		 *
 		 *	This is the first method in the lifecycle of a invokee,
@@ -252,6 +294,9 @@ namespace avk
 	private:
 		inline static int32_t sGeneratedNameId = 0;
 		std::string mName;
+		// Cached separately, because update() and render() of one invokee may be invoked by different threads:
+		uint32_t mUpdateProfileNameId = cpu_profile_no_name_id;
+		uint32_t mRenderProfileNameId = cpu_profile_no_name_id;
 		bool mWasEnabledLastFrame;
 		bool mEnabled;
 		bool mRenderEnabled;
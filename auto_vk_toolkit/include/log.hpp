@@ -40,113 +40,210 @@ namespace avk
 		important
 	};
 
+	/** The compile-time constant parts of a log message, one per invocation of a LOG_* macro */
+	struct log_site
+	{
+		std::string_view mPrefix;
+		std::string_view mFile;		// Empty for the ___ variants of the LOG_* macros
+		int mLine;
+		log_type mLogType;
+		log_importance mLogImportance;
+	};
+
 	struct log_pack
 	{
 		std::string mMessage;
 		log_type mLogType;
 		log_importance mLogImportance;
 		std::string mStacktrace;
+		// Only set for messages whose formatting has been deferred (see dispatch_log_deferred), in which case
+		// mMessage stays empty until the message is formatted on the logger thread, or by a log_sink:
+		const log_site* mSite = nullptr;
+		std::string_view mFormat;
+		std::string mArguments;
 	};
+
+	/** Returns the part of the given path after the last slash or backslash, at compile time if possible. */
+	constexpr std::string_view log_file_name(std::string_view aPath)
+	{
+		const auto pos = aPath.find_last_of("/\\");
+		return std::string_view::npos == pos ? aPath : aPath.substr(pos + 1);
+	}
 	
 	extern void set_console_output_color(avk::log_type level, avk::log_importance importance);
 	extern void set_console_output_color_for_stacktrace(avk::log_type level, avk::log_importance importance);
 	extern void reset_console_output_color();
 	extern void dispatch_log(avk::log_pack pToBeLogged);
-	
+	/**	Dispatches a message whose arguments have been encoded via encode_log_argument, without formatting it.
+	 *	@param	aSite			The call site, which must outlive the logger thread, i.e., have static storage duration
+	 *	@param	aFormat			The format string, which must have static storage duration
+	 *	@param	aArguments		The encoded arguments
+	 */
+	extern void dispatch_log(const avk::log_site& aSite, std::string_view aFormat, std::string_view aArguments);
+
+	// All LOG_* macros store their site's constant parts in a static constexpr log_site, and hand the
+	// format string and the arguments to dispatch_log_deferred (see deferred_log.hpp):
+	#define AVK_DISPATCH_LOG(prefix, type, importance, withFile, ...) [&]() { \
+		static constexpr avk::log_site sLogSite{ prefix, withFile ? avk::log_file_name(__FILE__) : std::string_view{}, __LINE__, type, importance }; \
+		avk::dispatch_log_deferred(sLogSite, __VA_ARGS__); \
+	}()
+
+	// Number of messages which can be queued for the logger thread (if LOGGING_ON_SEPARATE_THREAD is defined).
+	// All slots are allocated when the first message is logged.
+	#if !defined(LOG_QUEUE_CAPACITY)
+	#define LOG_QUEUE_CAPACITY 1024
+	#endif
+
+	// What happens to a message if the logger thread's queue is full:
+	enum struct log_queue_full_policy
+	{
+		drop,	// The message is discarded silently
+		block,	// The logging thread waits until the logger thread has made room for it
+		count	// The message is discarded, and the logger thread reports the number of discarded messages
+	};
+
+	class log_sink;
+
+	/** Replaces all sinks which log messages are written to. By default, there is one console_log_sink. */
+	extern void set_log_sinks(std::vector<std::shared_ptr<avk::log_sink>> aSinks);
+	/** Adds a sink which log messages are written to, in addition to the existing ones. */
+	extern void add_log_sink(std::shared_ptr<avk::log_sink> aSink);
+	/** Sets what happens if the logger thread's queue is full. The default is log_queue_full_policy::block. */
+	extern void set_log_queue_full_policy(avk::log_queue_full_policy aPolicy);
+	/** The number of messages which have been discarded so far, because the logger thread's queue was full. */
+	extern uint64_t number_of_dropped_log_messages();
+	/** Waits until all messages which have been logged before have been written to the sinks, and flushes the sinks. */
+	extern void flush_log();
+
+	// The _F variants of the LOG_* macros take a format string and its arguments, e.g., LOG_INFO_F("{} of {}", i, n).
+	// Arithmetic, string, and void-pointer arguments are copied as they are, and only formatted on the logger thread,
+	// or by a log_sink. Messages with arguments of other types are formatted on the calling thread.
 	#if LOG_LEVEL > 0
-	#define LOG_ERROR(msg)			avk::dispatch_log(avk::log_pack{ std::format("{}{}{}\n", "ERR:  ", msg, std::format(" | file[{}] line[{}]", avk::extract_file_name(std::string(__FILE__)), __LINE__)), avk::log_type::error, avk::log_importance::normal })
-	#define LOG_ERROR_EM(msg)		avk::dispatch_log(avk::log_pack{ std::format("{}{}{}\n", "ERR:  ", msg, std::format(" | file[{}] line[{}]", avk::extract_file_name(std::string(__FILE__)), __LINE__)), avk::log_type::error, avk::log_importance::important})
-	#define LOG_ERROR___(msg)		avk::dispatch_log(avk::log_pack{ std::format("{}{}\n", "ERR:  ", msg), avk::log_type::error, avk::log_importance::normal })
-	#define LOG_ERROR_EM___(msg)	avk::dispatch_log(avk::log_pack{ std::format("{}{}\n", "ERR:  ", msg), avk::log_type::error, avk::log_importance::important })
+	#define LOG_ERROR(msg)			AVK_DISPATCH_LOG("ERR:  ", avk::log_type::error, avk::log_importance::normal, true, "{}", msg)
+	#define LOG_ERROR_EM(msg)		AVK_DISPATCH_LOG("ERR:  ", avk::log_type::error, avk::log_importance::important, true, "{}", msg)
+	#define LOG_ERROR___(msg)		AVK_DISPATCH_LOG("ERR:  ", avk::log_type::error, avk::log_importance::normal, false, "{}", msg)
+	#define LOG_ERROR_EM___(msg)	AVK_DISPATCH_LOG("ERR:  ", avk::log_type::error, avk::log_importance::important, false, "{}", msg)
+	#define LOG_ERROR_F(...)		AVK_DISPATCH_LOG("ERR:  ", avk::log_type::error, avk::log_importance::normal, true, __VA_ARGS__)
+	#define LOG_ERROR_EM_F(...)	AVK_DISPATCH_LOG("ERR:  ", avk::log_type::error, avk::log_importance::important, true, __VA_ARGS__)
 	#else
 	#define LOG_ERROR(msg)
 	#define LOG_ERROR_EM(msg)
 	#define LOG_ERROR___(msg)
 	#define LOG_ERROR_EM___(msg)
+	#define LOG_ERROR_F(...)
+	#define LOG_ERROR_EM_F(...)
 	#endif
 
 	#if LOG_LEVEL > 1
-	#define LOG_WARNING(msg)		avk::dispatch_log(avk::log_pack{ std::format("{}{}{}\n", "WARN: ", msg, std::format(" | file[{}] line[{}]", avk::extract_file_name(std::string(__FILE__)), __LINE__)), avk::log_type::warning, avk::log_importance::normal })
-	#define LOG_WARNING_EM(msg)		avk::dispatch_log(avk::log_pack{ std::format("{}{}{}\n", "WARN: ", msg, std::format(" | file[{}] line[{}]", avk::extract_file_name(std::string(__FILE__)), __LINE__)), avk::log_type::warning, avk::log_importance::important })
-	#define LOG_WARNING___(msg)		avk::dispatch_log(avk::log_pack{ std::format("{}{}\n", "WARN: ", msg), avk::log_type::warning, avk::log_importance::normal })
-	#define LOG_WARNING_EM___(msg)	avk::dispatch_log(avk::log_pack{ std::format("{}{}\n", "WARN: ", msg), avk::log_type::warning, avk::log_importance::important })
+	#define LOG_WARNING(msg)		AVK_DISPATCH_LOG("WARN: ", avk::log_type::warning, avk::log_importance::normal, true, "{}", msg)
+	#define LOG_WARNING_EM(msg)		AVK_DISPATCH_LOG("WARN: ", avk::log_type::warning, avk::log_importance::important, true, "{}", msg)
+	#define LOG_WARNING___(msg)		AVK_DISPATCH_LOG("WARN: ", avk::log_type::warning, avk::log_importance::normal, false, "{}", msg)
+	#define LOG_WARNING_EM___(msg)	AVK_DISPATCH_LOG("WARN: ", avk::log_type::warning, avk::log_importance::important, false, "{}", msg)
+	#define LOG_WARNING_F(...)		AVK_DISPATCH_LOG("WARN: ", avk::log_type::warning, avk::log_importance::normal, true, __VA_ARGS__)
+	#define LOG_WARNING_EM_F(...)	AVK_DISPATCH_LOG("WARN: ", avk::log_type::warning, avk::log_importance::important, true, __VA_ARGS__)
 	#else 
 	#define LOG_WARNING(msg)
 	#define LOG_WARNING_EM(msg)
 	#define LOG_WARNING___(msg)
 	#define LOG_WARNING_EM___(msg)
+	#define LOG_WARNING_F(...)
+	#define LOG_WARNING_EM_F(...)
 	#endif
 
 	#if LOG_LEVEL > 2
-	#define LOG_INFO(msg)			avk::dispatch_log(avk::log_pack{ std::format("{}{}{}\n", "INFO: ", msg, std::format(" | file[{}] line[{}]", avk::extract_file_name(std::string(__FILE__)), __LINE__)), avk::log_type::info, avk::log_importance::normal })
-	#define LOG_INFO_EM(msg)		avk::dispatch_log(avk::log_pack{ std::format("{}{}{}\n", "INFO: ", msg, std::format(" | file[{}] line[{}]", avk::extract_file_name(std::string(__FILE__)), __LINE__)), avk::log_type::info, avk::log_importance::important })
-	#define LOG_INFO___(msg)		avk::dispatch_log(avk::log_pack{ std::format("{}{}\n", "INFO: ", msg), avk::log_type::info, avk::log_importance::normal })
-	#define LOG_INFO_EM___(msg)		avk::dispatch_log(avk::log_pack{ std::format("{}{}\n", "INFO: ", msg), avk::log_type::info, avk::log_importance::important })
+	#define LOG_INFO(msg)			AVK_DISPATCH_LOG("INFO: ", avk::log_type::info, avk::log_importance::normal, true, "{}", msg)
+	#define LOG_INFO_EM(msg)		AVK_DISPATCH_LOG("INFO: ", avk::log_type::info, avk::log_importance::important, true, "{}", msg)
+	#define LOG_INFO___(msg)		AVK_DISPATCH_LOG("INFO: ", avk::log_type::info, avk::log_importance::normal, false, "{}", msg)
+	#define LOG_INFO_EM___(msg)		AVK_DISPATCH_LOG("INFO: ", avk::log_type::info, avk::log_importance::important, false, "{}", msg)
+	#define LOG_INFO_F(...)		AVK_DISPATCH_LOG("INFO: ", avk::log_type::info, avk::log_importance::normal, true, __VA_ARGS__)
+	#define LOG_INFO_EM_F(...)	AVK_DISPATCH_LOG("INFO: ", avk::log_type::info, avk::log_importance::important, true, __VA_ARGS__)
 	#else
 	#define LOG_INFO(msg)
 	#define LOG_INFO_EM(msg)
 	#define LOG_INFO___(msg)
 	#define LOG_INFO_EM___(msg)
+	#define LOG_INFO_F(...)
+	#define LOG_INFO_EM_F(...)
 	#endif
 
 	#if LOG_LEVEL > 3
-	#define LOG_VERBOSE(msg)		avk::dispatch_log(avk::log_pack{ std::format("{}{}{}\n", "VRBS: ", msg, std::format(" | file[{}] line[{}]", avk::extract_file_name(std::string(__FILE__)), __LINE__)), avk::log_type::verbose, avk::log_importance::normal })
-	#define LOG_VERBOSE_EM(msg)		avk::dispatch_log(avk::log_pack{ std::format("{}{}{}\n", "VRBS: ", msg, std::format(" | file[{}] line[{}]", avk::extract_file_name(std::string(__FILE__)), __LINE__)), avk::log_type::verbose, avk::log_importance::important })
-	#define LOG_VERBOSE___(msg)		avk::dispatch_log(avk::log_pack{ std::format("{}{}\n", "VRBS: ", msg), avk::log_type::verbose, avk::log_importance::normal })
-	#define LOG_VERBOSE_EM___(msg)	avk::dispatch_log(avk::log_pack{ std::format("{}{}\n", "VRBS: ", msg), avk::log_type::verbose, avk::log_importance::important })
+	#define LOG_VERBOSE(msg)		AVK_DISPATCH_LOG("VRBS: ", avk::log_type::verbose, avk::log_importance::normal, true, "{}", msg)
+	#define LOG_VERBOSE_EM(msg)		AVK_DISPATCH_LOG("VRBS: ", avk::log_type::verbose, avk::log_importance::important, true, "{}", msg)
+	#define LOG_VERBOSE___(msg)		AVK_DISPATCH_LOG("VRBS: ", avk::log_type::verbose, avk::log_importance::normal, false, "{}", msg)
+	#define LOG_VERBOSE_EM___(msg)	AVK_DISPATCH_LOG("VRBS: ", avk::log_type::verbose, avk::log_importance::important, false, "{}", msg)
+	#define LOG_VERBOSE_F(...)		AVK_DISPATCH_LOG("VRBS: ", avk::log_type::verbose, avk::log_importance::normal, true, __VA_ARGS__)
+	#define LOG_VERBOSE_EM_F(...)	AVK_DISPATCH_LOG("VRBS: ", avk::log_type::verbose, avk::log_importance::important, true, __VA_ARGS__)
 	#else 
 	#define LOG_VERBOSE(msg)
 	#define LOG_VERBOSE_EM(msg)
 	#define LOG_VERBOSE___(msg)
 	#define LOG_VERBOSE_EM___(msg)
+	#define LOG_VERBOSE_F(...)
+	#define LOG_VERBOSE_EM_F(...)
 	#endif
 
 	#if LOG_LEVEL > 4
-	#define LOG_MEGA_VERBOSE(msg)		avk::dispatch_log(avk::log_pack{ std::format("{}{}{}\n", "MVRBS:", msg, std::format(" | file[{}] line[{}]", avk::extract_file_name(std::string(__FILE__)), __LINE__)), avk::log_type::verbose, avk::log_importance::normal })
-	#define LOG_MEGA_VERBOSE_EM(msg)	avk::dispatch_log(avk::log_pack{ std::format("{}{}{}\n", "MVRBS:", msg, std::format(" | file[{}] line[{}]", avk::extract_file_name(std::string(__FILE__)), __LINE__)), avk::log_type::verbose, avk::log_importance::important })
-	#define LOG_MEGA_VERBOSE___(msg)	avk::dispatch_log(avk::log_pack{ std::format("{}{}\n", "MVRBS:", msg), avk::log_type::verbose, avk::log_importance::normal })
-	#define LOG_MEGA_VERBOSE_EM___(msg)	avk::dispatch_log(avk::log_pack{ std::format("{}{}\n", "MVRBS:", msg), avk::log_type::verbose, avk::log_importance::important })
+	#define LOG_MEGA_VERBOSE(msg)		AVK_DISPATCH_LOG("MVRBS:", avk::log_type::verbose, avk::log_importance::normal, true, "{}", msg)
+	#define LOG_MEGA_VERBOSE_EM(msg)	AVK_DISPATCH_LOG("MVRBS:", avk::log_type::verbose, avk::log_importance::important, true, "{}", msg)
+	#define LOG_MEGA_VERBOSE___(msg)	AVK_DISPATCH_LOG("MVRBS:", avk::log_type::verbose, avk::log_importance::normal, false, "{}", msg)
+	#define LOG_MEGA_VERBOSE_EM___(msg)	AVK_DISPATCH_LOG("MVRBS:", avk::log_type::verbose, avk::log_importance::important, false, "{}", msg)
+	#define LOG_MEGA_VERBOSE_F(...)		AVK_DISPATCH_LOG("MVRBS:", avk::log_type::verbose, avk::log_importance::normal, true, __VA_ARGS__)
+	#define LOG_MEGA_VERBOSE_EM_F(...)	AVK_DISPATCH_LOG("MVRBS:", avk::log_type::verbose, avk::log_importance::important, true, __VA_ARGS__)
 	#else 
 	#define LOG_MEGA_VERBOSE(msg)
 	#define LOG_MEGA_VERBOSE_EM(msg)
 	#define LOG_MEGA_VERBOSE___(msg)
 	#define LOG_MEGA_VERBOSE_EM___(msg)
+	#define LOG_MEGA_VERBOSE_F(...)
+	#define LOG_MEGA_VERBOSE_EM_F(...)
 	#endif
 
 	#if defined(_DEBUG)
-	#define LOG_DEBUG(msg)			avk::dispatch_log(avk::log_pack{ std::format("{}{}{}\n", "DBG:  ", msg, std::format(" | file[{}] line[{}]", avk::extract_file_name(std::string(__FILE__)), __LINE__)), avk::log_type::debug, avk::log_importance::normal })
-	#define LOG_DEBUG_EM(msg)		avk::dispatch_log(avk::log_pack{ std::format("{}{}{}\n", "DBG:  ", msg, std::format(" | file[{}] line[{}]", avk::extract_file_name(std::string(__FILE__)), __LINE__)), avk::log_type::debug, avk::log_importance::important })
-	#define LOG_DEBUG___(msg)		avk::dispatch_log(avk::log_pack{ std::format("{}{}\n", "DBG:  ", msg), avk::log_type::debug, avk::log_importance::normal })
-	#define LOG_DEBUG_EM___(msg)	avk::dispatch_log(avk::log_pack{ std::format("{}{}\n", "DBG:  ", msg), avk::log_type::debug, avk::log_importance::important })
+	#define LOG_DEBUG(msg)			AVK_DISPATCH_LOG("DBG:  ", avk::log_type::debug, avk::log_importance::normal, true, "{}", msg)
+	#define LOG_DEBUG_EM(msg)		AVK_DISPATCH_LOG("DBG:  ", avk::log_type::debug, avk::log_importance::important, true, "{}", msg)
+	#define LOG_DEBUG___(msg)		AVK_DISPATCH_LOG("DBG:  ", avk::log_type::debug, avk::log_importance::normal, false, "{}", msg)
+	#define LOG_DEBUG_EM___(msg)	AVK_DISPATCH_LOG("DBG:  ", avk::log_type::debug, avk::log_importance::important, false, "{}", msg)
+	#define LOG_DEBUG_F(...)		AVK_DISPATCH_LOG("DBG:  ", avk::log_type::debug, avk::log_importance::normal, true, __VA_ARGS__)
+	#define LOG_DEBUG_EM_F(...)	AVK_DISPATCH_LOG("DBG:  ", avk::log_type::debug, avk::log_importance::important, true, __VA_ARGS__)
 	#else
 	#define LOG_DEBUG(msg)
 	#define LOG_DEBUG_EM(msg)
 	#define LOG_DEBUG___(msg)
 	#define LOG_DEBUG_EM___(msg)	
+	#define LOG_DEBUG_F(...)
+	#define LOG_DEBUG_EM_F(...)
 	#endif
 
 	#if defined(_DEBUG) && LOG_LEVEL > 3
-	#define LOG_DEBUG_VERBOSE(msg)			avk::dispatch_log(avk::log_pack{ std::format("{}{}{}\n", "DBG-V:", msg, std::format(" | file[{}] line[{}]", avk::extract_file_name(std::string(__FILE__)), __LINE__)), avk::log_type::debug_verbose, avk::log_importance::normal })
-	#define LOG_DEBUG_VERBOSE_EM(msg)		avk::dispatch_log(avk::log_pack{ std::format("{}{}{}\n", "DBG-V:", msg, std::format(" | file[{}] line[{}]", avk::extract_file_name(std::string(__FILE__)), __LINE__)), avk::log_type::debug_verbose, avk::log_importance::important })
-	#define LOG_DEBUG_VERBOSE___(msg)		avk::dispatch_log(avk::log_pack{ std::format("{}{}\n", "DBG-V:", msg), avk::log_type::debug_verbose, avk::log_importance::normal })
-	#define LOG_DEBUG_VERBOSE_EM___(msg)	avk::dispatch_log(avk::log_pack{ std::format("{}{}\n", "DBG-V:", msg), avk::log_type::debug_verbose, avk::log_importance::important })
+	#define LOG_DEBUG_VERBOSE(msg)			AVK_DISPATCH_LOG("DBG-V:", avk::log_type::debug_verbose, avk::log_importance::normal, true, "{}", msg)
+	#define LOG_DEBUG_VERBOSE_EM(msg)		AVK_DISPATCH_LOG("DBG-V:", avk::log_type::debug_verbose, avk::log_importance::important, true, "{}", msg)
+	#define LOG_DEBUG_VERBOSE___(msg)		AVK_DISPATCH_LOG("DBG-V:", avk::log_type::debug_verbose, avk::log_importance::normal, false, "{}", msg)
+	#define LOG_DEBUG_VERBOSE_EM___(msg)	AVK_DISPATCH_LOG("DBG-V:", avk::log_type::debug_verbose, avk::log_importance::important, false, "{}", msg)
+	#define LOG_DEBUG_VERBOSE_F(...)		AVK_DISPATCH_LOG("DBG-V:", avk::log_type::debug_verbose, avk::log_importance::normal, true, __VA_ARGS__)
+	#define LOG_DEBUG_VERBOSE_EM_F(...)	AVK_DISPATCH_LOG("DBG-V:", avk::log_type::debug_verbose, avk::log_importance::important, true, __VA_ARGS__)
 	#else
 	#define LOG_DEBUG_VERBOSE(msg)
 	#define LOG_DEBUG_VERBOSE_EM(msg)   
 	#define LOG_DEBUG_VERBOSE___(msg)
 	#define LOG_DEBUG_VERBOSE_EM___(msg)
+	#define LOG_DEBUG_VERBOSE_F(...)
+	#define LOG_DEBUG_VERBOSE_EM_F(...)
 	#endif
 
 	#if defined(_DEBUG) && LOG_LEVEL > 4
-	#define LOG_DEBUG_MEGA_VERBOSE(msg)			avk::dispatch_log(avk::log_pack{ std::format("{}{}{}\n", "DBG-MV:", msg, std::format(" | file[{}] line[{}]", avk::extract_file_name(std::string(__FILE__)), __LINE__)), avk::log_type::debug_verbose, avk::log_importance::normal })
-	#define LOG_DEBUG_MEGA_VERBOSE_EM(msg)		avk::dispatch_log(avk::log_pack{ std::format("{}{}{}\n", "DBG-MV:", msg, std::format(" | file[{}] line[{}]", avk::extract_file_name(std::string(__FILE__)), __LINE__)), avk::log_type::debug_verbose, avk::log_importance::important })
-	#define LOG_DEBUG_MEGA_VERBOSE___(msg)		avk::dispatch_log(avk::log_pack{ std::format("{}{}\n", "DBG-MV:", msg), avk::log_type::debug_verbose, avk::log_importance::normal })
-	#define LOG_DEBUG_MEGA_VERBOSE_EM___(msg)	avk::dispatch_log(avk::log_pack{ std::format("{}{}\n", "DBG-MV:", msg), avk::log_type::debug_verbose, avk::log_importance::important })
+	#define LOG_DEBUG_MEGA_VERBOSE(msg)			AVK_DISPATCH_LOG("DBG-MV:", avk::log_type::debug_verbose, avk::log_importance::normal, true, "{}", msg)
+	#define LOG_DEBUG_MEGA_VERBOSE_EM(msg)		AVK_DISPATCH_LOG("DBG-MV:", avk::log_type::debug_verbose, avk::log_importance::important, true, "{}", msg)
+	#define LOG_DEBUG_MEGA_VERBOSE___(msg)		AVK_DISPATCH_LOG("DBG-MV:", avk::log_type::debug_verbose, avk::log_importance::normal, false, "{}", msg)
+	#define LOG_DEBUG_MEGA_VERBOSE_EM___(msg)	AVK_DISPATCH_LOG("DBG-MV:", avk::log_type::debug_verbose, avk::log_importance::important, false, "{}", msg)
+	#define LOG_DEBUG_MEGA_VERBOSE_F(...)		AVK_DISPATCH_LOG("DBG-MV:", avk::log_type::debug_verbose, avk::log_importance::normal, true, __VA_ARGS__)
+	#define LOG_DEBUG_MEGA_VERBOSE_EM_F(...)	AVK_DISPATCH_LOG("DBG-MV:", avk::log_type::debug_verbose, avk::log_importance::important, true, __VA_ARGS__)
 	#else
 	#define LOG_DEBUG_MEGA_VERBOSE(msg)
 	#define LOG_DEBUG_MEGA_VERBOSE_EM(msg)   
 	#define LOG_DEBUG_MEGA_VERBOSE___(msg)
 	#define LOG_DEBUG_MEGA_VERBOSE_EM___(msg)
+	#define LOG_DEBUG_MEGA_VERBOSE_F(...)
+	#define LOG_DEBUG_MEGA_VERBOSE_EM_F(...)
 	#endif
 
 	std::string to_string(const glm::mat4&);
@@ -0,0 +1,71 @@
+#pragma once
+
+namespace avk
+{
+	/**	A bounded, lock-free queue of log messages for multiple producers and a single consumer.
+	 *
+	 *	All slots are allocated upfront, and each slot's strings reserve a given length, so that pushing
+	 *	a message does not allocate unless it is longer than that. Producers claim slots via an atomic
+	 *	counter and publish them via per-slot sequence numbers; the consumer swaps the contents of
+	 *	published slots into a batch, which hands the batch's (previously reserved) strings back to the slots.
+	 */
+	class log_queue
+	{
+	public:
+		/**	Allocates the slots.
+		 *	@param	aCapacity					Number of slots, rounded up to the next power of two
+		 *	@param	aReservedMessageLength		Number of characters which each slot reserves for the message, and for encoded arguments
+		 */
+		explicit log_queue(size_t aCapacity = 1024, size_t aReservedMessageLength = 256);
+		log_queue(log_queue&&) noexcept = delete;
+		log_queue(const log_queue&) = delete;
+		log_queue& operator=(log_queue&&) noexcept = delete;
+		log_queue& operator=(const log_queue&) = delete;
+		~log_queue() = default;
+
+		/**	Copies the given message into a free slot. May be invoked concurrently from any number of threads.
+		 *	@return	false if the queue is full, in which case the message has not been enqueued.
+		 */
+		bool try_push(const log_pack& aMessage);
+
+		/**	Copies a message whose formatting has been deferred into a free slot (see log_pack::mSite).
+		 *	May be invoked concurrently from any number of threads.
+		 *	@return	false if the queue is full, in which case the message has not been enqueued.
+		 */
+		bool try_push(const log_site& aSite, std::string_view aFormat, std::string_view aArguments, std::string_view aStacktrace);
+
+		/**	Swaps enqueued messages into the first elements of aBatch, in the order in which they have been pushed.
+		 *	The previous contents of these elements are handed to the slots, which reuse their strings.
+		 *	Must only be invoked by one thread at a time.
+		 *	@param	aBatch		Receives up to aBatch.size() messages
+		 *	@return	The number of messages which have been taken
+		 */
+		size_t pop_batch(std::span<log_pack> aBatch);
+
+		/**	True if the consumer would not find a message to pop. Must only be invoked by the consumer.
+		 *	A message which is being pushed concurrently may or may not be seen.
+		 */
+		bool empty() const;
+
+		/** The number of slots */
+		size_t capacity() const { return mMask + 1; }
+
+	private:
+		/** Claims a free slot, and returns its position, or std::nullopt if the queue is full */
+		std::optional<size_t> claim();
+		/** Hands the slot at the given, claimed position to the consumer */
+		void publish(size_t aPosition);
+
+		struct slot
+		{
+			std::atomic<size_t> mSequence;
+			log_pack mMessage;
+		};
+
+		std::unique_ptr<slot[]> mSlots;
+		size_t mMask;
+		size_t mReservedMessageLength;
+		alignas(64) std::atomic<size_t> mEnqueuePosition{ 0 };
+		alignas(64) size_t mDequeuePosition = 0;
+	};
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+namespace avk
+{
+	/**	A destination for log messages. Messages are handed over in batches, either by the logger thread
+	 *	(if LOGGING_ON_SEPARATE_THREAD is defined) or by the logging thread itself. Calls to write and flush
+	 *	are never made concurrently for the same sink. Register sinks via add_log_sink or set_log_sinks.
+	 */
+	class log_sink
+	{
+	public:
+		virtual ~log_sink() = default;
+
+		/**	Writes a batch of messages, in the order in which they have been logged.
+		 *	@param	aMessages		The messages. They are only valid during this call.
+		 */
+		virtual void write(std::span<const log_pack> aMessages) = 0;
+
+		/** Flushes messages which have been written, but which have been buffered by the sink. */
+		virtual void flush() {}
+	};
+
+	/**	Writes log messages to std::cout, with colors depending on the messages' type and importance.
+	 *	The stream is flushed once per batch. This is the sink which is used if no sinks have been set.
+	 */
+	class console_log_sink : public log_sink
+	{
+	public:
+		void write(std::span<const log_pack> aMessages) override;
+		void flush() override;
+	};
+
+	/**	Writes log messages to a file. Whenever the file would exceed the given size, it is renamed to
+	 *	<path>.1 (the previous <path>.1 is renamed to <path>.2, and so on) and a new file is started.
+	 */
+	class rotating_file_log_sink : public log_sink
+	{
+	public:
+		/**	Opens the log file, and truncates it.
+		 *	@param	aPath			Path to the log file
+		 *	@param	aMaxFileSize	Maximum size of one file in bytes. A single message which is larger than that is still written.
+		 *	@param	aMaxNumFiles	Maximum number of files, including the current one. Older files are deleted.
+		 */
+		rotating_file_log_sink(std::filesystem::path aPath, size_t aMaxFileSize = 8 * 1024 * 1024, size_t aMaxNumFiles = 3);
+
+		void write(std::span<const log_pack> aMessages) override;
+		void flush() override;
+
+	private:
+		void rotate();
+
+		std::filesystem::path mPath;
+		size_t mMaxFileSize;
+		size_t mMaxNumFiles;
+		std::ofstream mFile;
+		size_t mCurrentFileSize = 0;
+	};
+
+	/**	Writes log messages to a binary file, without formatting those whose formatting has been deferred (see
+	 *	dispatch_log_deferred): Each call site is written once, and each such message only consists of its
+	 *	site's index and its encoded arguments. Use binary_log_sink::read to format the messages of such a file.
+	 *	All values are written in the native byte order.
+	 */
+	class binary_log_sink : public log_sink
+	{
+	public:
+		/**	Creates the file, or truncates it.
+		 *	@param	aPath			Path to the log file
+		 */
+		explicit binary_log_sink(std::filesystem::path aPath);
+
+		void write(std::span<const log_pack> aMessages) override;
+		void flush() override;
+
+		/**	Reads all messages from a file which has been written by a binary_log_sink, and formats them.
+		 *	@param	aPath			Path to the log file
+		 *	@return	The messages, whose mSite members are nullptr
+		 */
+		static std::vector<log_pack> read(const std::filesystem::path& aPath);
+
+	private:
+		void write_string(std::string_view aString);
+
+		std::ofstream mFile;
+		std::map<std::tuple<const log_site*, const char*>, uint32_t> mSiteIndices;
+	};
+
+	/**	Keeps the most recent log messages in memory, e.g., for tests or for displaying them in a UI.
+	 *	Unlike the other sinks, it may be queried concurrently to being written to.
+	 */
+	class memory_log_sink : public log_sink
+	{
+	public:
+		/**	@param	aCapacity		The maximum number of messages which are kept. Older ones are overwritten.
+		 */
+		explicit memory_log_sink(size_t aCapacity = 1024);
+
+		void write(std::span<const log_pack> aMessages) override;
+
+		/** The kept messages, from the oldest to the most recent one */
+		std::vector<log_pack> messages() const;
+
+		/** The number of messages which have been written to this sink in total, including overwritten ones */
+		size_t total_number_of_messages() const;
+
+		/** Removes all kept messages */
+		void clear();
+
+	private:
+		mutable std::mutex mMutex;
+		std::vector<log_pack> mRing;
+		size_t mCapacity;
+		size_t mTotal = 0;
+	};
+}
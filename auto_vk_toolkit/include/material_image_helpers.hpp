@@ -5,6 +5,7 @@
 #include "model.hpp"
 #include "serializer.hpp"
 #include "context_vulkan.hpp"
+#include "parallel_for.hpp"
 
 namespace avk
 {
@@ -447,6 +448,7 @@ namespace avk
 	}
 
 	/** Helper function to fill a given device buffer with a staging buffer whose contents are loaded from a cache file.
+	 *	If the cache file is memory mapped, the staging buffer is filled straight from the mapped pages.
 	 *	@param	aSerializer		The serializer in avk::serializer::mode::deserialize
 	 *	@param  aQueue			The queue to submit the commands to
 	 *	@param	aDeviceBuffer	The target buffer
@@ -463,8 +465,16 @@ namespace avk
 			avk::generic_buffer_meta::create_from_size(aTotalSize)
 		);
 
-		// Let the serializer map and fill the buffer
-		aSerializer.archive_buffer(*sb);
+		if (aSerializer.is_memory_mapped()) {
+			// Copy from the mapped cache file into the staging buffer, without going through the archive:
+			const auto data = aSerializer.view_memory(aTotalSize);
+			auto mapping = sb->map_memory(avk::mapping_access::write);
+			std::memcpy(mapping.get(), data.data(), aTotalSize);
+		}
+		else {
+			// Let the serializer map and fill the buffer
+			aSerializer.archive_buffer(*sb);
+		}
 		
 		auto actionTypeCommand = avk::copy_buffer_to_another(std::move(sb), std::move(aDeviceBuffer), 0, 0, aTotalSize);
 		return actionTypeCommand;
@@ -473,11 +483,13 @@ namespace avk
 	/**	Get a tuple of <0>:vertices and <1>:indices from the given selection of models and associated mesh indices.
 	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
 	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aMaxThreads					The maximum number of threads which gather the meshes' data, including the calling thread.
+	 *										Pass 1 if this is invoked from within a parallel_for already.
 	 *	@return	Combined position and index data of all specified model + mesh-indices tuples, where the returned tuple's elements refer to:
 	 *			<0>: vertex positions
 	 *			<1>: indices
 	 */
-	extern std::tuple<std::vector<glm::vec3>, std::vector<uint32_t>> get_vertices_and_indices(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes);
+	extern std::tuple<std::vector<glm::vec3>, std::vector<uint32_t>> get_vertices_and_indices(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aMaxThreads = parallel_for_max_threads());
 
 	/**	Get a tuple of <0>:vertices and <1>:indices from the given selection of models and associated mesh indices.
 	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
@@ -1424,6 +1436,291 @@ namespace avk
 		}
 		return create_buffer_cached<std::vector<glm::vec3>, Metas...>(aSerializer, textureCoordinatesData, avk::content_description::texture_coordinate, aUsageFlags);
 	}
+
+	/**	Get normals from the given selection of models and associated mesh indices, packed into octahedral encoding with 2x16 bit precision.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@return	Combined packed normals data of all specified model + mesh-indices.
+	 */
+	extern std::vector<octahedral_2x16> get_normals_octahedral(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes);
+
+	/**	Get normals from the given selection of models and associated mesh indices, packed into octahedral encoding with 2x16 bit precision.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. The order is maintained.
+	 *	@return	Combined packed normals data of all specified model + mesh-indices tuples.
+	 */
+	extern std::vector<octahedral_2x16> get_normals_octahedral_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes);
+
+	/**	Get tangents from the given selection of models and associated mesh indices, packed into octahedral encoding with 2x16 bit precision.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@return	Combined packed tangents data of all specified model + mesh-indices.
+	 */
+	extern std::vector<octahedral_2x16> get_tangents_octahedral(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes);
+
+	/**	Get tangents from the given selection of models and associated mesh indices, packed into octahedral encoding with 2x16 bit precision.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. The order is maintained.
+	 *	@return	Combined packed tangents data of all specified model + mesh-indices tuples.
+	 */
+	extern std::vector<octahedral_2x16> get_tangents_octahedral_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes);
+
+	/**	Get 2D texture coordinates from the given selection of models and associated mesh indices, packed into half precision floats.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aTexCoordSet				The zero-based set of texture coordinates to load.
+	 *	@return	Combined packed 2D texture coordinates data of all specified model + mesh-indices.
+	 */
+	extern std::vector<half_2x16> get_2d_texture_coordinates_half(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0);
+
+	/**	Get 2D texture coordinates from the given selection of models and associated mesh indices, packed into half precision floats.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aTexCoordSet				The zero-based set of texture coordinates to load.
+	 *	@return	Combined packed 2D texture coordinates data of all specified model + mesh-indices.
+	 */
+	extern std::vector<half_2x16> get_2d_texture_coordinates_half_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0);
+
+	/**	Get 2D texture coordinates from the given selection of models and associated mesh indices, with their y-coordinates flipped and packed into half precision floats.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aTexCoordSet				The zero-based set of texture coordinates to load.
+	 *	@return	Combined packed 2D texture coordinates data of all specified model + mesh-indices.
+	 */
+	extern std::vector<half_2x16> get_2d_texture_coordinates_flipped_half(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0);
+
+	/**	Get 2D texture coordinates from the given selection of models and associated mesh indices, with their y-coordinates flipped and packed into half precision floats.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aTexCoordSet				The zero-based set of texture coordinates to load.
+	 *	@return	Combined packed 2D texture coordinates data of all specified model + mesh-indices.
+	 */
+	extern std::vector<half_2x16> get_2d_texture_coordinates_flipped_half_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0);
+
+	/**	Get vertex positions from the given selection of models and associated mesh indices, quantized to 16 bit per component
+	 *	relative to the axis aligned bounding box of all selected meshes. Positions are not transformed by the meshes' transformation matrices.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: Combined quantized positions data of all specified model + mesh-indices.
+	 *			<1>: The transformation which reconstructs the original positions from the quantized ones.
+	 */
+	extern std::tuple<std::vector<quantized_position_4x16>, position_dequantization> get_quantized_positions(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes);
+
+	/**	Get vertex positions from the given selection of models and associated mesh indices, quantized to 16 bit per component
+	 *	relative to the axis aligned bounding box of all selected meshes. Positions are not transformed by the meshes' transformation matrices.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: Combined quantized positions data of all specified model + mesh-indices.
+	 *			<1>: The transformation which reconstructs the original positions from the quantized ones.
+	 */
+	extern std::tuple<std::vector<quantized_position_4x16>, position_dequantization> get_quantized_positions_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes);
+
+	/**	Get a buffer containing normals in octahedral encoding (2x16 bit, vk::Format::eR16G16Snorm) from the given input data.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aUsageFlags					Additional usage flags that the buffer is created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the packed normals. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_normals_octahedral_buffer(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		return create_buffer<std::vector<octahedral_2x16>, Metas...>(get_normals_octahedral(aModelsAndSelectedMeshes), avk::content_description::normal, aUsageFlags);
+	}
+
+	/**	Get a buffer containing normals in octahedral encoding (2x16 bit, vk::Format::eR16G16Snorm) from the given input data.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aUsageFlags					Additional usage flags that the buffer is created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the packed normals. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_normals_octahedral_buffer_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		std::vector<octahedral_2x16> normalsData;
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			normalsData = get_normals_octahedral(aModelsAndSelectedMeshes);
+		}
+		return create_buffer_cached<std::vector<octahedral_2x16>, Metas...>(aSerializer, normalsData, avk::content_description::normal, aUsageFlags);
+	}
+
+	/**	Get a buffer containing tangents in octahedral encoding (2x16 bit, vk::Format::eR16G16Snorm) from the given input data.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aUsageFlags					Additional usage flags that the buffer is created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the packed tangents. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_tangents_octahedral_buffer(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		return create_buffer<std::vector<octahedral_2x16>, Metas...>(get_tangents_octahedral(aModelsAndSelectedMeshes), avk::content_description::tangent, aUsageFlags);
+	}
+
+	/**	Get a buffer containing tangents in octahedral encoding (2x16 bit, vk::Format::eR16G16Snorm) from the given input data.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aUsageFlags					Additional usage flags that the buffer is created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the packed tangents. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_tangents_octahedral_buffer_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		std::vector<octahedral_2x16> tangentsData;
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			tangentsData = get_tangents_octahedral(aModelsAndSelectedMeshes);
+		}
+		return create_buffer_cached<std::vector<octahedral_2x16>, Metas...>(aSerializer, tangentsData, avk::content_description::tangent, aUsageFlags);
+	}
+
+	/**	Get a buffer containing 2D texture coordinates in half precision (vk::Format::eR16G16Sfloat) from the given input data.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aTexCoordSet				The zero-based set of texture coordinates to load.
+	 *	@param	aUsageFlags					Additional usage flags that the buffer is created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the packed texture coordinates. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_2d_texture_coordinates_half_buffer(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		return create_buffer<std::vector<half_2x16>, Metas...>(get_2d_texture_coordinates_half(aModelsAndSelectedMeshes, aTexCoordSet), avk::content_description::texture_coordinate, aUsageFlags);
+	}
+
+	/**	Get a buffer containing 2D texture coordinates in half precision (vk::Format::eR16G16Sfloat) from the given input data.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aTexCoordSet				The zero-based set of texture coordinates to load.
+	 *	@param	aUsageFlags					Additional usage flags that the buffer is created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the packed texture coordinates. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_2d_texture_coordinates_half_buffer_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		std::vector<half_2x16> textureCoordinatesData;
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			textureCoordinatesData = get_2d_texture_coordinates_half(aModelsAndSelectedMeshes, aTexCoordSet);
+		}
+		return create_buffer_cached<std::vector<half_2x16>, Metas...>(aSerializer, textureCoordinatesData, avk::content_description::texture_coordinate, aUsageFlags);
+	}
+
+	/**	Get a buffer containing 2D texture coordinates in half precision (vk::Format::eR16G16Sfloat) from the given input data, with their y-coordinates flipped.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aTexCoordSet				The zero-based set of texture coordinates to load.
+	 *	@param	aUsageFlags					Additional usage flags that the buffer is created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the packed texture coordinates. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_2d_texture_coordinates_flipped_half_buffer(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		return create_buffer<std::vector<half_2x16>, Metas...>(get_2d_texture_coordinates_flipped_half(aModelsAndSelectedMeshes, aTexCoordSet), avk::content_description::texture_coordinate, aUsageFlags);
+	}
+
+	/**	Get a buffer containing 2D texture coordinates in half precision (vk::Format::eR16G16Sfloat) from the given input data, with their y-coordinates flipped.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aTexCoordSet				The zero-based set of texture coordinates to load.
+	 *	@param	aUsageFlags					Additional usage flags that the buffer is created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the packed texture coordinates. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <1>) have completed execution.
+	 *			<1>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, avk::command::action_type_command> create_2d_texture_coordinates_flipped_half_buffer_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet = 0, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		std::vector<half_2x16> textureCoordinatesData;
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			textureCoordinatesData = get_2d_texture_coordinates_flipped_half(aModelsAndSelectedMeshes, aTexCoordSet);
+		}
+		return create_buffer_cached<std::vector<half_2x16>, Metas...>(aSerializer, textureCoordinatesData, avk::content_description::texture_coordinate, aUsageFlags);
+	}
+
+	/**	Get a buffer containing vertex positions quantized to 16 bit per component (vk::Format::eR16G16B16A16Unorm) from the given input data.
+	 *	The positions are quantized relative to the axis aligned bounding box of all selected meshes. The returned dequantization
+	 *	transformation must be applied to the positions read from the buffer, e.g., by pre-multiplying its matrix() to the model matrix.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aUsageFlags					Additional usage flags that the buffer is created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the quantized positions. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <2>) have completed execution.
+	 *			<1>: The transformation which reconstructs the original positions from the quantized ones.
+	 *			<2>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, position_dequantization, avk::command::action_type_command> create_quantized_positions_buffer(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		auto [positionsData, dequantization] = get_quantized_positions(aModelsAndSelectedMeshes);
+		auto [buffer, actionTypeCommand] = create_buffer<std::vector<quantized_position_4x16>, Metas...>(positionsData, avk::content_description::position, aUsageFlags);
+		return std::make_tuple(std::move(buffer), dequantization, std::move(actionTypeCommand));
+	}
+
+	/**	Get a buffer containing vertex positions quantized to 16 bit per component (vk::Format::eR16G16B16A16Unorm) from the given input data.
+	 *	The positions are quantized relative to the axis aligned bounding box of all selected meshes. The returned dequantization
+	 *	transformation must be applied to the positions read from the buffer, e.g., by pre-multiplying its matrix() to the model matrix.
+	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
+	 *	@param	aModelsAndSelectedMeshes	A collection where every entry consists of a model-reference + associated mesh indices.
+	 *										All the data they refer to is combined into a a common result. Their order is maintained.
+	 *	@param	aUsageFlags					Additional usage flags that the buffer is created with.
+	 *	@tparam	Metas						A list of buffer meta data types which shall be added to the creation of the buffer.
+	 *										The additional meta data declarations will always refer to the whole data in the buffer; specifying subranges is not supported.
+	 *	@return	A tuple containing the following values:
+	 *			<0>: A buffer in device memory which will contain the quantized positions. Attention: The user of this function must ensure that it is not destroyed before the returned commands (at tuple index <2>) have completed execution.
+	 *			<1>: The transformation which reconstructs the original positions from the quantized ones.
+	 *			<2>: Commands that need to be executed on a queue to complete the operation
+	 */
+	template <typename... Metas>
+	std::tuple<avk::buffer, position_dequantization, avk::command::action_type_command> create_quantized_positions_buffer_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, vk::BufferUsageFlags aUsageFlags = {})
+	{
+		std::vector<quantized_position_4x16> positionsData;
+		position_dequantization dequantization;
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			std::tie(positionsData, dequantization) = get_quantized_positions(aModelsAndSelectedMeshes);
+		}
+		aSerializer.archive(dequantization);
+		auto [buffer, actionTypeCommand] = create_buffer_cached<std::vector<quantized_position_4x16>, Metas...>(aSerializer, positionsData, avk::content_description::position, aUsageFlags);
+		return std::make_tuple(std::move(buffer), dequantization, std::move(actionTypeCommand));
+	}
 	
 	/**	Create a new sampler with the given configuration parameters
 	 *	@param	aSerializer					The serializer used to store the data to or load the data from a cache file, depending on its mode.
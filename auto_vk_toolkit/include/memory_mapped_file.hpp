@@ -0,0 +1,40 @@
+#pragma once
+
+namespace avk
+{
+	/** Read-only view of a whole file which is mapped into the address space of the process.
+	 *	The contents are paged in by the operating system on first access, i.e. no data is
+	 *	copied into an intermediate buffer when reading from the mapping.
+	 *	The mapping is released when the instance is destroyed. Move-only.
+	 */
+	class memory_mapped_file
+	{
+	public:
+		/** Map the file at the given path into memory.
+		 *	@param	aPath	Path to the file to be mapped. Throws an avk::runtime_error if it can not be opened or mapped.
+		 */
+		explicit memory_mapped_file(std::string_view aPath);
+
+		memory_mapped_file() = delete;
+		memory_mapped_file(memory_mapped_file&& aOther) noexcept;
+		memory_mapped_file(const memory_mapped_file&) = delete;
+		memory_mapped_file& operator=(memory_mapped_file&& aOther) noexcept;
+		memory_mapped_file& operator=(const memory_mapped_file&) = delete;
+		~memory_mapped_file();
+
+		/** Pointer to the first byte of the mapped file, or nullptr for empty files. */
+		const std::byte* data() const { return mData; }
+
+		/** Size of the mapped file in bytes. */
+		size_t size() const { return mSize; }
+
+		/** True if the mapped file has no contents. */
+		bool empty() const { return 0 == mSize; }
+
+	private:
+		void unmap() noexcept;
+
+		const std::byte* mData = nullptr;
+		size_t mSize = 0;
+	};
+}
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "material_image_helpers.hpp"
+#include "parallel_for.hpp"
 #include "serializer.hpp"
 
 namespace avk
@@ -57,6 +58,63 @@ namespace avk
 		uint8_t mPrimitiveCount;
 	};
 
+	/** Bounding volumes of a meshlet, which can be used to cull meshlets, e.g., in a task shader.
+	 *	All members are vec4s, s.t. the layout matches std430 on the GLSL side.
+	 *	A meshlet is entirely backfacing, i.e., can be culled, if for a camera at position c:
+	 *		dot(normalize(mConeApex.xyz - c), mConeAxisAndCutoff.xyz) >= mConeAxisAndCutoff.w
+	 */
+	struct alignas(16) meshlet_bounds
+	{
+		/** Center of the bounding sphere in xyz, its radius in w */
+		glm::vec4 mBoundingSphere;
+		/** Minimum corner of the axis aligned bounding box in xyz, w is unused */
+		glm::vec4 mAabbMin;
+		/** Maximum corner of the axis aligned bounding box in xyz, w is unused */
+		glm::vec4 mAabbMax;
+		/** Apex of the normal cone in xyz, w is unused */
+		glm::vec4 mConeApex;
+		/** Axis of the normal cone in xyz, and the cosine-based cutoff value in w.
+		 *	The cutoff is 1 if the triangle normals diverge too much for cone culling to be possible.
+		 */
+		glm::vec4 mConeAxisAndCutoff;
+	};
+
+	/** Meshlet for GPU usage, like meshlet_gpu_data, extended by the meshlet's bounding volumes.
+	 *	The bounds are stored after the members of meshlet_gpu_data, at a 16-byte aligned offset.
+	 *  @tparam NV	The number of vertices
+	 *	@tparam NI	The number of indices
+	 */
+	template <size_t NV = 64, size_t NI = 378>
+	struct meshlet_gpu_data_with_bounds : meshlet_gpu_data<NV, NI>
+	{
+		/** The bounding volumes of the meshlet */
+		meshlet_bounds mBounds;
+	};
+
+	/** Meshlet for GPU usage, like meshlet_redirected_gpu_data, extended by the meshlet's bounding volumes.
+	 *	The bounds are stored after the members of meshlet_redirected_gpu_data, at a 16-byte aligned offset.
+	 */
+	struct meshlet_redirected_gpu_data_with_bounds : meshlet_redirected_gpu_data
+	{
+		/** The bounding volumes of the meshlet */
+		meshlet_bounds mBounds;
+	};
+
+	// A concept which requires a type to have a .mBounds member of type meshlet_bounds
+	template <typename T>
+	concept has_meshlet_bounds = requires (T x)
+	{
+		{ x.mBounds } -> std::convertible_to<meshlet_bounds>;
+	};
+
+	/** Computes the bounding volumes of the given meshlet.
+	 *	@param	aMeshlet			The meshlet.
+	 *	@param	aVertexPositions	The vertex positions which the meshlet's mVertices refer to, i.e., the positions of its
+	 *								mesh, or of the combined meshes if submeshes have been combined upon division.
+	 *	@return	The bounding sphere, axis aligned bounding box, and normal cone of the meshlet.
+	 */
+	extern meshlet_bounds compute_meshlet_bounds(const meshlet& aMeshlet, std::span<const glm::vec3> aVertexPositions);
+
 	/** Serialization/deserialization method for meshlet_gpu_data.
 	 *	@param	aArchive	The archive.
 	 *	@param	aValue		The value to serialize or to deserialize into.
@@ -68,7 +126,7 @@ namespace avk
 	void serialize(Archive& aArchive, meshlet_gpu_data<NV, NI>& aValue)
 	{
 		aArchive(avk::serializer::binary_data(aValue.mVertices, sizeof(meshlet_gpu_data<NV, NI>::mVertices)));
-		aArchive(avk::serializer::binary_data(aValue.mVertices, sizeof(meshlet_gpu_data<NV, NI>::mIndices)));
+		aArchive(avk::serializer::binary_data(aValue.mIndices, sizeof(meshlet_gpu_data<NV, NI>::mIndices)));
 		aArchive(aValue.mVertexCount, aValue.mPrimitiveCount);
 	}
 
@@ -83,6 +141,43 @@ namespace avk
 		aArchive(aValue.mDataOffset, aValue.mVertexCount, aValue.mPrimitiveCount);
 	}
 
+	/** Serialization/deserialization method for meshlet_bounds.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, meshlet_bounds& aValue)
+	{
+		aArchive(aValue.mBoundingSphere, aValue.mAabbMin, aValue.mAabbMax, aValue.mConeApex, aValue.mConeAxisAndCutoff);
+	}
+
+	/** Serialization/deserialization method for meshlet_gpu_data_with_bounds.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 *	@tparam NV			The number of vertices used by the meshlet_gpu_data_with_bounds.
+	 *	@tparam NI			The number of indices used by the meshlet_gpu_data_with_bounds.
+	 */
+	template<typename Archive, size_t NV, size_t NI>
+	void serialize(Archive& aArchive, meshlet_gpu_data_with_bounds<NV, NI>& aValue)
+	{
+		serialize(aArchive, static_cast<meshlet_gpu_data<NV, NI>&>(aValue));
+		aArchive(aValue.mBounds);
+	}
+
+	/** Serialization/deserialization method for meshlet_redirected_gpu_data_with_bounds.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, meshlet_redirected_gpu_data_with_bounds& aValue)
+	{
+		serialize(aArchive, static_cast<meshlet_redirected_gpu_data&>(aValue));
+		aArchive(aValue.mBounds);
+	}
+
 
 	/** Divides the given index buffer into meshlets by simply aggregating every aMaxVertices indices into a meshlet.
 	 *  @param	aIndices			The index buffer.
@@ -97,6 +192,26 @@ namespace avk
 		std::optional<mesh_index_t> aMeshIndex,
 		uint32_t aMaxVertices, uint32_t aMaxIndices);
 
+	/** Divides the given vertex and index buffer into spatially coherent meshlets. Starting from a seed triangle, each meshlet
+	 *	is grown greedily across adjacent triangles, preferring triangles which require the fewest additional vertices, and
+	 *	among those, the ones which keep the meshlet's bounding sphere and normal cone tightest. When a meshlet can not grow
+	 *	any further along its boundary, it continues with the closest remaining triangle. Within each meshlet, triangles are
+	 *	reordered s.t. consecutive triangles share vertices, and vertices are numbered in the order of their first use.
+	 *	Pass it to `divide_into_meshlets` as custom division function, e.g. `avk::divide_into_meshlets(selection, avk::spatial_meshlets_divider);`
+	 *  @param	aVertices			The vertex buffer.
+	 *  @param	aIndices			The index buffer.
+	 *  @param	aModel				The model these buffers belong to.
+	 *	@param	aMeshIndex			The optional mesh index of the mesh these buffers belong to.
+	 *	@param	aMaxVertices		The maximum number of vertices of a meshlet. At most 256 vertices are used, since indices are stored as uint8_t.
+	 *	@param	aMaxIndices			The maximum number of indices of a meshlet.
+	 */
+	std::vector<meshlet> spatial_meshlets_divider(
+		const std::vector<glm::vec3>& aVertices,
+		const std::vector<uint32_t>& aIndices,
+		const model_t& aModel,
+		std::optional<mesh_index_t> aMeshIndex,
+		uint32_t aMaxVertices, uint32_t aMaxIndices);
+
 	/** Divides the given vertex and index buffer into meshlets using the given callback function.
 	 *  @param	aVertices			The vertex buffer.
 	 *  @param	aIndices			The index buffer.
@@ -160,6 +275,7 @@ namespace avk
 	}
 
 	/** Divides the given models into meshlets using the default implementation divide_into_meshlets_simple.
+	 *	Shared ownership is enabled for all the models in aModelsAndMeshletIndices, since every meshlet references its model.
 	 *  @param	aModelsAndMeshletIndices				All the models and associated meshes that should be divided into meshlets.
 	 *	@param	aCombineSubmeshes	If submeshes should be combined into a single vertex/index buffer.
 	 *	@param	aMaxVertices		The maximum number of vertices of a meshlet.
@@ -169,6 +285,7 @@ namespace avk
 		const bool aCombineSubmeshes = true, const uint32_t aMaxVertices = 64, const uint32_t aMaxIndices = 378);
 
 	/** Divides the given models into meshlets using the given callback function.
+	 *	Shared ownership is enabled for all the models in aModelsAndMeshletIndices, since every meshlet references its model.
 	 *  @param	aModelsAndMeshletIndices				All the models and associated meshes that should be divided into meshlets.
 	 *  @param	aMeshletDivision	Callback used to divide meshes into meshlets with a maximum number of vertices and indices each.
 	 *								It can either receive the vertices and indices or just the indices depending on your specific needs.
@@ -205,10 +322,12 @@ namespace avk
 		for (auto& pair : aModelsAndMeshletIndices) {
 			auto& model = std::get<avk::model>(pair);
 			auto& meshIndices = std::get<std::vector<mesh_index_t>>(pair);
+			// The model is referenced by every meshlet and by subsequent meshes => share it instead of moving it away:
+			model.enable_shared_ownership();
 
 			if (aCombineSubmeshes) {
 				auto [vertices, indices] = get_vertices_and_indices(make_model_references_and_mesh_indices_selection(model, meshIndices));
-				std::vector<meshlet> tmpMeshlets = divide_indexed_geometry_into_meshlets(vertices, indices, std::move(model), std::nullopt, aMaxVertices, aMaxIndices, std::move(aMeshletDivision));
+				std::vector<meshlet> tmpMeshlets = divide_indexed_geometry_into_meshlets(vertices, indices, model, std::nullopt, aMaxVertices, aMaxIndices, aMeshletDivision);
 				// append to meshlets
 				meshlets.insert(std::end(meshlets), std::make_move_iterator(std::begin(tmpMeshlets)), std::make_move_iterator(std::end(tmpMeshlets)));
 			}
@@ -216,7 +335,7 @@ namespace avk
 				for (const auto meshIndex : meshIndices) {
 					auto vertices = model.get().positions_for_mesh(meshIndex);
 					auto indices = model.get().indices_for_mesh<uint32_t>(meshIndex);
-					std::vector<meshlet> tmpMeshlets = divide_indexed_geometry_into_meshlets(vertices, indices, std::move(model), meshIndex, aMaxVertices, aMaxIndices, std::move(aMeshletDivision));
+					std::vector<meshlet> tmpMeshlets = divide_indexed_geometry_into_meshlets(vertices, indices, model, meshIndex, aMaxVertices, aMaxIndices, aMeshletDivision);
 					// append to meshlets
 					meshlets.insert(std::end(meshlets), std::make_move_iterator(std::begin(tmpMeshlets)), std::make_move_iterator(std::end(tmpMeshlets)));
 				}
@@ -225,6 +344,84 @@ namespace avk
 
 		return meshlets;
 	}
+
+	/** Divides the given models into meshlets like `divide_into_meshlets`, but processes independent work items on multiple threads.
+	 *	A work item is one model if aCombineSubmeshes is true, or one mesh of a model otherwise. The resulting meshlets are
+	 *	concatenated in the same order as `divide_into_meshlets` would produce them, i.e. the result does not depend on
+	 *	the number of threads or on the order in which the work items finish.
+	 *	Shared ownership is enabled for all the models in aModelsAndMeshletIndices.
+	 *
+	 *  @param	aModelsAndMeshletIndices	All the models and associated meshes that should be divided into meshlets.
+	 *  @param	aMeshletDivision	Callback used to divide meshes into meshlets, see `divide_into_meshlets` for the declaration schema.
+	 *								It is copied for each work item and invoked concurrently on different threads, i.e. it must be
+	 *								copyable and must not modify shared state without synchronization.
+	 *	@param	aCombineSubmeshes	If submeshes should be combined into a single vertex/index buffer.
+	 *	@param	aMaxVertices		The maximum number of vertices of a meshlet. This value is just passed on to aMeshletDivision.
+	 *	@param	aMaxIndices			The maximum number of indices of a meshlet. This value is just passed on to aMeshletDivision.
+	 *	@param	aMaxThreads			The maximum number of threads to use, including the calling thread.
+	 */
+	template <typename F>
+	std::vector<meshlet> divide_into_meshlets_parallel(std::vector<std::tuple<avk::model, std::vector<avk::mesh_index_t>>>& aModelsAndMeshletIndices, F aMeshletDivision,
+		const bool aCombineSubmeshes = true, const uint32_t aMaxVertices = 64, const uint32_t aMaxIndices = 378, const size_t aMaxThreads = parallel_for_max_threads())
+	{
+		struct work_item
+		{
+			size_t mModelIndex;
+			std::optional<mesh_index_t> mMeshIndex;
+		};
+
+		// Collect the work items in the order in which their meshlets shall end up in the result:
+		std::vector<work_item> workItems;
+		for (size_t i = 0; i < aModelsAndMeshletIndices.size(); ++i) {
+			// Copies of the model are handed to the worker threads, which requires shared ownership:
+			std::get<avk::model>(aModelsAndMeshletIndices[i]).enable_shared_ownership();
+			if (aCombineSubmeshes) {
+				workItems.push_back({ i, std::nullopt });
+			}
+			else {
+				for (const auto meshIndex : std::get<std::vector<mesh_index_t>>(aModelsAndMeshletIndices[i])) {
+					workItems.push_back({ i, meshIndex });
+				}
+			}
+		}
+
+		std::vector<std::vector<meshlet>> meshletsPerWorkItem(workItems.size());
+		parallel_for(workItems.size(), [&](size_t i) {
+			const auto& item = workItems[i];
+			const auto& model = std::get<avk::model>(aModelsAndMeshletIndices[item.mModelIndex]);
+			if (item.mMeshIndex.has_value()) {
+				auto vertices = model.get().positions_for_mesh(item.mMeshIndex.value());
+				auto indices = model.get().indices_for_mesh<uint32_t>(item.mMeshIndex.value());
+				meshletsPerWorkItem[i] = divide_indexed_geometry_into_meshlets(vertices, indices, model, item.mMeshIndex, aMaxVertices, aMaxIndices, aMeshletDivision);
+			}
+			else {
+				const auto& meshIndices = std::get<std::vector<mesh_index_t>>(aModelsAndMeshletIndices[item.mModelIndex]);
+				// Already running on one of parallel_for's threads => do not occupy further threads, s.t. aMaxThreads is honored:
+				auto [vertices, indices] = get_vertices_and_indices(make_model_references_and_mesh_indices_selection(model, meshIndices), 1);
+				meshletsPerWorkItem[i] = divide_indexed_geometry_into_meshlets(vertices, indices, model, std::nullopt, aMaxVertices, aMaxIndices, aMeshletDivision);
+			}
+		}, aMaxThreads);
+
+		size_t totalCount = 0;
+		for (const auto& tmpMeshlets : meshletsPerWorkItem) {
+			totalCount += tmpMeshlets.size();
+		}
+		std::vector<meshlet> meshlets;
+		meshlets.reserve(totalCount);
+		for (auto& tmpMeshlets : meshletsPerWorkItem) {
+			meshlets.insert(std::end(meshlets), std::make_move_iterator(std::begin(tmpMeshlets)), std::make_move_iterator(std::end(tmpMeshlets)));
+		}
+		return meshlets;
+	}
+
+	/** Divides the given models into meshlets on multiple threads using the default implementation basic_meshlets_divider.
+	 *  @param	aModelsAndMeshletIndices				All the models and associated meshes that should be divided into meshlets.
+	 *	@param	aCombineSubmeshes	If submeshes should be combined into a single vertex/index buffer.
+	 *	@param	aMaxVertices		The maximum number of vertices of a meshlet.
+	 *	@param	aMaxIndices			The maximum number of indices of a meshlet.
+	 */
+	std::vector<meshlet> divide_into_meshlets_parallel(std::vector<std::tuple<avk::model, std::vector<mesh_index_t>>>& aModelsAndMeshletIndices,
+		const bool aCombineSubmeshes = true, const uint32_t aMaxVertices = 64, const uint32_t aMaxIndices = 378);
 	
 	// A concept which requires a type to have ::sNumVertices and ::sNumIndices
 	template <typename T>
@@ -256,6 +453,27 @@ namespace avk
 	 */
 	template <typename T, size_t NV, size_t NI>
 	std::tuple<std::vector<T>, std::optional<std::vector<uint32_t>>> convert_for_gpu_usage(const std::vector<meshlet>& aMeshlets)
+	{
+		static_assert(!has_meshlet_bounds<T>, "Computing meshlet bounds requires the vertex positions to be passed to convert_for_gpu_usage.");
+		return convert_for_gpu_usage<T, NV, NI>(aMeshlets, std::span<const glm::vec3>{});
+	}
+
+	/** Converts meshlets into a GPU usable representation, including their bounding volumes if T has them.
+	 *	@param	aMeshlets			The meshlets to convert
+	 *	@param	aVertexPositions	The vertex positions which the meshlets' mVertices refer to. Only used if T has bounds,
+	 *								i.e., all meshlets must have been generated from the same vertex data in that case.
+	 *	@tparam	T					meshlet_gpu_data, meshlet_redirected_gpu_data, or their variants with bounds,
+	 *								meshlet_gpu_data_with_bounds, and meshlet_redirected_gpu_data_with_bounds.
+	 *								The bounds are computed with compute_meshlet_bounds. Apart from that, the data is the same
+	 *								as described for the overload without aVertexPositions.
+	 *  @tparam NV					The number of vertices
+	 *  @tparam NI					The number of indices
+	 *  @returns					A Tuple of the following structure:
+	 *								<0>: The input meshlets, converted into the provided output meshlet type.
+	 *								<1>: Meshlet indices data, if the redirected representation is used.
+	 */
+	template <typename T, size_t NV, size_t NI>
+	std::tuple<std::vector<T>, std::optional<std::vector<uint32_t>>> convert_for_gpu_usage(const std::vector<meshlet>& aMeshlets, std::span<const glm::vec3> aVertexPositions)
 	{
 		std::vector<T> gpuMeshlets;
 		std::optional<std::vector<uint32_t>> vertexIndices{};
@@ -288,6 +506,9 @@ namespace avk
 				assert(false);
 				throw avk::logic_error("No suitable type passed to convert_for_gpu_usage.");
 			}
+			if constexpr (has_meshlet_bounds<T>) {
+				newEntry.mBounds = compute_meshlet_bounds(meshlet, aVertexPositions);
+			}
 		}
 		return std::forward_as_tuple(gpuMeshlets, vertexIndices);
 	}
@@ -316,6 +537,21 @@ namespace avk
 		return convert_for_gpu_usage<T, T::sNumVertices, T::sNumIndices>(aMeshlets);
 	}
 
+	/** Converts meshlets into a GPU usable representation, including their bounding volumes if T has them.
+	 *	@param	aMeshlets			The meshlets to convert
+	 *	@param	aVertexPositions	The vertex positions which the meshlets' mVertices refer to. Only used if T has bounds,
+	 *								i.e., all meshlets must have been generated from the same vertex data in that case.
+	 *	@tparam	T					meshlet_gpu_data or meshlet_gpu_data_with_bounds
+	 *  @returns					A Tuple of the following structure:
+	 *								<0>: The input meshlets, converted into the provided output meshlet type.
+	 *								<1>: Empty, since the redirected representation can not be used with this overload.
+	 */
+	template <typename T> requires has_static_num_vertices_and_num_indices<T>
+	std::tuple<std::vector<T>, std::optional<std::vector<uint32_t>>> convert_for_gpu_usage(const std::vector<meshlet>& aMeshlets, std::span<const glm::vec3> aVertexPositions)
+	{
+		return convert_for_gpu_usage<T, T::sNumVertices, T::sNumIndices>(aMeshlets, aVertexPositions);
+	}
+
 	/** Converts meshlets into a GPU usable representation.
 	 *  @param  aSerializer The serializer for the meshlet gpu data.
 	 *	@param	aMeshlets	The meshlets to convert
@@ -339,13 +575,35 @@ namespace avk
 	 */
 	template <typename T, size_t NV, size_t NI>
 	std::tuple<std::vector<T>, std::optional<std::vector<uint32_t>>> convert_for_gpu_usage_cached(serializer& aSerializer, const std::vector<meshlet>& aMeshlets)
+	{
+		static_assert(!has_meshlet_bounds<T>, "Computing meshlet bounds requires the vertex positions to be passed to convert_for_gpu_usage_cached.");
+		return convert_for_gpu_usage_cached<T, NV, NI>(aSerializer, aMeshlets, std::span<const glm::vec3>{});
+	}
+
+	/** Converts meshlets into a GPU usable representation, including their bounding volumes if T has them.
+	 *	The bounds are stored in and loaded from the cache along with the rest of the meshlet data.
+	 *  @param  aSerializer			The serializer for the meshlet gpu data.
+	 *	@param	aMeshlets			The meshlets to convert
+	 *	@param	aVertexPositions	The vertex positions which the meshlets' mVertices refer to. Only used if T has bounds and
+	 *								the serializer is in serialize mode, i.e., all meshlets must have been generated from the
+	 *								same vertex data in that case.
+	 *	@tparam	T					meshlet_gpu_data, meshlet_redirected_gpu_data, or their variants with bounds,
+	 *								meshlet_gpu_data_with_bounds, and meshlet_redirected_gpu_data_with_bounds.
+	 *  @tparam NV					The number of vertices
+	 *  @tparam NI					The number of indices
+	 *  @returns					A Tuple of the following structure:
+	 *								<0>: The input meshlets, converted into the provided output meshlet type.
+	 *								<1>: Meshlet indices data, if the redirected representation is used.
+	 */
+	template <typename T, size_t NV, size_t NI>
+	std::tuple<std::vector<T>, std::optional<std::vector<uint32_t>>> convert_for_gpu_usage_cached(serializer& aSerializer, const std::vector<meshlet>& aMeshlets, std::span<const glm::vec3> aVertexPositions)
 	{
 		std::tuple<std::vector<T>, std::optional<std::vector<uint32_t>>> result;
 		auto& resultMeshlets = std::get<std::vector<T>>(result);
 		auto& resultMeshletsData = std::get<std::optional<std::vector<uint32_t>>>(result);
 		if (aSerializer.mode() == serializer::mode::serialize)
 		{
-			std::tie(resultMeshlets, resultMeshletsData) = convert_for_gpu_usage<T, NV, NI>(aMeshlets);
+			std::tie(resultMeshlets, resultMeshletsData) = convert_for_gpu_usage<T, NV, NI>(aMeshlets, aVertexPositions);
 		}
 
 		if constexpr (std::is_convertible_v<T, meshlet_gpu_data<NV, NI>>)
@@ -389,4 +647,21 @@ namespace avk
 		return convert_for_gpu_usage_cached<T, T::sNumVertices, T::sNumIndices>(aSerializer, aMeshlets);
 	}
 
+	/** Converts meshlets into a GPU usable representation, including their bounding volumes if T has them.
+	 *	The bounds are stored in and loaded from the cache along with the rest of the meshlet data.
+	 *  @param  aSerializer			The serializer for the meshlet gpu data.
+	 *	@param	aMeshlets			The meshlets to convert
+	 *	@param	aVertexPositions	The vertex positions which the meshlets' mVertices refer to. Only used if T has bounds and
+	 *								the serializer is in serialize mode.
+	 *	@tparam	T					meshlet_gpu_data or meshlet_gpu_data_with_bounds
+	 *  @returns					A Tuple of the following structure:
+	 *								<0>: The input meshlets, converted into the provided output meshlet type.
+	 *								<1>: Empty, since the redirected representation can not be used with this overload.
+	 */
+	template <typename T> requires has_static_num_vertices_and_num_indices<T>
+	std::tuple<std::vector<T>, std::optional<std::vector<uint32_t>>> convert_for_gpu_usage_cached(serializer& aSerializer, const std::vector<meshlet>& aMeshlets, std::span<const glm::vec3> aVertexPositions)
+	{
+		return convert_for_gpu_usage_cached<T, T::sNumVertices, T::sNumIndices>(aSerializer, aMeshlets, aVertexPositions);
+	}
+
 }
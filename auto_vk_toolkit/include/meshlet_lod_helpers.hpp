@@ -0,0 +1,215 @@
+#pragma once
+
+#include "meshlet_helpers.hpp"
+
+namespace avk
+{
+	/** Level of detail information of a single cluster, i.e., a meshlet, in a meshlet_lod_hierarchy.
+	 *	A cluster is part of the view-dependent cut of the hierarchy if its own projected error is small enough,
+	 *	but the projected error of its parent group is not. See select_meshlet_lod_clusters.
+	 */
+	struct meshlet_lod_cluster
+	{
+		/** The level of the cluster in the hierarchy. Level 0 contains the original geometry. */
+		uint32_t mLevel;
+		/** Index into meshlet_lod_hierarchy::mGroups of the group this cluster has been created from,
+		 *	or meshlet_lod_hierarchy::sNoGroup for clusters of the original geometry.
+		 */
+		uint32_t mSourceGroup;
+		/** Index into meshlet_lod_hierarchy::mGroups of the group which this cluster has been simplified in,
+		 *	or meshlet_lod_hierarchy::sNoGroup for root clusters.
+		 */
+		uint32_t mParentGroup;
+		/** The simplification error of this cluster in object space units, 0 for clusters of the original geometry. */
+		float mError;
+		/** The sphere which mError refers to: center in xyz, radius in w */
+		glm::vec4 mLodSphere;
+		/** The simplification error of the parent group, std::numeric_limits<float>::max() for root clusters. */
+		float mParentError;
+		/** The sphere which mParentError refers to: center in xyz, radius in w */
+		glm::vec4 mParentLodSphere;
+		/** The bounding volumes of the cluster, which can be used for culling. */
+		meshlet_bounds mBounds;
+	};
+
+	/** A group of neighbouring clusters which have been simplified together, and re-split into the group's parent clusters. */
+	struct meshlet_lod_group
+	{
+		/** Indices into meshlet_lod_hierarchy::mClusters of the clusters which have been simplified together. */
+		std::vector<uint32_t> mChildren;
+		/** Indices into meshlet_lod_hierarchy::mClusters of the clusters which have been created from the simplified geometry. */
+		std::vector<uint32_t> mParents;
+		/** The simplification error of the group, which includes the errors of all its children. */
+		float mError;
+		/** Sphere which encloses the spheres of all its children: center in xyz, radius in w */
+		glm::vec4 mLodSphere;
+	};
+
+	/** A hierarchy of meshlets (a directed acyclic graph of clusters and groups), where the geometry of
+	 *	each group of clusters is represented by coarser parent clusters on the next level.
+	 *	All meshlets refer to the vertices of the original geometry, i.e., no new vertices are created.
+	 */
+	struct meshlet_lod_hierarchy
+	{
+		static constexpr uint32_t sNoGroup = std::numeric_limits<uint32_t>::max();
+
+		/** The meshlets of all clusters on all levels. They can be converted via convert_for_gpu_usage. */
+		std::vector<meshlet> mMeshlets;
+		/** Level of detail information for every meshlet in mMeshlets, at the same indices. */
+		std::vector<meshlet_lod_cluster> mClusters;
+		/** All groups of the hierarchy. */
+		std::vector<meshlet_lod_group> mGroups;
+		/** The number of levels of the hierarchy. */
+		uint32_t mNumLevels = 0u;
+	};
+
+	/** Level of detail information of a cluster for GPU usage, e.g., to select the cut of the hierarchy in a task shader.
+	 *	All members are laid out s.t. they match std430 on the GLSL side.
+	 */
+	struct alignas(16) meshlet_lod_gpu_data
+	{
+		/** The sphere which mError refers to: center in xyz, radius in w */
+		glm::vec4 mLodSphere;
+		/** The sphere which mParentError refers to: center in xyz, radius in w */
+		glm::vec4 mParentLodSphere;
+		/** The simplification error of the cluster */
+		float mError;
+		/** The simplification error of the parent group, std::numeric_limits<float>::max() for root clusters */
+		float mParentError;
+		/** The level of the cluster in the hierarchy */
+		uint32_t mLevel;
+		uint32_t mPadding;
+	};
+
+	/** Projects the given simplification error w.r.t. the given viewer position, i.e., divides it by the distance
+	 *	to the closest point of the given sphere. This is the same metric which select_meshlet_lod_clusters uses,
+	 *	and it should be replicated in shaders which select the cut on the GPU.
+	 *	@param	aLodSphere		The sphere which aError refers to: center in xyz, radius in w
+	 *	@param	aError			The simplification error in object space units
+	 *	@param	aViewPosition	The position of the viewer in object space
+	 *	@return	The projected error, std::numeric_limits<float>::max() if aError is std::numeric_limits<float>::max(),
+	 *			or if the viewer is inside the sphere and aError is not 0.
+	 */
+	inline float meshlet_lod_projected_error(const glm::vec4& aLodSphere, float aError, const glm::vec3& aViewPosition)
+	{
+		if (aError <= 0.f) {
+			return 0.f;
+		}
+		if (aError >= std::numeric_limits<float>::max()) {
+			return std::numeric_limits<float>::max();
+		}
+		const float distance = glm::length(glm::vec3{ aLodSphere } - aViewPosition) - aLodSphere.w;
+		return distance > 0.f ? aError / distance : std::numeric_limits<float>::max();
+	}
+
+	/** Builds a hierarchy of meshlets from the given geometry: The geometry is divided into meshlets with spatial_meshlets_divider.
+	 *	Then, groups of neighbouring meshlets are simplified to half of their triangles, and the result is divided into meshlets again.
+	 *	This is repeated until a single root cluster remains, or until the geometry can not be simplified any further.
+	 *	The vertices at the borders between groups are not changed by the simplification, and neither are vertices which share
+	 *	their position with other vertices (e.g., at texture coordinate seams), s.t. no cracks can occur between clusters.
+	 *
+	 *  @param	aVertices			The vertex positions, e.g. obtained via get_vertices_and_indices.
+	 *  @param	aIndices			The index buffer.
+	 *  @param	aModel				The model these buffers belong to. Shared ownership is enabled for it.
+	 *	@param	aMeshIndex			The optional mesh index of the mesh these buffers belong to.
+	 *	@param	aMaxVertices		The maximum number of vertices of a meshlet. At most 256 vertices are used, since indices are stored as uint8_t.
+	 *	@param	aMaxIndices			The maximum number of indices of a meshlet.
+	 *	@return	The hierarchy. The meshlets on all levels refer to aVertices.
+	 */
+	extern meshlet_lod_hierarchy build_meshlet_lod_hierarchy(
+		const std::vector<glm::vec3>& aVertices,
+		const std::vector<uint32_t>& aIndices,
+		avk::model aModel,
+		std::optional<mesh_index_t> aMeshIndex,
+		uint32_t aMaxVertices = 64, uint32_t aMaxIndices = 378);
+
+	/** Builds a hierarchy of meshlets from the given geometry, like build_meshlet_lod_hierarchy.
+	 *  @param  aSerializer			The serializer for the hierarchy.
+	 *  @param	aVertices			The vertex positions. Only used if the serializer is in serialize mode.
+	 *  @param	aIndices			The index buffer. Only used if the serializer is in serialize mode.
+	 *  @param	aModel				The model these buffers belong to. It is assigned to all meshlets of the hierarchy.
+	 *	@param	aMeshIndex			The optional mesh index of the mesh these buffers belong to.
+	 *	@param	aMaxVertices		The maximum number of vertices of a meshlet.
+	 *	@param	aMaxIndices			The maximum number of indices of a meshlet.
+	 *	@return	The hierarchy. The meshlets on all levels refer to aVertices.
+	 */
+	extern meshlet_lod_hierarchy build_meshlet_lod_hierarchy_cached(
+		avk::serializer& aSerializer,
+		const std::vector<glm::vec3>& aVertices,
+		const std::vector<uint32_t>& aIndices,
+		avk::model aModel,
+		std::optional<mesh_index_t> aMeshIndex,
+		uint32_t aMaxVertices = 64, uint32_t aMaxIndices = 378);
+
+	/** Gathers the level of detail information of all clusters of the given hierarchy for GPU usage.
+	 *	@param	aHierarchy	The hierarchy
+	 *	@return	One element per cluster, in the same order as meshlet_lod_hierarchy::mMeshlets.
+	 */
+	extern std::vector<meshlet_lod_gpu_data> convert_lod_clusters_for_gpu_usage(const meshlet_lod_hierarchy& aHierarchy);
+
+	/** Selects the view-dependent cut through the hierarchy: A cluster is selected if its own projected error is
+	 *	at most aErrorThreshold, but the projected error of its parent group exceeds aErrorThreshold.
+	 *	Since the errors and spheres grow monotonically towards the roots, the selected clusters form a crack-free
+	 *	representation of the whole geometry.
+	 *	@param	aHierarchy		The hierarchy
+	 *	@param	aViewPosition	The position of the viewer in object space
+	 *	@param	aErrorThreshold	The maximum projected error, see meshlet_lod_projected_error. To obtain it from a maximum error
+	 *							in pixels for a perspective projection, multiply the pixels by 2*tan(fovy/2)/viewportHeight.
+	 *	@return	Indices into meshlet_lod_hierarchy::mMeshlets of the selected clusters.
+	 */
+	extern std::vector<uint32_t> select_meshlet_lod_clusters(const meshlet_lod_hierarchy& aHierarchy, const glm::vec3& aViewPosition, float aErrorThreshold);
+
+	/** Selects the most detailed view-dependent cut through the hierarchy which does not exceed the given number of triangles.
+	 *	The error threshold of select_meshlet_lod_clusters is searched for, s.t. the triangle budget is met. If even the
+	 *	root clusters exceed the budget, the root clusters are returned.
+	 *	@param	aHierarchy		The hierarchy
+	 *	@param	aViewPosition	The position of the viewer in object space
+	 *	@param	aMaxTriangles	The triangle budget
+	 *	@return	Indices into meshlet_lod_hierarchy::mMeshlets of the selected clusters.
+	 */
+	extern std::vector<uint32_t> select_meshlet_lod_clusters_for_budget(const meshlet_lod_hierarchy& aHierarchy, const glm::vec3& aViewPosition, uint32_t aMaxTriangles);
+
+	/** Serialization/deserialization method for a meshlet. Its mModel is not serialized.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, meshlet& aValue)
+	{
+		aArchive(aValue.mMeshIndex, aValue.mVertices, aValue.mIndices, aValue.mVertexCount, aValue.mIndexCount);
+	}
+
+	/** Serialization/deserialization method for meshlet_lod_cluster.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, meshlet_lod_cluster& aValue)
+	{
+		aArchive(aValue.mLevel, aValue.mSourceGroup, aValue.mParentGroup, aValue.mError, aValue.mLodSphere, aValue.mParentError, aValue.mParentLodSphere, aValue.mBounds);
+	}
+
+	/** Serialization/deserialization method for meshlet_lod_group.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, meshlet_lod_group& aValue)
+	{
+		aArchive(aValue.mChildren, aValue.mParents, aValue.mError, aValue.mLodSphere);
+	}
+
+	/** Serialization/deserialization method for meshlet_lod_hierarchy. The models of its meshlets are not serialized.
+	 *	@param	aArchive	The archive.
+	 *	@param	aValue		The value to serialize or to deserialize into.
+	 *	@tparam Archive		The archive type.
+	 */
+	template<typename Archive>
+	void serialize(Archive& aArchive, meshlet_lod_hierarchy& aValue)
+	{
+		aArchive(aValue.mMeshlets, aValue.mClusters, aValue.mGroups, aValue.mNumLevels);
+	}
+}
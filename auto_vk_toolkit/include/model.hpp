@@ -27,6 +27,33 @@ namespace avk
 		
 		static avk::owning_resource<model_t> load_from_memory(const std::string& aMemory, aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate);
 
+		/** Loads a model which has been written with `bake_to_file` before. The file is read without
+		 *	invoking Assimp's importer or any of its post-processing steps, which makes this much faster
+		 *	than `load_from_file` for large assets. All queries of the model behave like for the model
+		 *	which has been baked, including paths of textures, which are resolved relative to the
+		 *	path of the original asset (see `path()`).
+		 *	@param	aPath	Path to the baked model file
+		 */
+		static avk::owning_resource<model_t> load_from_baked_file(const std::string& aPath);
+
+		/** Loads the baked model from aBakedPath if that file exists. Otherwise, or if that file has been baked
+		 *	with a different version of the baked model format or cannot be read (e.g., because it is truncated),
+		 *	the model is loaded from aPath via `load_from_file`, and baked to aBakedPath for subsequent runs.
+		 *	@param	aPath			Path to the original asset
+		 *	@param	aBakedPath		Path to the baked model file
+		 *	@param	aAssimpFlags	Flags which are passed on to `load_from_file` if the model has not been baked yet.
+		 *							Delete the baked file when changing them.
+		 */
+		static avk::owning_resource<model_t> load_from_file_baked(const std::string& aPath, const std::string& aBakedPath, aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate);
+
+		/** Writes the model into a compact binary file which can be loaded via `load_from_baked_file`.
+		 *	The file contains the model's meshes with all of their vertex attributes and bones, its materials,
+		 *	its node hierarchy (including the bones' nodes and armatures), animations, lights, and cameras. Embedded textures, morph animations, and
+		 *	metadata are not included. The file is tied to the framework's serializer version.
+		 *	@param	aPath	Path of the baked model file to be written
+		 */
+		void bake_to_file(const std::string& aPath) const;
+
 		/** Returns this model's path where it has been loaded from */
 		auto path() const { return mModelPath; }
 
@@ -309,6 +336,74 @@ namespace avk
 			return result;
 		}
 
+		/** Writes all the positions for the mesh at the given index into the given destination.
+		 *	The following `*_for_mesh_into` functions behave like their `*_for_mesh` counterparts,
+		 *	but write into memory provided by the caller instead of allocating a new vector.
+		 *	They only read from the model, hence, they can be invoked for different meshes
+		 *	from multiple threads concurrently.
+		 *	@param		aMeshIndex		The index corresponding to the mesh
+		 *	@param		aDestination	Memory to write into, of length `number_of_vertices_for_mesh()`
+		 */
+		void positions_for_mesh_into(mesh_index_t aMeshIndex, std::span<glm::vec3> aDestination) const;
+
+		/** Writes all the normals for the mesh at the given index into the given destination. See `normals_for_mesh`. */
+		void normals_for_mesh_into(mesh_index_t aMeshIndex, std::span<glm::vec3> aDestination) const;
+
+		/** Writes all the tangents for the mesh at the given index into the given destination. See `tangents_for_mesh`. */
+		void tangents_for_mesh_into(mesh_index_t aMeshIndex, std::span<glm::vec3> aDestination) const;
+
+		/** Writes all the bitangents for the mesh at the given index into the given destination. See `bitangents_for_mesh`. */
+		void bitangents_for_mesh_into(mesh_index_t aMeshIndex, std::span<glm::vec3> aDestination) const;
+
+		/** Writes all the colors of a specific color set for the mesh at the given index into the given destination. See `colors_for_mesh`. */
+		void colors_for_mesh_into(mesh_index_t aMeshIndex, std::span<glm::vec4> aDestination, int aSet = 0) const;
+
+		/** Writes all the bone weights for the mesh at the given index into the given destination. See `bone_weights_for_mesh`. */
+		void bone_weights_for_mesh_into(mesh_index_t aMeshIndex, std::span<glm::vec4> aDestination, bool aNormalizeBoneWeights = false) const;
+
+		/** Writes all the "mesh-local" bone indices for the mesh at the given index into the given destination. See `bone_indices_for_mesh`. */
+		void bone_indices_for_mesh_into(mesh_index_t aMeshIndex, std::span<glm::uvec4> aDestination, uint32_t aBoneIndexOffset = 0) const;
+
+		/** Writes the "mesh-set-global" bone indices for the mesh at the given index into the given destination. See `bone_indices_for_mesh_for_single_target_buffer`. */
+		void bone_indices_for_mesh_for_single_target_buffer_into(mesh_index_t aMeshIndex, const std::vector<mesh_index_t>& aMeshIndicesWithBonesInOrder, std::span<glm::uvec4> aDestination) const;
+
+		/** Writes all the texture coordinates of a UV-set for the mesh at the given index into the given destination.
+		 *	See `texture_coordinates_for_mesh`. Supported types are `glm::vec2` and `glm::vec3`.
+		 */
+		template <typename T> void texture_coordinates_for_mesh_into(T(*aTransformFunc)(const T&), mesh_index_t aMeshIndex, std::span<T> aDestination, int aSet = 0) const
+		{
+			throw avk::logic_error(std::format("unsupported type {}", typeid(T).name()));
+		}
+
+		/** Writes all the texture coordinates of a UV-set for the mesh at the given index into the given destination.
+		 *	See `texture_coordinates_for_mesh`. Supported types are `glm::vec2` and `glm::vec3`.
+		 */
+		template <typename T> void texture_coordinates_for_mesh_into(mesh_index_t aMeshIndex, std::span<T> aDestination, int aSet = 0) const
+		{
+			texture_coordinates_for_mesh_into<T>([](const T& aValue) { return aValue; }, aMeshIndex, aDestination, aSet);
+		}
+
+		/** Writes all the indices for the mesh at the given index into the given destination.
+		 *	@param		aMeshIndex		The index corresponding to the mesh
+		 *	@param		aDestination	Memory to write into, of length `number_of_indices_for_mesh()`
+		 *	@param		aIndexOffset	Value which is added to every index, e.g. to account for
+		 *								vertices of other meshes stored before this mesh's vertices.
+		 */
+		template <typename T>
+		void indices_for_mesh_into(mesh_index_t aMeshIndex, std::span<T> aDestination, T aIndexOffset = T{ 0 }) const
+		{
+			const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
+			assert(aDestination.size() == static_cast<size_t>(number_of_indices_for_mesh(aMeshIndex)));
+			size_t i = 0;
+			for (unsigned int fi = 0; fi < paiMesh->mNumFaces; ++fi) {
+				// we're working with triangulated meshes only
+				const aiFace& paiFace = paiMesh->mFaces[fi];
+				for (unsigned int f = 0; f < paiFace.mNumIndices; ++f) {
+					aDestination[i++] = static_cast<T>(paiFace.mIndices[f]) + aIndexOffset;
+				}
+			}
+		}
+
 		/** Returns the number of meshes. */
 		mesh_index_t num_meshes() const { return mScene->mNumMeshes; }
 
@@ -389,6 +484,12 @@ namespace avk
 		 */
 		void calculate_tangent_space_for_mesh(mesh_index_t aMeshIndex, uint32_t aConfigSourceUV = 0);
 
+		/** Returns the tangents and bitangents which have been calculated for the mesh at the given
+		 *	index via `calculate_tangent_space_for_mesh`, or nullptr if they have not been calculated.
+		 *	@param	aMeshIndex			The index corresponding to the mesh
+		 */
+		const std::tuple<std::vector<glm::vec3>, std::vector<glm::vec3>>* calculated_tangent_space_for_mesh(mesh_index_t aMeshIndex) const;
+
 		/** Calculates the tangent space with Auto-Vk-Toolkit's implementation for all meshes,
 		 *  possibly overwriting ASSIMPs tangents/bitangents.
 		 *	@param	aConfigSourceUV		The set of UV coordinates to be used for tangent space calculation
@@ -428,6 +529,8 @@ namespace avk
 		}
 
 		std::unique_ptr<Assimp::Importer> mImporter;
+		/** The scene of a baked model, which is not owned by an importer */
+		std::unique_ptr<aiScene> mBakedScene;
 		std::string mModelPath;
 		const aiScene* mScene;
 		std::vector<std::optional<material_config>> mMaterialConfigPerMesh;
@@ -438,17 +541,16 @@ namespace avk
 
 
 	template <>
-	inline std::vector<glm::vec2> model_t::texture_coordinates_for_mesh<glm::vec2>(glm::vec2(*aTransformFunc)(const glm::vec2&), mesh_index_t aMeshIndex, int aSet) const
+	inline void model_t::texture_coordinates_for_mesh_into<glm::vec2>(glm::vec2(*aTransformFunc)(const glm::vec2&), mesh_index_t aMeshIndex, std::span<glm::vec2> aDestination, int aSet) const
 	{
 		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
 		auto n = paiMesh->mNumVertices;
-		std::vector<glm::vec2> result;
-		result.reserve(n);
+		assert(aDestination.size() == n);
 		assert(aSet >= 0 && aSet < AI_MAX_NUMBER_OF_TEXTURECOORDS);
 		if (nullptr == paiMesh->mTextureCoords[aSet]) {
 			LOG_WARNING(std::format("The mesh at index {} does not contain a texture coordinates at index {}. Will return (0,0) for each vertex.", aMeshIndex, aSet));
 			for (decltype(n) i = 0; i < n; ++i) {
-				result.emplace_back(0.f, 0.f);
+				aDestination[i] = glm::vec2{ 0.f, 0.f };
 			}
 		}
 		else {
@@ -456,34 +558,32 @@ namespace avk
 			switch (nuv) {
 			case 1:
 				for (decltype(n) i = 0; i < n; ++i) {
-					result.emplace_back(aTransformFunc(glm::vec2{ paiMesh->mTextureCoords[aSet][i][0], 0.f }));
+					aDestination[i] = aTransformFunc(glm::vec2{ paiMesh->mTextureCoords[aSet][i][0], 0.f });
 				}
 				break;
 			case 2:
 			case 3:
 				for (decltype(n) i = 0; i < n; ++i) {
-					result.emplace_back(aTransformFunc(glm::vec2{ paiMesh->mTextureCoords[aSet][i][0], paiMesh->mTextureCoords[aSet][i][1] }));
+					aDestination[i] = aTransformFunc(glm::vec2{ paiMesh->mTextureCoords[aSet][i][0], paiMesh->mTextureCoords[aSet][i][1] });
 				}
 				break;
 			default:
 				throw avk::logic_error(std::format("Can't handle a number of {} uv components for mesh at index {}, set {}.", nuv, aMeshIndex, aSet));
 			}
 		}
-		return result;
 	}
 
 	template <>
-	inline std::vector<glm::vec3> model_t::texture_coordinates_for_mesh<glm::vec3>(mesh_index_t aMeshIndex, int aSet) const
+	inline void model_t::texture_coordinates_for_mesh_into<glm::vec3>(glm::vec3(*aTransformFunc)(const glm::vec3&), mesh_index_t aMeshIndex, std::span<glm::vec3> aDestination, int aSet) const
 	{
 		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
 		auto n = paiMesh->mNumVertices;
-		std::vector<glm::vec3> result;
-		result.reserve(n);
+		assert(aDestination.size() == n);
 		assert(aSet >= 0 && aSet < AI_MAX_NUMBER_OF_TEXTURECOORDS);
 		if (nullptr == paiMesh->mTextureCoords[aSet]) {
 			LOG_WARNING(std::format("The mesh at index {} does not contain a texture coordinates at index {}. Will return (0,0,0) for each vertex.", aMeshIndex, aSet));
 			for (decltype(n) i = 0; i < n; ++i) {
-				result.emplace_back(0.f, 0.f, 0.f);
+				aDestination[i] = glm::vec3{ 0.f, 0.f, 0.f };
 			}
 		}
 		else {
@@ -491,23 +591,38 @@ namespace avk
 			switch (nuv) {
 			case 1:
 				for (decltype(n) i = 0; i < n; ++i) {
-					result.emplace_back(paiMesh->mTextureCoords[aSet][i][0], 0.f, 0.f);
+					aDestination[i] = aTransformFunc(glm::vec3{ paiMesh->mTextureCoords[aSet][i][0], 0.f, 0.f });
 				}
 				break;
 			case 2:
 				for (decltype(n) i = 0; i < n; ++i) {
-					result.emplace_back(paiMesh->mTextureCoords[aSet][i][0], paiMesh->mTextureCoords[aSet][i][1], 0.f);
+					aDestination[i] = aTransformFunc(glm::vec3{ paiMesh->mTextureCoords[aSet][i][0], paiMesh->mTextureCoords[aSet][i][1], 0.f });
 				}
 				break;
 			case 3:
 				for (decltype(n) i = 0; i < n; ++i) {
-					result.emplace_back(paiMesh->mTextureCoords[aSet][i][0], paiMesh->mTextureCoords[aSet][i][1], paiMesh->mTextureCoords[aSet][i][2]);
+					aDestination[i] = aTransformFunc(glm::vec3{ paiMesh->mTextureCoords[aSet][i][0], paiMesh->mTextureCoords[aSet][i][1], paiMesh->mTextureCoords[aSet][i][2] });
 				}
 				break;
 			default:
 				throw avk::logic_error(std::format("Can't handle a number of {} uv components for mesh at index {}, set {}.", nuv, aMeshIndex, aSet));
 			}
 		}
+	}
+
+	template <>
+	inline std::vector<glm::vec2> model_t::texture_coordinates_for_mesh<glm::vec2>(glm::vec2(*aTransformFunc)(const glm::vec2&), mesh_index_t aMeshIndex, int aSet) const
+	{
+		std::vector<glm::vec2> result(number_of_vertices_for_mesh(aMeshIndex));
+		texture_coordinates_for_mesh_into<glm::vec2>(aTransformFunc, aMeshIndex, result, aSet);
+		return result;
+	}
+
+	template <>
+	inline std::vector<glm::vec3> model_t::texture_coordinates_for_mesh<glm::vec3>(mesh_index_t aMeshIndex, int aSet) const
+	{
+		std::vector<glm::vec3> result(number_of_vertices_for_mesh(aMeshIndex));
+		texture_coordinates_for_mesh_into<glm::vec3>(aMeshIndex, result, aSet);
 		return result;
 	}
 
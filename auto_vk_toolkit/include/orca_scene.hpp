@@ -135,7 +135,13 @@ namespace avk
 		 */
 		std::unordered_map<material_config, std::vector<model_and_mesh_indices>> distinct_material_configs_for_all_models(bool aAlsoConsiderCpuOnlyDataForDistinctMaterials = false);
 
-		static avk::owning_resource<orca_scene_t> load_from_file(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate | aiProcess_PreTransformVertices);
+		/** Loads an ORCA scene from the given .fscene file.
+		 *	@param	aPath			Path to the .fscene file
+		 *	@param	aAssimpFlags	Flags which are passed on to model_t::load_from_file
+		 *	@param	aLoadModels		If false, only the paths of the models are resolved (see model_data::mFullPathName), but the models
+		 *							are not loaded. This allows to load them in the background, e.g. via async_model_loader.
+		 */
+		static avk::owning_resource<orca_scene_t> load_from_file(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags = aiProcess_Triangulate | aiProcess_PreTransformVertices, bool aLoadModels = true);
 
 	private:
 		std::string mLoadPath;
@@ -0,0 +1,120 @@
+#pragma once
+
+namespace avk
+{
+	/** A unit vector (e.g. a normal or a tangent) in octahedral encoding, stored as two signed normalized
+	 *	16-bit values. Use `vk::Format::eR16G16Snorm` to read it in shaders, and decode it like `octahedral_decode`.
+	 */
+	struct octahedral_2x16
+	{
+		glm::i16vec2 mValue;
+	};
+
+	/** Two half-precision floating point values, e.g. 2D texture coordinates. Use `vk::Format::eR16G16Sfloat`. */
+	struct half_2x16
+	{
+		glm::u16vec2 mValue;
+	};
+
+	/** A position quantized to 16-bit unsigned normalized values relative to a bounding box. The w component
+	 *	is always 1.0, so that the dequantization matrix can be applied directly. Use `vk::Format::eR16G16B16A16Unorm`.
+	 */
+	struct quantized_position_4x16
+	{
+		glm::u16vec4 mValue;
+	};
+
+	/** The transformation which reconstructs positions from their quantized representation:
+	 *	position = mOffset + mScale * unorm(quantized position)
+	 */
+	struct position_dequantization
+	{
+		glm::vec3 mScale{ 1.f };
+		glm::vec3 mOffset{ 0.f };
+
+		/** The dequantization as matrix, which can, e.g., be multiplied with the model matrix */
+		glm::mat4 matrix() const
+		{
+			return glm::translate(glm::mat4{ 1.f }, mOffset) * glm::scale(glm::mat4{ 1.f }, mScale);
+		}
+
+		/** Reconstructs a position from its quantized representation */
+		glm::vec3 dequantize(const quantized_position_4x16& aValue) const
+		{
+			return mOffset + mScale * glm::vec3{ aValue.mValue } / 65535.f;
+		}
+	};
+
+	/** Encodes the given unit vector into two components in [-1, 1] via octahedral mapping. */
+	inline glm::vec2 octahedral_encode(const glm::vec3& aUnitVector)
+	{
+		const float l1Norm = std::abs(aUnitVector.x) + std::abs(aUnitVector.y) + std::abs(aUnitVector.z);
+		if (l1Norm <= 0.f) {
+			return glm::vec2{ 0.f };
+		}
+		glm::vec2 p = glm::vec2{ aUnitVector } / l1Norm;
+		if (aUnitVector.z < 0.f) {
+			// Fold the lower hemisphere over the diagonals:
+			const glm::vec2 signNotZero{ p.x >= 0.f ? 1.f : -1.f, p.y >= 0.f ? 1.f : -1.f };
+			p = (glm::vec2{ 1.f } - glm::abs(glm::vec2{ p.y, p.x })) * signNotZero;
+		}
+		return p;
+	}
+
+	/** Decodes a unit vector from its octahedral mapping, i.e. the inverse of `octahedral_encode`. */
+	inline glm::vec3 octahedral_decode(const glm::vec2& aEncoded)
+	{
+		glm::vec3 n{ aEncoded.x, aEncoded.y, 1.f - std::abs(aEncoded.x) - std::abs(aEncoded.y) };
+		const float t = std::max(-n.z, 0.f);
+		n.x += n.x >= 0.f ? -t : t;
+		n.y += n.y >= 0.f ? -t : t;
+		return glm::normalize(n);
+	}
+
+	/** Packs the given unit vector into octahedral encoding with 2x16 bit precision. */
+	inline octahedral_2x16 pack_octahedral_2x16(const glm::vec3& aUnitVector)
+	{
+		const auto e = glm::clamp(octahedral_encode(aUnitVector), glm::vec2{ -1.f }, glm::vec2{ 1.f });
+		return { glm::i16vec2{ glm::round(e * 32767.f) } };
+	}
+
+	/** Unpacks a unit vector which has been packed with `pack_octahedral_2x16`. */
+	inline glm::vec3 unpack_octahedral_2x16(const octahedral_2x16& aValue)
+	{
+		return octahedral_decode(glm::max(glm::vec2{ aValue.mValue } / 32767.f, glm::vec2{ -1.f }));
+	}
+
+	/** Packs the given two floats into half precision floats. */
+	inline half_2x16 pack_half_2x16(const glm::vec2& aValue)
+	{
+		return { glm::u16vec2{ glm::packHalf1x16(aValue.x), glm::packHalf1x16(aValue.y) } };
+	}
+
+	/** Unpacks two floats which have been packed with `pack_half_2x16`. */
+	inline glm::vec2 unpack_half_2x16(const half_2x16& aValue)
+	{
+		return { glm::unpackHalf1x16(aValue.mValue.x), glm::unpackHalf1x16(aValue.mValue.y) };
+	}
+
+	/** Creates the transformation which maps the positions quantized against the given bounding box back to their original values. */
+	inline position_dequantization position_dequantization_for_bounds(const glm::vec3& aMin, const glm::vec3& aMax)
+	{
+		return { aMax - aMin, aMin };
+	}
+
+	/** Quantizes the given position, which must be inside of the bounding box which aDequantization has been created for. */
+	inline quantized_position_4x16 quantize_position_4x16(const glm::vec3& aPosition, const position_dequantization& aDequantization)
+	{
+		glm::vec3 normalized;
+		for (glm::length_t i = 0; i < 3; ++i) {
+			// Flat bounding boxes have no extent along some axes => all positions are at the offset:
+			normalized[i] = aDequantization.mScale[i] > 0.f ? (aPosition[i] - aDequantization.mOffset[i]) / aDequantization.mScale[i] : 0.f;
+		}
+		const auto q = glm::round(glm::clamp(normalized, glm::vec3{ 0.f }, glm::vec3{ 1.f }) * 65535.f);
+		return { glm::u16vec4{ q.x, q.y, q.z, 65535.f } };
+	}
+
+	template <>	inline vk::Format format_for<octahedral_2x16>() { return vk::Format::eR16G16Snorm; }
+	template <>	inline vk::Format format_for<half_2x16>() { return vk::Format::eR16G16Sfloat; }
+	template <>	inline vk::Format format_for<quantized_position_4x16>() { return vk::Format::eR16G16B16A16Unorm; }
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+namespace avk
+{
+	/** Returns the number of worker threads which `parallel_for` uses at most. */
+	inline size_t parallel_for_max_threads()
+	{
+		return std::max(size_t{ 1 }, static_cast<size_t>(std::thread::hardware_concurrency()));
+	}
+
+	/**	The persistent worker threads which execute `parallel_for`. They are created on first use, and their number is
+	 *	parallel_for_max_threads() - 1, i.e., together with a calling thread they occupy all hardware threads.
+	 *
+	 *	Multiple jobs can be in flight at the same time, e.g., when parallel_for is invoked from different threads or
+	 *	from within the function of another parallel_for. The calling thread of a job works off its items, and idle
+	 *	worker threads help with them. A job therefore always completes, even if all worker threads are busy.
+	 */
+	class parallel_for_pool
+	{
+	public:
+		/** The pool which is shared by all invocations of `parallel_for` */
+		static parallel_for_pool& instance();
+
+		parallel_for_pool(parallel_for_pool&&) noexcept = delete;
+		parallel_for_pool(const parallel_for_pool&) = delete;
+		parallel_for_pool& operator=(parallel_for_pool&&) noexcept = delete;
+		parallel_for_pool& operator=(const parallel_for_pool&) = delete;
+		/** Stops and joins the worker threads. */
+		~parallel_for_pool();
+
+		/**	Invokes aFunc(i) for every i in [0, aCount) on the calling thread and on at most aMaxHelpers worker threads.
+		 *	See `parallel_for` for the handling of exceptions.
+		 */
+		void run(size_t aCount, const std::function<void(size_t)>& aFunc, size_t aMaxHelpers);
+
+		/** The number of worker threads, not including calling threads */
+		size_t number_of_workers() const { return mWorkers.size(); }
+
+	private:
+		struct job
+		{
+			size_t mCount;
+			const std::function<void(size_t)>* mFunc;
+			std::atomic<size_t> mNextItem{ 0 };
+			std::atomic<bool> mFailed{ false };
+			std::mutex mExceptionMutex;
+			std::exception_ptr mFirstException;
+			/** Number of worker threads which may still join this job, guarded by mMutex */
+			size_t mHelpersLeft;
+			/** Number of worker threads which currently work on this job, guarded by mMutex */
+			size_t mActiveHelpers = 0;
+			std::condition_variable mHelpersDone;
+
+			/** Works off items until none are left, or until an invocation has failed. */
+			void work();
+		};
+
+		explicit parallel_for_pool(size_t aNumWorkers);
+		/** Main function of the worker threads */
+		void worker_main(size_t aThreadIndex);
+
+		std::mutex mMutex;
+		std::condition_variable mJobAvailable;
+		/** The jobs which accept further helpers */
+		std::deque<job*> mJobs;
+		bool mStop = false;
+		std::vector<std::thread> mWorkers;
+	};
+
+	/** Invokes aFunc(i) for every i in [0, aCount) on multiple threads.
+	 *	Work items are handed out dynamically, i.e. items with very different costs are balanced
+	 *	across the threads. The calling thread participates in the work, and the other threads are
+	 *	the persistent worker threads of parallel_for_pool, i.e., no threads are created per invocation.
+	 *	All invocations have finished when this function returns. If any invocation throws, the
+	 *	remaining items are skipped and the first exception is rethrown on the calling thread.
+	 *	parallel_for may be invoked concurrently, and from within aFunc.
+	 *
+	 *	@param	aCount		Number of work items
+	 *	@param	aFunc		Function with signature void(size_t) to be invoked for each work item.
+	 *						It must be safe to invoke it concurrently for different work items.
+	 *	@param	aMaxThreads	Maximum number of threads to use, including the calling thread.
+	 */
+	template <typename F>
+	void parallel_for(size_t aCount, F&& aFunc, size_t aMaxThreads = parallel_for_max_threads())
+	{
+		const size_t numThreads = std::min(aCount, std::max(size_t{ 1 }, aMaxThreads));
+		if (numThreads <= 1) {
+			for (size_t i = 0; i < aCount; ++i) {
+				aFunc(i);
+			}
+			return;
+		}
+
+		const std::function<void(size_t)> func = [&aFunc](size_t i) { aFunc(i); };
+		parallel_for_pool::instance().run(aCount, func, numThreads - 1);
+	}
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "invokee.hpp"
+#include "sequential_invoker.hpp"
+#include "parallel_for.hpp"
+#include "context_vulkan.hpp"
+
+namespace avk
+{
+	/**	@brief Handle @ref invokee concurrently on a set of worker threads!
+	 *
+	 *	The update() methods of all invokees with the same execution_order() are invoked concurrently,
+	 *	and different execution orders are processed one after the other. Invokees with the same
+	 *	execution order must therefore not depend on each other in their update() methods.
+	 *
+	 *	The render() methods are invoked sequentially on the calling thread, in the same way as
+	 *	sequential_invoker does, because they typically submit to queues and consume windows' semaphores,
+	 *	which must not happen concurrently. Inside of render(), command buffers can be recorded in parallel
+	 *	via record_in_parallel.
+	 *
+	 *	The worker threads are created once and are reused for all invocations. Work is distributed across
+	 *	per-thread queues, and threads which have run out of work steal from the others. Since the threads
+	 *	persist, so do the command pools which context_vulkan::get_command_pool_for creates per thread.
+	 */
+	class parallel_invoker
+	{
+	public:
+		/**	Creates the worker threads.
+		 *	@param	aMaxThreads		Maximum number of threads to use, including the calling thread.
+		 */
+		explicit parallel_invoker(size_t aMaxThreads = parallel_for_max_threads());
+		parallel_invoker(parallel_invoker&&) noexcept = delete;
+		parallel_invoker(const parallel_invoker&) = delete;
+		parallel_invoker& operator=(parallel_invoker&&) noexcept = delete;
+		parallel_invoker& operator=(const parallel_invoker&) = delete;
+		/** Stops and joins the worker threads. */
+		~parallel_invoker();
+
+		/** Invoke all the update() methods concurrently for each group of invokees
+		 *  with the same execution_order(), if the respective instance is enabled.
+		 */
+		void invoke_updates(const std::vector<invokee*>& elements);
+
+		/** Invoke all the render() methods in a sequential fashion,
+		 *  if the respective instance is enabled.
+		 *	Also pay attention to any pending updater actions.
+		 */
+		void invoke_renders(const std::vector<invokee*>& elements);
+
+		/**	Invokes aFunc(i) for every i in [0, aCount) on the worker threads and on the calling thread.
+		 *	All invocations have finished when this function returns. If any invocation throws,
+		 *	the first exception is rethrown on the calling thread.
+		 *	Must not be invoked concurrently, nor from within aFunc.
+		 *	@param	aCount						Number of work items
+		 *	@param	aFunc						Function to be invoked for each work item, concurrently for different work items.
+		 *	@param	aNumItemsForCallingThread	The work items [0, aNumItemsForCallingThread) are invoked on the calling thread,
+		 *										before it helps with the other work items.
+		 */
+		void run(size_t aCount, std::function<void(size_t)> aFunc, size_t aNumItemsForCallingThread = 0);
+
+		/**	Allocates and records aCount command buffers in parallel. Each command buffer is allocated from the
+		 *	command pool of the thread which records it (see context_vulkan::get_command_pool_for_single_use_command_buffers),
+		 *	so that no command pool is accessed concurrently. For the same reason, the returned command buffers must not
+		 *	be destroyed during another invocation of record_in_parallel, which is guaranteed if their lifetime is handled
+		 *	via window::handle_lifetime.
+		 *
+		 *	Secondary command buffers can be executed in a primary command buffer, e.g., within command::custom_commands.
+		 *
+		 *	@param	aQueue			The queue which the command buffers will be submitted to
+		 *	@param	aCount			The number of command buffers
+		 *	@param	aLevel			The level of the command buffers, typically vk::CommandBufferLevel::eSecondary
+		 *	@param	aRecordFunc		Function with signature void(size_t, avk::command_buffer_t&) which records the i-th command buffer,
+		 *							including begin and end of recording.
+		 *	@return	The recorded command buffers in the order of their indices
+		 */
+		template <typename F>
+		std::vector<avk::command_buffer> record_in_parallel(const avk::queue& aQueue, size_t aCount, vk::CommandBufferLevel aLevel, F&& aRecordFunc)
+		{
+			std::vector<avk::command_buffer> result(aCount);
+			run(aCount, [&](size_t i) {
+				auto& commandPool = context().get_command_pool_for_single_use_command_buffers(aQueue);
+				result[i] = commandPool->alloc_command_buffer(vk::CommandBufferUsageFlagBits::eOneTimeSubmit, aLevel);
+				aRecordFunc(i, *result[i]);
+			});
+			return result;
+		}
+
+		/** The number of threads which work on the invocations, including the calling thread */
+		size_t number_of_threads() const { return mWorkers.size() + 1; }
+
+	private:
+		/** A queue of work item indices per thread. Its owner takes from the back, others steal from the front. */
+		struct work_queue
+		{
+			std::mutex mMutex;
+			std::deque<size_t> mItems;
+		};
+
+		/** Invokes the current job's function for the given item, unless an invocation has failed already. */
+		void invoke_item(size_t aItem);
+		/** Works off items of the current job until no thread has any items left. */
+		void work(size_t aThreadIndex);
+		/** Takes an item from the given thread's queue, or steals one from another thread's queue. */
+		std::optional<size_t> take_item(size_t aThreadIndex);
+		/** Main function of the worker threads */
+		void worker_main(size_t aThreadIndex);
+
+		std::vector<std::thread> mWorkers;
+		/** One per thread. Index 0 belongs to the calling thread. */
+		std::vector<std::unique_ptr<work_queue>> mQueues;
+
+		std::mutex mJobMutex;
+		std::condition_variable mJobStarted;
+		std::condition_variable mJobFinished;
+		/** Incremented for every job, to wake up the worker threads */
+		uint64_t mJobGeneration = 0;
+		/** Number of worker threads which still work on the current job */
+		size_t mBusyWorkers = 0;
+		bool mStop = false;
+
+		std::function<void(size_t)> mJobFunc;
+		std::atomic<bool> mJobFailed{ false };
+		std::exception_ptr mJobException;
+	};
+}
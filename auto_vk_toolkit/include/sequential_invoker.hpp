@@ -16,6 +16,7 @@ namespace avk
 		{
 			for (auto& e : elements) {
 				if (e->is_enabled()) {
+					AVK_PROFILE_SCOPE_ID(e->update_profile_name_id());
 					e->update();
 				}
 			}
@@ -29,6 +30,8 @@ namespace avk
 		{
 			updater::prepare_for_current_frame();
 			for (auto& e : elements) {
+				// Like the update zones, only enabled invokees are profiled:
+				AVK_PROFILE_SCOPE_ID(e->is_enabled() ? e->render_profile_name_id() : cpu_profile_no_name_id);
 				if (e->is_enabled()) {
 					// First, apply potential changes required by the updater of the invokee,
 					// if one really exist. It is important that those changes are applied
@@ -5,6 +5,7 @@
 #include "lightsource_gpu_data.hpp"
 #include "material_gpu_data.hpp"
 #include "orca_scene.hpp"
+#include "memory_mapped_file.hpp"
 
 /** cereal binary archive */
 #include "cereal/cereal.hpp"
@@ -47,7 +48,7 @@
  *  invalidate old cache files. An exception will be thrown if the cache file's version and the framework's serializer
  *  versions do not match.
  */
-#define SERIALIZER_CACHE_FILE_VERSION 0x00000001
+#define SERIALIZER_CACHE_FILE_VERSION 0x00000002
 
 namespace avk {
 
@@ -78,16 +79,34 @@ namespace avk {
 			deserialize
 		};
 
+		/** @brief The possible ways of reading a cache file in deserialization mode
+		 *
+		 *  stream:			The cache file is read through a std::ifstream, i.e. every read
+		 *					copies from the kernel into the stream's buffer and from there
+		 *					into the destination.
+		 *  memory_mapped:	The whole cache file is mapped into the address space and data is
+		 *					copied straight from the mapped pages into the destination. Large
+		 *					blobs can be accessed without any copy via view_memory.
+		 */
+		enum class read_strategy {
+			stream,
+			memory_mapped
+		};
+
 		/** @brief Construct a serializer with serializing or deserializing capabilities
 		 *
 		 *  @param[in] aCacheFilePath The path to the cache file
 		 *  @param[in] aMode serializer::mode::serialize for serialization
 		 *					 serializer::mode::deserialize for deserialization
+		 *  @param[in] aReadStrategy How the cache file is read in deserialization mode; ignored
+		 *					 in serialization mode. The cache file format is the same for both.
 		 */
-		serializer(std::string_view aCacheFilePath, serializer::mode aMode) :
+		serializer(std::string_view aCacheFilePath, serializer::mode aMode, serializer::read_strategy aReadStrategy = serializer::read_strategy::stream) :
 			mArchive(aMode == serializer::mode::serialize ?
-				std::variant<deserialize, serialize>{ serializer::serialize(aCacheFilePath) } :
-				std::variant<deserialize, serialize>{ serializer::deserialize(aCacheFilePath) })
+				archive_variant{ std::in_place_type<serialize>, aCacheFilePath } :
+				aReadStrategy == serializer::read_strategy::memory_mapped ?
+				archive_variant{ std::in_place_type<deserialize_memory_mapped>, aCacheFilePath } :
+				archive_variant{ std::in_place_type<deserialize>, aCacheFilePath })
 		{
 			std::uint32_t version = SERIALIZER_CACHE_FILE_VERSION;
 			archive(version);
@@ -111,6 +130,19 @@ namespace avk {
 				serializer::mode::serialize)
 		{ }
 
+		/** @brief Construct a serializer with serializing or deserializing capabilities
+		 *  Like serializer(std::string_view), but allows to select how an existing cache
+		 *  file is read.
+		 *
+		 *  @param[in] aCacheFilePath The path to the cache file
+		 *  @param[in] aReadStrategy How the cache file is read if it already exists
+		 */
+		serializer(std::string_view aCacheFilePath, serializer::read_strategy aReadStrategy) :
+			serializer(aCacheFilePath, does_cache_file_exist(aCacheFilePath) ?
+				serializer::mode::deserialize :
+				serializer::mode::serialize, aReadStrategy)
+		{ }
+
 		serializer() = delete;
 		serializer(serializer&&) noexcept = default;
 		serializer(const serializer&) = delete;
@@ -127,6 +159,13 @@ namespace avk {
 			return std::holds_alternative<serialize>(mArchive) ? mode::serialize : mode::deserialize;
 		}
 
+		/** @brief Returns true if the serializer reads from a memory mapped cache file
+		 */
+		bool is_memory_mapped() const
+		{
+			return std::holds_alternative<deserialize_memory_mapped>(mArchive);
+		}
+
 		template<typename Type>
 		using BinaryData = cereal::BinaryData<Type>;
 
@@ -160,12 +199,7 @@ namespace avk {
 		template<typename Type>
 		inline void archive(Type&& aValue)
 		{
-			if (mode() == mode::serialize) {
-				std::get<serialize>(mArchive)(std::forward<Type>(aValue));
-			}
-			else {
-				std::get<deserialize>(mArchive)(std::forward<Type>(aValue));
-			}
+			std::visit([&aValue](auto& aArchive) { aArchive(std::forward<Type>(aValue)); }, mArchive);
 		}
 
 		/** @brief Serializes/Deserializes raw memory
@@ -181,12 +215,29 @@ namespace avk {
 		template<typename Type>
 		inline void archive_memory(Type&& aValue, size_t aSize)
 		{
-			if (mode() == mode::serialize) {
-				std::get<serialize>(mArchive)(binary_data(aValue, aSize));
-			}
-			else {
-				std::get<deserialize>(mArchive)(binary_data(aValue, aSize));
+			std::visit([&aValue, aSize](auto& aArchive) { aArchive(binary_data(aValue, aSize)); }, mArchive);
+		}
+
+		/** @brief Provides read access to the next block of raw memory without copying it
+		 *
+		 *  Only valid in deserialization mode. The next aSize bytes of the cache file are
+		 *  consumed, i.e. this is the counterpart of archive_memory for data that has been
+		 *  serialized with archive_memory. If the serializer reads from a memory mapped file,
+		 *  the returned span points directly into the mapping and no data is copied. Otherwise
+		 *  the data is read into an internal buffer which is reused by the next call.
+		 *  The returned span is valid until the next call to view_memory or until the
+		 *  serializer is destroyed. Its data must not be assumed to have any alignment.
+		 *
+		 *  @param[in] aSize The number of bytes to consume
+		 *  @return A read-only view of the consumed bytes
+		 */
+		std::span<const std::byte> view_memory(size_t aSize)
+		{
+			assert(mode() == mode::deserialize);
+			if (is_memory_mapped()) {
+				return std::get<deserialize_memory_mapped>(mArchive).view(aSize);
 			}
+			return std::get<deserialize>(mArchive).view(aSize);
 		}
 
 		/** @brief Serializes/Deserializes a avk::buffer
@@ -195,7 +246,8 @@ namespace avk {
 		 *  was initialized in serialization mode and deserializes the buffer content from file
 		 *  to the buffer of the internal memory_handle if the serializer was initialized in
 		 *  deserialization mode. The passed avk::buffer is internally mapped and unmapped for
-		 *  this operations.
+		 *  this operations. If the cache file is memory mapped, the buffer content is copied
+		 *  directly from the mapped file into the buffer's memory.
 		 *
 		 *  @param[in] aValue A pointer to the block of memory to serialize or to fill from file
 		 */
@@ -321,9 +373,130 @@ namespace avk {
 			{
 				mArchive(std::forward<Type>(aValue));
 			}
+
+			/** @brief Reads the next block of raw memory into an internal buffer
+			 *
+			 *  @param[in] aSize The number of bytes to read
+			 */
+			std::span<const std::byte> view(size_t aSize)
+			{
+				mScratch.resize(aSize);
+				mArchive(binary_data(mScratch.data(), aSize));
+				return { mScratch.data(), aSize };
+			}
+
+		private:
+			std::vector<std::byte> mScratch;
+		};
+
+		/** @brief deserialize_memory_mapped
+		 *
+		 *  This type represents an input archive to retrieve data in binary form from a
+		 *  memory mapped file. cereal reads through a stream buffer whose get area spans
+		 *  the whole mapping, so reads are plain copies from the mapped pages.
+		 */
+		class deserialize_memory_mapped
+		{
+			/** Stream buffer over a contiguous, read-only block of memory */
+			class mapped_streambuf : public std::streambuf
+			{
+			public:
+				mapped_streambuf(const std::byte* aBegin, const std::byte* aEnd, const std::byte* aCurrent)
+				{
+					// std::streambuf only knows char*, but never writes through the get area:
+					auto* begin = const_cast<char*>(reinterpret_cast<const char*>(aBegin));
+					setg(begin, begin + (aCurrent - aBegin), begin + (aEnd - aBegin));
+				}
+
+				const std::byte* current() const { return reinterpret_cast<const std::byte*>(gptr()); }
+				size_t remaining() const { return static_cast<size_t>(egptr() - gptr()); }
+
+				/* gbump only takes an int => large blobs must be skipped via setg */
+				void advance(size_t aCount)
+				{
+					setg(eback(), gptr() + aCount, egptr());
+				}
+
+			protected:
+				pos_type seekoff(off_type aOffset, std::ios_base::seekdir aDir, std::ios_base::openmode aWhich) override
+				{
+					const off_type base = aDir == std::ios_base::beg ? 0 : aDir == std::ios_base::cur ? gptr() - eback() : egptr() - eback();
+					return seekpos(pos_type(base + aOffset), aWhich);
+				}
+
+				pos_type seekpos(pos_type aPosition, std::ios_base::openmode aWhich) override
+				{
+					const off_type pos = aPosition;
+					if (!(aWhich & std::ios_base::in) || pos < 0 || pos > egptr() - eback()) {
+						return pos_type(off_type(-1));
+					}
+					setg(eback(), eback() + pos, egptr());
+					return aPosition;
+				}
+			};
+
+			memory_mapped_file mFile;
+			mapped_streambuf mStreambuf;
+			std::istream mIstream;
+			cereal::BinaryInputArchive mArchive;
+
+		public:
+			deserialize_memory_mapped() = delete;
+
+			/** @brief Construct, mapping the binary file from the provided path into memory
+			 *
+			 *  @param[in] aCacheFilePath The filename including the full path to the binary cached file
+			 */
+			deserialize_memory_mapped(const std::string_view aCacheFilePath) :
+				mFile(aCacheFilePath),
+				mStreambuf(mFile.data(), mFile.data() + mFile.size(), mFile.data()),
+				mIstream(&mStreambuf),
+				mArchive(mIstream)
+			{}
+
+			/* Construct from other deserialize_memory_mapped; the mapping's address does not change */
+			deserialize_memory_mapped(deserialize_memory_mapped&& aOther) noexcept :
+				mFile(std::move(aOther.mFile)),
+				mStreambuf(mFile.data(), mFile.data() + mFile.size(), aOther.mStreambuf.current()),
+				mIstream(&mStreambuf),
+				mArchive(mIstream)
+			{}
+
+			deserialize_memory_mapped(const deserialize_memory_mapped&) = delete;
+			/* The archive refers to mIstream and can not be re-seated or move-assigned */
+			deserialize_memory_mapped& operator=(deserialize_memory_mapped&&) = delete;
+			deserialize_memory_mapped& operator=(const deserialize_memory_mapped&) = delete;
+			~deserialize_memory_mapped() = default;
+
+			/** @brief Deserializes an Object
+			 *
+			 *  This function deserializes the object from the memory mapped file.
+			 *
+			 *  @param[in] aValue The object to fill from file
+			 */
+			template<typename Type>
+			void operator()(Type&& aValue)
+			{
+				mArchive(std::forward<Type>(aValue));
+			}
+
+			/** @brief Returns a view of the next block of raw memory inside of the mapping
+			 *
+			 *  @param[in] aSize The number of bytes to consume
+			 */
+			std::span<const std::byte> view(size_t aSize)
+			{
+				if (aSize > mStreambuf.remaining()) {
+					throw avk::runtime_error(std::format("Failed to read {} bytes from memory mapped cache file. Only {} bytes remaining.", aSize, mStreambuf.remaining()));
+				}
+				std::span<const std::byte> result{ mStreambuf.current(), aSize };
+				mStreambuf.advance(aSize);
+				return result;
+			}
 		};
 
-		std::variant<deserialize, serialize> mArchive;
+		using archive_variant = std::variant<deserialize, serialize, deserialize_memory_mapped>;
+		archive_variant mArchive;
 	};
 }
 
@@ -427,6 +600,30 @@ namespace avk {
 		aArchive(aValue.mName, aValue.mTranslation, aValue.mScaling, aValue.mRotation);
 	}
 
+	template<typename Archive>
+	void serialize(Archive& aArchive, avk::octahedral_2x16& aValue)
+	{
+		aArchive(aValue.mValue.x, aValue.mValue.y);
+	}
+
+	template<typename Archive>
+	void serialize(Archive& aArchive, avk::half_2x16& aValue)
+	{
+		aArchive(aValue.mValue.x, aValue.mValue.y);
+	}
+
+	template<typename Archive>
+	void serialize(Archive& aArchive, avk::quantized_position_4x16& aValue)
+	{
+		aArchive(aValue.mValue.x, aValue.mValue.y, aValue.mValue.z, aValue.mValue.w);
+	}
+
+	template<typename Archive>
+	void serialize(Archive& aArchive, avk::position_dequantization& aValue)
+	{
+		aArchive(aValue.mScale, aValue.mOffset);
+	}
+
 	template<typename Archive>
 	void serialize(Archive& aArchive, avk::material_gpu_data& aValue)
 	{
@@ -567,6 +764,7 @@ namespace avk {
 	void serialize(Archive& aArchive, avk::animated_node& aValue)
 	{
 		aArchive(
+			aValue.mNodeName,
 			aValue.mPositionKeys,
 			aValue.mRotationKeys,
 			aValue.mScalingKeys,
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "frame_task_graph.hpp"
+#include "timer_frame_type.hpp"
+#include "context_vulkan.hpp"
+
+namespace avk
+{
+	/**	@brief Handle @ref invokee as tasks of a frame_task_graph!
+	 *
+	 *	Builds one frame_task_graph per frame from the invokees' declared resource accesses (see
+	 *	invokee::declare_update_access and invokee::declare_render_access), and executes it on a parallel_invoker.
+	 *	Pass it to composition::start_render_loop instead of an update and a render callback.
+	 *
+	 *	The render tasks of a frame are:
+	 *	 - window::sync_before_render for all windows,
+	 *	 - one task per invokee which applies its updater's recreation updates and invokes render(),
+	 *	 - window::render_frame for all windows.
+	 *	They are executed on the composition's thread, and all of them write the resource sWindowsResource, which
+	 *	orders them. The update tasks of a frame are one task per enabled invokee's update(), followed by a task which
+	 *	signals that all updates are done. An update() task which declares its accesses is executed on any thread;
+	 *	invokees which do not declare anything are updated on the composition's thread, as by sequential_invoker.
+	 *	The last task of each graph swaps the input buffers, after all other tasks.
+	 *
+	 *	With frame overlap enabled (the default), the graph of frame N contains the render tasks of frame N-1 followed
+	 *	by the update tasks of frame N. Conflicting tasks are executed in the order in which they have been added, i.e.,
+	 *	an update() of frame N waits for all render() calls of frame N-1 which access the same resources, and
+	 *	declared updates which do not access sWindowsResource overlap with waiting for the windows' fences, with the
+	 *	render() calls, and with the submission of frame N-1. Therefore, render() observes the time and input of the
+	 *	frame after the one whose update() it renders. When the composition stops, the render tasks of the last
+	 *	updated frame are not executed.
+	 *	Without frame overlap, the graph of frame N contains its update tasks, followed by its render tasks, which
+	 *	do not start before the updates done task.
+	 */
+	class task_graph_invoker
+	{
+	public:
+		/** The resource which represents windows and queue submissions */
+		static constexpr const char* sWindowsResource = "avk::windows";
+
+		/** The resource which represents the current input buffer, which is written when swapping the input buffers */
+		static constexpr const char* sInputResource = "avk::input";
+
+		/**	Creates the worker threads.
+		 *	@param	aMaxThreads		Maximum number of threads to use, including the composition's thread.
+		 *	@param	aOverlapFrames	If true, the update tasks of a frame overlap with the render tasks of the previous one.
+		 */
+		explicit task_graph_invoker(size_t aMaxThreads = parallel_for_max_threads(), bool aOverlapFrames = true);
+
+		/**	Builds and executes the graph of one frame.
+		 *	@param	aElements					All invokees, sorted by their execution order
+		 *	@param	aFrameType					Determines if update() and/or render() tasks are added
+		 *	@param	aUpdatesDone				Invoked after all update() tasks have finished
+		 *	@param	aSwapInputBuffers			Invoked on the calling thread after all other tasks have finished
+		 */
+		void invoke_frame(const std::vector<invokee*>& aElements, timer_frame_type aFrameType, const std::function<void()>& aUpdatesDone, const std::function<void()>& aSwapInputBuffers);
+
+		/** The graph of the most recent frame */
+		const frame_task_graph& last_frame_graph() const { return mGraph; }
+
+	private:
+		frame_task_graph::task_id add_update_tasks(const std::vector<invokee*>& aElements, const std::function<void()>& aUpdatesDone);
+		void add_render_tasks(const std::vector<invokee*>& aElements, std::optional<frame_task_graph::task_id> aUpdatesDone);
+
+		parallel_invoker mInvoker;
+		frame_task_graph mGraph;
+		bool mOverlapFrames;
+		// The invokees whose render() calls are pending, if the previous frame contained render tasks:
+		std::optional<std::vector<invokee*>> mPendingRender;
+	};
+}
@@ -36,12 +36,20 @@ namespace avk
 
 		/** returns the local transformation matrix, disregarding parent transforms */
 		glm::mat4 local_transformation_matrix() const;
-		/** Returns the inverse of the local transformation matrix. This can be used to change basis into this transform's coordinate system. */
+		/** Returns the inverse of the local transformation matrix. This can be used to change basis into this transform's coordinate system.
+		 *  It is cached. Like all const getters, it may be invoked from multiple threads concurrently, as long as no thread modifies the transform at the same time. */
 		glm::mat4 inverse_local_transformation_matrix() const;
-		/** returns the global transformation matrix, taking parent transforms into account */
+		/** returns the global transformation matrix, taking parent transforms into account.
+		 *  It is cached and only recomputed after this transform or one of its parents has been modified.
+		 *  It may be invoked from multiple threads concurrently (e.g., from render() calls which run in parallel),
+		 *  as long as no thread modifies this transform or one of its parents at the same time. */
 		glm::mat4 global_transformation_matrix() const;
-		/** returns the inverse of the global transformation matrix */
+		/** returns the inverse of the global transformation matrix, which is cached as well. Concurrent invocations are fine, see global_transformation_matrix */
 		glm::mat4 inverse_global_transformation_matrix() const;
+		/** Returns a number which changes whenever the global transformation matrix has changed, i.e., after this
+		 *  transform or one of its parents has been modified. It can be used to detect if derived data must be updated.
+		 *  Concurrent invocations are fine, see global_transformation_matrix */
+		uint64_t global_transformation_version() const;
 
 		/** Gets the matrix' x-axis, which can be seen as the local right vector */
 		glm::vec3 x_axis() const { return mMatrix[0]; }
@@ -80,12 +88,17 @@ namespace avk
 		void update_matrix_from_transforms();
 		/** Extracts translation, rotation and scale from the matrix and sets the internal fields' values */ 
 		void update_transforms_from_matrix();
+		/** Marks the cached global matrices of this transform and of all its child transforms as outdated */
+		void invalidate_global_matrices();
+		/** Recomputes the cached global matrix if it is outdated */
+		void update_global_matrix_if_outdated() const;
 
 	protected:
 		/** Orthogonal basis + translation in a 4x4 matrix */
 		glm::mat4 mMatrix;
-		/** The inverse of mMatrix */
-		glm::mat4 mInverseMatrix;
+		/** The inverse of mMatrix, computed lazily */
+		mutable glm::mat4 mInverseMatrix;
+		mutable std::atomic<bool> mInverseMatrixOutdated = true;
 		/** Offset from the coordinate origin */
 		glm::vec3 mTranslation;
 		/** Rotation quaternion */
@@ -97,6 +110,21 @@ namespace avk
 		transform::ptr mParent;
 		/** List of child transforms */
 		std::vector<transform::ptr> mChilds;
+
+		// The cached matrices are computed at most once by concurrent readers: The outdated flags are checked without
+		// locking, and the cached matrices are only written while mCacheMutex is held and the respective flag is set.
+		/** Guards the computation of the cached matrices. Not copied or moved along with the transform. */
+		mutable std::mutex mCacheMutex;
+		/** Cached result of global_transformation_matrix() */
+		mutable glm::mat4 mGlobalMatrix;
+		/** Cached result of inverse_global_transformation_matrix() */
+		mutable glm::mat4 mInverseGlobalMatrix;
+		/** Set if this transform or one of its parents has been modified since mGlobalMatrix has been computed.
+		 *  If set, it is set for all child transforms, too. */
+		mutable std::atomic<bool> mGlobalMatrixOutdated = true;
+		mutable std::atomic<bool> mInverseGlobalMatrixOutdated = true;
+		/** Incremented whenever mGlobalMatrix is recomputed */
+		mutable uint64_t mGlobalVersion = 0;
 	};
 
 	static inline glm::mat4 matrix_from_transforms(glm::vec3 aTranslation, glm::quat aRotation, glm::vec3 aScale)
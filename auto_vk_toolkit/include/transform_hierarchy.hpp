@@ -0,0 +1,171 @@
+#pragma once
+
+#include "transform.hpp"
+#include "parallel_for.hpp"
+
+namespace avk
+{
+	/**	A hierarchy of transforms which is stored in contiguous arrays, as an alternative to linking avk::transform
+	 *	instances via attach_transform. Local translations, rotations, and scales, the parent indices, and the cached
+	 *	global transformation matrices are stored in separate arrays in depth-first order, i.e., every node is stored
+	 *	after its parent, and all nodes of a subtree are stored contiguously.
+	 *
+	 *	Modifying a node only marks it as dirty. update() recomputes the global transformation matrices of all dirty
+	 *	nodes and of their descendants in one linear pass over the arrays, optionally in parallel for different
+	 *	subtrees. Structural modifications (add, remove, set_parent) are applied by the next update(), too, which
+	 *	restores the depth-first order.
+	 *
+	 *	Nodes are referenced via handles, which remain valid until the node is removed. A handle's index into the
+	 *	arrays, however, can change with every update() that has to apply structural modifications.
+	 */
+	class transform_hierarchy
+	{
+	public:
+		/** Identifies a node of a transform_hierarchy */
+		using handle = uint32_t;
+
+		/** The value which is used for "no parent" */
+		static constexpr uint32_t sNone = std::numeric_limits<uint32_t>::max();
+
+		/** Subtrees with at most this many nodes are not split into multiple tasks by update(). */
+		static constexpr size_t sMinNodesPerTask = 4096;
+
+		transform_hierarchy() = default;
+		transform_hierarchy(transform_hierarchy&&) noexcept = default;
+		transform_hierarchy(const transform_hierarchy&) = default;
+		transform_hierarchy& operator=(transform_hierarchy&&) noexcept = default;
+		transform_hierarchy& operator=(const transform_hierarchy&) = default;
+		~transform_hierarchy() = default;
+
+		/**	Adds a new node to the hierarchy.
+		 *	@param	aParent			Handle of the parent node, or sNone for a root node
+		 *	@param	aTranslation	Local translation
+		 *	@param	aRotation		Local rotation
+		 *	@param	aScale			Local scale
+		 *	@return	The handle of the new node
+		 */
+		handle add(handle aParent = sNone, glm::vec3 aTranslation = { 0.f, 0.f, 0.f }, glm::quat aRotation = { 1.f, 0.f, 0.f, 0.f }, glm::vec3 aScale = { 1.f, 1.f, 1.f });
+
+		/**	Adds a new node to the hierarchy with the local translation, rotation, and scale of the given transform.
+		 *	The given transform's parent and child transforms are not considered.
+		 *	@param	aParent			Handle of the parent node, or sNone for a root node
+		 *	@param	aTransform		The transform to copy the local values from
+		 *	@return	The handle of the new node
+		 */
+		handle add(handle aParent, const transform& aTransform);
+
+		/**	Removes the given node, whose handle becomes invalid immediately. The next update() removes it from the
+		 *	arrays, together with all nodes which are still descendants of it at that time, and invalidates their handles.
+		 *	@param	aNode			Handle of the node to remove
+		 */
+		void remove(handle aNode);
+
+		/**	Assigns a new parent to the given node. Its descendants move with it.
+		 *	@param	aNode			Handle of the node
+		 *	@param	aParent			Handle of the new parent node, or sNone to turn aNode into a root node.
+		 *							Must not be aNode or one of its descendants.
+		 */
+		void set_parent(handle aNode, handle aParent);
+
+		/** Returns the handle of the given node's parent, or sNone */
+		handle parent(handle aNode) const;
+
+		/** Returns true if the given handle refers to a node of this hierarchy */
+		bool contains(handle aNode) const;
+
+		/** The number of nodes */
+		size_t size() const { return mNumNodes; }
+
+		/** Sets a new local translation */
+		void set_translation(handle aNode, const glm::vec3& aValue);
+		/** Sets a new local rotation */
+		void set_rotation(handle aNode, const glm::quat& aValue);
+		/** Sets a new local scale */
+		void set_scale(handle aNode, const glm::vec3& aValue);
+		/** Sets a new local transformation matrix, which is decomposed into translation, rotation, and scale */
+		void set_matrix(handle aNode, const glm::mat4& aValue);
+
+		/** Gets the local translation */
+		glm::vec3 translation(handle aNode) const { return mTranslations[index_of(aNode)]; }
+		/** Gets the local rotation */
+		glm::quat rotation(handle aNode) const { return mRotations[index_of(aNode)]; }
+		/** Gets the local scale */
+		glm::vec3 scale(handle aNode) const { return mScales[index_of(aNode)]; }
+
+		/** Returns the local transformation matrix, disregarding parent transforms */
+		glm::mat4 local_transformation_matrix(handle aNode) const;
+
+		/**	Returns the global transformation matrix, taking parent transforms into account.
+		 *	It reflects the state of the last update(), i.e., modifications since then are not considered.
+		 */
+		const glm::mat4& global_transformation_matrix(handle aNode) const { return mGlobalMatrices[index_of(aNode)]; }
+
+		/**	Recomputes the global transformation matrices of all nodes which have been modified since the last update,
+		 *	and of all of their descendants. If nodes have been added, removed, or re-parented, the arrays are
+		 *	reordered first.
+		 *	@param	aMaxThreads		Maximum number of threads to use, including the calling thread. Subtrees with more
+		 *							than sMinNodesPerTask nodes are split into multiple tasks.
+		 *	@return	The number of global transformation matrices which have been recomputed
+		 */
+		size_t update(size_t aMaxThreads = parallel_for_max_threads());
+
+		/**	Returns the index of the given node into the arrays, e.g., into global_transformation_matrices().
+		 *	Indices are valid until the next update() which has to apply structural modifications.
+		 */
+		uint32_t index_of(handle aNode) const
+		{
+			assert(contains(aNode));
+			return mIndexOfHandle[aNode];
+		}
+
+		/** Returns the handle of the node at the given index into the arrays */
+		handle handle_at(uint32_t aIndex) const { return mHandleAtIndex[aIndex]; }
+
+		/**	The global transformation matrices of all nodes in depth-first order, as of the last update().
+		 *	This can be uploaded into a buffer directly.
+		 */
+		std::span<const glm::mat4> global_transformation_matrices() const { return mGlobalMatrices; }
+
+		/** The parent indices of all nodes in the order of global_transformation_matrices(), or sNone for root nodes. */
+		std::span<const uint32_t> parent_indices() const { return mParentIndices; }
+
+	private:
+		/** Marks the node at the given index as dirty */
+		void mark_dirty(uint32_t aIndex) { mDirty[aIndex] = 1; }
+		/** Restores the depth-first order and removes the nodes which have been removed */
+		void apply_structural_changes();
+		/** Splits the nodes into a sequential prefix and independent subtree tasks for the given number of threads */
+		void build_tasks(size_t aMaxThreads);
+		/** Updates the global matrices of the nodes in [aBegin, aEnd), whose parents outside this range must be up to date */
+		size_t update_range(uint32_t aBegin, uint32_t aEnd);
+
+		// One entry per node, in depth-first order (after update()):
+		std::vector<glm::vec3> mTranslations;
+		std::vector<glm::quat> mRotations;
+		std::vector<glm::vec3> mScales;
+		std::vector<glm::mat4> mGlobalMatrices;
+		std::vector<uint32_t> mParentIndices;
+		/** Number of nodes of the subtree, including the node itself */
+		std::vector<uint32_t> mSubtreeSizes;
+		/** Set if the local values have been modified, or if the node has been added or re-parented */
+		std::vector<uint8_t> mDirty;
+		/** Set if the node has been removed */
+		std::vector<uint8_t> mRemoved;
+		std::vector<handle> mHandleAtIndex;
+
+		/** One entry per handle, or sNone for unused handles */
+		std::vector<uint32_t> mIndexOfHandle;
+		std::vector<handle> mFreeHandles;
+		size_t mNumNodes = 0;
+
+		/** Set by add, remove, and set_parent */
+		bool mStructureChanged = false;
+
+		/** Indices of nodes which are updated sequentially, before the subtree tasks */
+		std::vector<uint32_t> mSequentialNodes;
+		/** Index ranges [first, second) of subtrees which are updated in parallel */
+		std::vector<std::pair<uint32_t, uint32_t>> mTasks;
+		/** The number of threads which mSequentialNodes and mTasks have been built for, or 0 if they must be rebuilt */
+		size_t mTasksBuiltForThreads = 0;
+	};
+}
@@ -1,8 +1,14 @@
 #pragma once
 #include "window_base.hpp"
+#include "gpu_profiler.hpp"
 
 namespace avk
 {
+	// Number of frames whose latencies are kept by every window, see window::recent_frame_latencies:
+	#if !defined(WINDOW_FRAME_LATENCY_HISTORY_LENGTH)
+	#define WINDOW_FRAME_LATENCY_HISTORY_LENGTH 120
+	#endif
+
 	class window : public window_base
 	{
 		friend class context_generic_glfw;
@@ -20,6 +26,26 @@ namespace avk
 		};
 
 		using frame_id_t = int64_t;
+
+		/**	The CPU timings of one frame, from waiting for its frame in flight's fence until its image has been handed
+		 *	over to the presentation engine. All durations are in milliseconds. If the fence wait or the acquire
+		 *	dominate, the GPU or the presentation engine are the bottleneck, and more frames in flight can increase
+		 *	the throughput, but also the latency between input and the presented image.
+		 */
+		struct frame_latency
+		{
+			frame_id_t mFrameId;
+			/** Waiting for the frame in flight's fence, i.e., for the GPU to finish the frame which has used it before */
+			double mFenceWaitMs;
+			/** Acquiring the swap chain image, including potential swap chain recreations */
+			double mAcquireMs;
+			/** From the acquired image until render_frame, i.e., mostly the recording of the frame's commands */
+			double mAcquireToSubmitMs;
+			/** From the begin of render_frame until vkQueuePresentKHR has returned */
+			double mSubmitToPresentMs;
+			/** Whether the image has been acquired on the helper thread, see enable_pipelined_acquire */
+			bool mPipelinedAcquire;
+		};
 		using outdated_swapchain_t = std::tuple<vk::UniqueHandle<vk::SwapchainKHR, DISPATCH_LOADER_CORE_TYPE>, std::vector<avk::image_view>, avk::renderpass, std::vector<avk::framebuffer>>;
 		
 		using any_window_resource_t = std::variant<
@@ -59,6 +85,9 @@ namespace avk
 		window& operator =(const window&) = delete;
 		~window()
 		{
+			finish_pending_pipelined_acquire();
+			mPipelinedAcquire.reset();
+			mGpuProfiler.reset();
 			mCurrentFrameFinishedFence.reset();
 			mCurrentFrameImageAvailableSemaphore.reset();
 			mLifetimeHandledResources.clear();
@@ -362,6 +391,35 @@ namespace avk
 		 */
 		void render_frame();
 
+		/**	Enables measuring the GPU time of named zones of this window's frames, see gpu_profiler.
+		 *	Invoke it before the composition is started, or from within render().
+		 *	@param	aMaxZonesPerFrame	Maximum number of zones per frame
+		 *	@return	The window's GPU profiler, which is created by the first invocation
+		 */
+		gpu_profiler& enable_gpu_profiling(uint32_t aMaxZonesPerFrame = GPU_PROFILE_MAX_ZONES_PER_FRAME);
+
+		/** Returns the window's GPU profiler, or nullptr if enable_gpu_profiling has not been invoked */
+		[[nodiscard]] gpu_profiler* get_gpu_profiler() const { return mGpuProfiler.get(); }
+
+		/**	Enables or disables acquiring the swap chain image of the next frame on a helper thread, which is started
+		 *	right after render_frame has presented the current frame. Waiting for the next frame's fence and for
+		 *	vkAcquireNextImageKHR then overlaps with the work which happens in between, e.g., the update() calls of
+		 *	the next frame, and sync_before_render only has to pick up the result.
+		 *	The image is not acquired early if any changes to the swap chain are pending. Changes which are requested
+		 *	while an early acquire is in progress take effect one frame later.
+		 *	current_image_index() is still only updated by sync_before_render.
+		 *	@param	aEnable		True to enable, false to go back to acquiring in sync_before_render
+		 */
+		void enable_pipelined_acquire(bool aEnable);
+
+		/** Returns whether swap chain images are acquired on a helper thread, see enable_pipelined_acquire */
+		[[nodiscard]] bool is_pipelined_acquire_enabled() const { return mPipelinedAcquireEnabled; }
+
+		/**	Returns the timings of the most recent WINDOW_FRAME_LATENCY_HISTORY_LENGTH frames, oldest first.
+		 *	Must be invoked on the thread which renders, e.g., from within render().
+		 */
+		[[nodiscard]] const std::deque<frame_latency>& recent_frame_latencies() const { return mRecentFrameLatencies; }
+
 		/**	Gets the handle of the renderpass.
 		 */
 		auto renderpass_handle() const { return mBackBufferRenderpass->handle(); }
@@ -493,6 +551,15 @@ namespace avk
 		// If the swap chain must be re-created, it will recursively invoke itself.
 		void acquire_next_swap_chain_image_and_prepare_semaphores();
 
+		// Invokes vkAcquireNextImageKHR, which signals the given semaphore. An out of date swap chain is returned as
+		// vk::Result::eErrorOutOfDateKHR instead of being thrown. Does not access any of the window's members,
+		// s.t. it can be used on the helper thread of the pipelined acquire.
+		static vk::Result acquire_swap_chain_image(vk::SwapchainKHR aSwapChain, const avk::semaphore_t& aImageAvailableSemaphore, uint32_t& aImageIndex);
+
+		// Handles the result of acquire_swap_chain_image for the current frame, i.e., recreates the swap chain
+		// and acquires again if necessary, or makes the acquired image the current one.
+		void complete_swap_chain_image_acquisition(vk::Result aResult, uint32_t aImageIndex, avk::semaphore aImageAvailableSemaphore);
+
 		// Helper method that fills the given 2 vectors with the present semaphore dependencies for the given frame-id
 		void fill_in_present_semaphore_dependencies_for_frame(std::vector<vk::Semaphore>& aSemaphores, frame_id_t aFrameId) const;
 
@@ -554,6 +621,8 @@ namespace avk
 		std::vector<avk::semaphore> mImageAvailableSemaphores;
 		// Fences to make sure that no two images are written into concurrently
 		std::vector<int> mImagesInFlightFenceIndices;
+		// The inverse of mImagesInFlightFenceIndices: The image which has been presented with each fence, or -1
+		std::vector<int> mFencesInFlightImageIndices;
 
 		// Semaphores to be waited on before presenting the image PER FRAME.
 		// The first element in the tuple refers to the frame id which is affected.
@@ -561,6 +630,76 @@ namespace avk
 		std::vector<std::tuple<frame_id_t, avk::semaphore>> mPresentSemaphoreDependencies;
 #pragma endregion
 
+		// Measures GPU zones, with one query pool per frame in flight. Only set if enable_gpu_profiling has been invoked.
+		std::unique_ptr<gpu_profiler> mGpuProfiler;
+
+		/** Waits for a fence and acquires a swap chain image on its own thread, see enable_pipelined_acquire */
+		class pipelined_acquire
+		{
+		public:
+			/** The outcome of one early acquire, with timestamps as returned by cpu_profile_now_ns */
+			struct result
+			{
+				vk::Result mResult;
+				uint32_t mImageIndex;
+				int64_t mFenceWaitBeginNs;
+				int64_t mAcquireBeginNs;
+				int64_t mAcquireEndNs;
+				// The semaphore which has been passed to start, i.e., which the acquire signals unless it has failed:
+				std::optional<avk::semaphore> mImageAvailableSemaphore;
+			};
+
+			pipelined_acquire();
+			pipelined_acquire(pipelined_acquire&&) = delete;
+			pipelined_acquire(const pipelined_acquire&) = delete;
+			pipelined_acquire& operator=(pipelined_acquire&&) = delete;
+			pipelined_acquire& operator=(const pipelined_acquire&) = delete;
+			~pipelined_acquire();
+
+			/** Starts waiting for aFence, and then acquiring an image of aSwapChain, which signals aImageAvailableSemaphore */
+			void start(avk::fence aFence, avk::semaphore aImageAvailableSemaphore, vk::SwapchainKHR aSwapChain);
+
+			/**	Waits for the acquire which has been started last, and returns its result. Returns nothing if none has been started since the previous invocation.
+			 *	If waiting for the fence or acquiring has thrown on the helper thread, the exception is rethrown here.
+			 */
+			std::optional<result> finish();
+
+		private:
+			void worker_main();
+
+			std::thread mThread;
+			std::mutex mMutex;
+			std::condition_variable mCondVar;
+			std::optional<avk::fence> mFence;
+			std::optional<avk::semaphore> mImageAvailableSemaphore;
+			vk::SwapchainKHR mSwapChain;
+			bool mStarted = false;
+			std::optional<result> mResult;
+			std::exception_ptr mException;
+			bool mStop = false;
+		};
+
+		/**	Waits until the GPU has consumed aSemaphore, which must be signalled or have a signal operation pending,
+		 *	by submitting nothing but a wait on it to the presentation queue.
+		 */
+		void wait_for_semaphore_on_presentation_queue(const avk::semaphore_t& aSemaphore);
+
+		/**	Finishes an early acquire which has not been picked up by sync_before_render, and waits on the semaphore
+		 *	it has signalled, s.t. the semaphore may be destroyed afterwards. Does not throw.
+		 */
+		void finish_pending_pipelined_acquire() noexcept;
+
+		bool mPipelinedAcquireEnabled = false;
+		// Created by the first enable_pipelined_acquire(true), and kept afterwards, s.t. a pending acquire is always picked up.
+		std::unique_ptr<pipelined_acquire> mPipelinedAcquire;
+
+		// Timings of the current frame, which are turned into a frame_latency by render_frame. Timestamps are as returned by cpu_profile_now_ns.
+		double mFenceWaitMs = 0.0;
+		int64_t mAcquireBeginNs = 0;
+		int64_t mAcquireEndNs = 0;
+		bool mCurrentFrameAcquiredEarly = false;
+		std::deque<frame_latency> mRecentFrameLatencies;
+
 		// The renderpass used for the back buffers
 		avk::renderpass mBackBufferRenderpass;
 
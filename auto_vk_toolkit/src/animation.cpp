@@ -100,6 +100,98 @@ namespace avk
 		return localTransform;
 	}
 
+	void animation::compute_local_transforms(double aTimeInTicks, animation_playback_state& aPlaybackState) const
+	{
+		auto& s = aPlaybackState.mScratch;
+		const auto n = mAnimationData.size();
+		s.mLocalTransforms.resize(n);
+		if (aPlaybackState.mKeyCursors.size() != n) {
+			aPlaybackState.mKeyCursors.assign(n, { 0, 0, 0 });
+		}
+		s.mKeyedNodes.clear();
+		for (int c = 0; c < 3; ++c) {
+			s.mTranslationsFrom[c].clear(); s.mTranslationsTo[c].clear();
+			s.mScalingsFrom[c].clear();     s.mScalingsTo[c].clear();
+		}
+		s.mTranslationFactors.clear();
+		s.mRotationsFrom.clear(); s.mRotationsTo.clear();
+		s.mRotationFactors.clear();
+		s.mScalingFactors.clear();
+
+		// Stage 1: Find the keys of all nodes, and gather their values (same as in compute_node_local_transform):
+		for (size_t i = 0; i < n; ++i) {
+			const auto& anode = mAnimationData[i];
+			if (anode.mPositionKeys.size() + anode.mRotationKeys.size() + anode.mScalingKeys.size() == 0) {
+				s.mLocalTransforms[i] = anode.mLocalTransform;
+				continue;
+			}
+			s.mKeyedNodes.push_back(i);
+			auto& cursors = aPlaybackState.mKeyCursors[i];
+
+			auto [tpos1, tpos2] = find_positions_in_keys(anode.mPositionKeys, aTimeInTicks, cursors[0]);
+			s.mTranslationFactors.push_back(get_interpolation_factor(anode.mPositionKeys[tpos1], anode.mPositionKeys[tpos2], aTimeInTicks));
+			for (int c = 0; c < 3; ++c) {
+				s.mTranslationsFrom[c].push_back(anode.mPositionKeys[tpos1].mValue[c]);
+				s.mTranslationsTo[c].push_back(anode.mPositionKeys[tpos2].mValue[c]);
+			}
+
+			size_t rpos1 = tpos1, rpos2 = tpos2;
+			if (!anode.mSameRotationAndPositionKeyTimes) {
+				std::tie(rpos1, rpos2) = find_positions_in_keys(anode.mRotationKeys, aTimeInTicks, cursors[1]);
+			}
+			s.mRotationFactors.push_back(get_interpolation_factor(anode.mRotationKeys[rpos1], anode.mRotationKeys[rpos2], aTimeInTicks));
+			s.mRotationsFrom.push_back(anode.mRotationKeys[rpos1].mValue);
+			s.mRotationsTo.push_back(anode.mRotationKeys[rpos2].mValue);
+
+			size_t spos1 = tpos1, spos2 = tpos2;
+			if (!anode.mSameScalingAndPositionKeyTimes) {
+				std::tie(spos1, spos2) = find_positions_in_keys(anode.mScalingKeys, aTimeInTicks, cursors[2]);
+			}
+			s.mScalingFactors.push_back(get_interpolation_factor(anode.mScalingKeys[spos1], anode.mScalingKeys[spos2], aTimeInTicks));
+			for (int c = 0; c < 3; ++c) {
+				s.mScalingsFrom[c].push_back(anode.mScalingKeys[spos1].mValue[c]);
+				s.mScalingsTo[c].push_back(anode.mScalingKeys[spos2].mValue[c]);
+			}
+		}
+
+		// Stage 2: Interpolate the translations and scalings component-wise. glm::lerp on vectors
+		// interpolates every component with the same formula, hence the results are identical.
+		const auto k = s.mKeyedNodes.size();
+		for (int c = 0; c < 3; ++c) {
+			s.mTranslations[c].resize(k);
+			s.mScalings[c].resize(k);
+			const float* tFrom = s.mTranslationsFrom[c].data();
+			const float* tTo   = s.mTranslationsTo[c].data();
+			const float* tf    = s.mTranslationFactors.data();
+			float*       tDst  = s.mTranslations[c].data();
+			for (size_t j = 0; j < k; ++j) {
+				tDst[j] = glm::lerp(tFrom[j], tTo[j], tf[j]);
+			}
+			const float* sFrom = s.mScalingsFrom[c].data();
+			const float* sTo   = s.mScalingsTo[c].data();
+			const float* sf    = s.mScalingFactors.data();
+			float*       sDst  = s.mScalings[c].data();
+			for (size_t j = 0; j < k; ++j) {
+				sDst[j] = glm::lerp(sFrom[j], sTo[j], sf[j]);
+			}
+		}
+
+		// Stage 3: Interpolate the rotations:
+		s.mRotations.resize(k);
+		for (size_t j = 0; j < k; ++j) {
+			s.mRotations[j] = glm::normalize(glm::slerp(s.mRotationsFrom[j], s.mRotationsTo[j], s.mRotationFactors[j])); // use slerp, not lerp or mix (those lead to jerks)
+		}
+
+		// Stage 4: Compose the local transformation matrices:
+		for (size_t j = 0; j < k; ++j) {
+			s.mLocalTransforms[s.mKeyedNodes[j]] = matrix_from_transforms(
+				glm::vec3{ s.mTranslations[0][j], s.mTranslations[1][j], s.mTranslations[2][j] },
+				s.mRotations[j],
+				glm::vec3{ s.mScalings[0][j], s.mScalings[1][j], s.mScalings[2][j] }
+			);
+		}
+	}
+
 	glm::vec3 animation::compute_inverse_node_local_translation(const animated_node& aNode, double aTimeInTicks) const
 	{
 		glm::vec3 inverseLocalTranslation;
@@ -268,6 +360,57 @@ namespace avk
 		}
 	}
 
+	void animation::animate_instance_into_single_target_buffer(const animation_clip_data& aClip, double aTime, animation_playback_state& aPlaybackState, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory) const
+	{
+		if (aClip.mTicksPerSecond == 0.0) {
+			throw avk::runtime_error("animation_clip_data::mTicksPerSecond may not be 0.0 => set a different value!");
+		}
+		if (aClip.mAnimationIndex != mAnimationIndex) {
+			throw avk::runtime_error("The animation index of the passed animation_clip_data is not the same that was used to create this animation.");
+		}
+		if (aTargetSpace != bone_matrices_space::mesh_space && aTargetSpace != bone_matrices_space::model_space) {
+			throw avk::runtime_error("Unknown target space value.");
+		}
+
+		double timeInTicks = aTime * aClip.mTicksPerSecond;
+		compute_local_transforms(timeInTicks, aPlaybackState);
+
+		// Same as animate, but the global transforms are stored in the playback state:
+		const auto an = mAnimationData.size();
+		auto& globalTransforms = aPlaybackState.mGlobalTransforms;
+		globalTransforms.resize(an);
+		for (size_t ai = 0; ai < an; ++ai) {
+			const auto& anode = mAnimationData[ai];
+			const auto& localTransform = aPlaybackState.mScratch.mLocalTransforms[ai];
+			if (anode.mAnimatedParentIndex.has_value()) {
+				globalTransforms[ai] = globalTransforms[anode.mAnimatedParentIndex.value()] * anode.mParentTransform * localTransform;
+			}
+			else {
+				globalTransforms[ai] = anode.mParentTransform * localTransform;
+			}
+
+			for (const auto& target : anode.mBoneMeshTargets) {
+				const auto& info = target.mMeshBoneInfo;
+				if (bone_matrices_space::mesh_space == aTargetSpace) {
+					aTargetMemory[info.mGlobalBoneIndexOffset + info.mMeshLocalBoneIndex] = target.mInverseMeshRootMatrix * globalTransforms[ai] * target.mInverseBindPoseMatrix;
+				}
+				else {
+					aTargetMemory[info.mGlobalBoneIndexOffset + info.mMeshLocalBoneIndex] = globalTransforms[ai] * target.mInverseBindPoseMatrix;
+				}
+			}
+		}
+	}
+
+	void animation::animate_instances(const animation_clip_data& aClip, std::span<const double> aTimes, std::span<animation_playback_state> aPlaybackStates, std::span<glm::mat4* const> aTargetMemories, bone_matrices_space aTargetSpace, size_t aMaxThreads) const
+	{
+		if (aTimes.size() != aPlaybackStates.size() || aTimes.size() != aTargetMemories.size()) {
+			throw avk::runtime_error(std::format("animate_instances requires the same number of times ({}), playback states ({}), and target memories ({}).", aTimes.size(), aPlaybackStates.size(), aTargetMemories.size()));
+		}
+		parallel_for(aTimes.size(), [&](size_t i) {
+			animate_instance_into_single_target_buffer(aClip, aTimes[i], aPlaybackStates[i], aTargetSpace, aTargetMemories[i]);
+		}, aMaxThreads);
+	}
+
 	std::vector<double> animation::animation_key_times_for_clip_in_ticks(const animation_clip_data& aClip) const
 	{
 		const double cMachineEpsilon = 2.3e-16;
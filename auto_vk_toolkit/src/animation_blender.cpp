@@ -0,0 +1,204 @@
+#include <glm/gtx/quaternion.hpp>
+
+#include "animation_blender.hpp"
+#include "transform.hpp"
+
+namespace avk
+{
+	namespace
+	{
+		/** The per-component ratio of a scale to a reference scale, which is 1 where the reference scale is (nearly) zero */
+		glm::vec3 scale_ratio(const glm::vec3& aScale, const glm::vec3& aReferenceScale)
+		{
+			constexpr float cMinReferenceScale = 1e-6f;
+			const auto nearlyZero = glm::lessThan(glm::abs(aReferenceScale), glm::vec3{ cMinReferenceScale });
+			return glm::mix(aScale / glm::mix(aReferenceScale, glm::vec3{ 1.f }, nearlyZero), glm::vec3{ 1.f }, nearlyZero);
+		}
+	}
+
+	animation_blender::animation_blender(const animation& aSkeleton)
+		: mSkeleton{ &aSkeleton }
+	{
+	}
+
+	size_t animation_blender::add_layer(const animation& aAnimation, const animation_clip_data& aClip, float aWeight, animation_layer_mode aMode)
+	{
+		if (aClip.mTicksPerSecond == 0.0) {
+			throw avk::runtime_error("animation_clip_data::mTicksPerSecond may not be 0.0 => set a different value!");
+		}
+
+		auto& l = mLayers.emplace_back();
+		l.mAnimation = &aAnimation;
+		l.mClip = aClip;
+		l.mTime = aClip.start_time();
+		l.mWeight = aWeight;
+		l.mMode = aMode;
+
+		// Match the nodes by their names:
+		std::unordered_map<std::string, size_t> layerNodeIndices;
+		for (size_t i = 0; i < aAnimation.number_of_animated_nodes(); ++i) {
+			layerNodeIndices.emplace(aAnimation.get_animated_node_at(i).get().mNodeName, i);
+		}
+		const auto n = mSkeleton->number_of_animated_nodes();
+		l.mNodeMapping.resize(n);
+		for (size_t i = 0; i < n; ++i) {
+			auto it = layerNodeIndices.find(mSkeleton->get_animated_node_at(i).get().mNodeName);
+			if (std::end(layerNodeIndices) != it) {
+				l.mNodeMapping[i] = it->second;
+			}
+		}
+
+		if (animation_layer_mode::additive == aMode) {
+			l.mReferenceTranslations.resize(n, glm::vec3{ 0.f });
+			l.mReferenceRotations.resize(n, glm::quat{ 1.f, 0.f, 0.f, 0.f });
+			l.mReferenceScales.resize(n, glm::vec3{ 1.f });
+			for (size_t i = 0; i < n; ++i) {
+				if (!l.mNodeMapping[i].has_value()) {
+					continue;
+				}
+				const auto& lnode = aAnimation.get_animated_node_at(l.mNodeMapping[i].value()).get();
+				l.mReferenceTranslations[i] = aAnimation.compute_node_local_translation(lnode, aClip.mStartTicks);
+				l.mReferenceRotations[i]    = aAnimation.compute_node_local_rotation(lnode, aClip.mStartTicks);
+				l.mReferenceScales[i]       = aAnimation.compute_node_local_scale(lnode, aClip.mStartTicks);
+			}
+		}
+
+		return mLayers.size() - 1;
+	}
+
+	void animation_blender::set_layer_weight(size_t aLayerIndex, float aWeight)
+	{
+		assert(aLayerIndex < mLayers.size());
+		mLayers[aLayerIndex].mWeight = aWeight;
+	}
+
+	float animation_blender::layer_weight(size_t aLayerIndex) const
+	{
+		assert(aLayerIndex < mLayers.size());
+		return mLayers[aLayerIndex].mWeight;
+	}
+
+	void animation_blender::set_layer_time(size_t aLayerIndex, double aTime)
+	{
+		assert(aLayerIndex < mLayers.size());
+		mLayers[aLayerIndex].mTime = aTime;
+	}
+
+	void animation_blender::set_layer_bone_mask(size_t aLayerIndex, std::vector<float> aNodeWeights)
+	{
+		assert(aLayerIndex < mLayers.size());
+		if (!aNodeWeights.empty() && aNodeWeights.size() != mSkeleton->number_of_animated_nodes()) {
+			throw avk::runtime_error(std::format("A bone mask must contain one value per animated node ({}), but it contains {}.", mSkeleton->number_of_animated_nodes(), aNodeWeights.size()));
+		}
+		mLayers[aLayerIndex].mBoneMask = std::move(aNodeWeights);
+	}
+
+	std::vector<float> animation_blender::bone_mask_for_subtree(const std::string& aNodeName) const
+	{
+		const auto n = mSkeleton->number_of_animated_nodes();
+		std::vector<float> result(n, 0.0f);
+		// Parents are always stored before their children:
+		for (size_t i = 0; i < n; ++i) {
+			const auto& node = mSkeleton->get_animated_node_at(i).get();
+			if (node.mNodeName == aNodeName || (node.mAnimatedParentIndex.has_value() && result[node.mAnimatedParentIndex.value()] > 0.0f)) {
+				result[i] = 1.0f;
+			}
+		}
+		return result;
+	}
+
+	template <typename F>
+	void animation_blender::evaluate(F&& aWriteBoneMatrix)
+	{
+		for (const auto& l : mLayers) {
+			if (l.mNodeMapping.size() != mSkeleton->number_of_animated_nodes()) {
+				throw avk::runtime_error("The skeleton's animated nodes have changed since layers have been added to the animation_blender.");
+			}
+		}
+
+		const auto n = mSkeleton->number_of_animated_nodes();
+		mGlobalTransforms.resize(n);
+		for (size_t i = 0; i < n; ++i) {
+			const auto& snode = mSkeleton->get_animated_node_at(i).get();
+
+			// Start from the node's local transform from the model, which is what nodes that no layer affects keep:
+			auto [translation, rotation, scale] = transforms_from_matrix(snode.mLocalTransform);
+
+			// Blend layers, in the order in which they have been added, each one towards its own pose:
+			for (const auto& l : mLayers) {
+				const float w = glm::clamp(l.mWeight * (l.mBoneMask.empty() ? 1.0f : l.mBoneMask[i]), 0.f, 1.f);
+				if (animation_layer_mode::blend != l.mMode || w <= 0.f || !l.mNodeMapping[i].has_value()) {
+					continue;
+				}
+				const auto& lnode = l.mAnimation->get_animated_node_at(l.mNodeMapping[i].value()).get();
+				const double timeInTicks = l.mTime * l.mClip.mTicksPerSecond;
+				translation = glm::mix(translation, l.mAnimation->compute_node_local_translation(lnode, timeInTicks), w);
+				scale       = glm::mix(scale, l.mAnimation->compute_node_local_scale(lnode, timeInTicks), w);
+				// Interpolates along the shorter arc:
+				rotation    = glm::normalize(glm::slerp(rotation, l.mAnimation->compute_node_local_rotation(lnode, timeInTicks), w));
+			}
+
+			// Additive layers:
+			for (const auto& l : mLayers) {
+				const float w = l.mWeight * (l.mBoneMask.empty() ? 1.0f : l.mBoneMask[i]);
+				if (animation_layer_mode::additive != l.mMode || w <= 0.f || !l.mNodeMapping[i].has_value()) {
+					continue;
+				}
+				const auto& lnode = l.mAnimation->get_animated_node_at(l.mNodeMapping[i].value()).get();
+				const double timeInTicks = l.mTime * l.mClip.mTicksPerSecond;
+				translation += w * (l.mAnimation->compute_node_local_translation(lnode, timeInTicks) - l.mReferenceTranslations[i]);
+				// A zero reference scale would turn the whole subtree into inf/NaN => no additive scale on that axis:
+				scale *= glm::lerp(glm::vec3{ 1.f }, scale_ratio(l.mAnimation->compute_node_local_scale(lnode, timeInTicks), l.mReferenceScales[i]), w);
+				const auto deltaRotation = glm::inverse(l.mReferenceRotations[i]) * l.mAnimation->compute_node_local_rotation(lnode, timeInTicks);
+				rotation = glm::normalize(rotation * glm::slerp(glm::quat{ 1.f, 0.f, 0.f, 0.f }, deltaRotation, w));
+			}
+
+			// One matrix per node, regardless of the number of layers:
+			const auto localTransform = matrix_from_transforms(translation, rotation, scale);
+			if (snode.mAnimatedParentIndex.has_value()) {
+				mGlobalTransforms[i] = mGlobalTransforms[snode.mAnimatedParentIndex.value()] * snode.mParentTransform * localTransform;
+			}
+			else {
+				mGlobalTransforms[i] = snode.mParentTransform * localTransform;
+			}
+
+			for (const auto& target : snode.mBoneMeshTargets) {
+				aWriteBoneMatrix(target, mGlobalTransforms[i]);
+			}
+		}
+	}
+
+	void animation_blender::animate_into_strided_target_per_mesh(bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory, size_t aMeshStride, std::optional<size_t> aMatricesStride, std::optional<size_t> aMaxMeshes, std::optional<size_t> aMaxBonesPerMesh)
+	{
+		if (aTargetSpace != bone_matrices_space::mesh_space && aTargetSpace != bone_matrices_space::model_space) {
+			throw avk::runtime_error("Unknown target space value.");
+		}
+		auto* target = reinterpret_cast<uint8_t*>(aTargetMemory);
+		const auto matStride = aMatricesStride.value_or(sizeof(glm::mat4));
+		const auto maxMeshes = aMaxMeshes.value_or(std::numeric_limits<size_t>::max());
+		const auto maxBones = aMaxBonesPerMesh.value_or(std::numeric_limits<size_t>::max());
+		evaluate([&](const bone_mesh_data& aTarget, const glm::mat4& aGlobalTransform) {
+			const auto& info = aTarget.mMeshBoneInfo;
+			if (info.mMeshAnimationIndex < maxMeshes && info.mMeshLocalBoneIndex < maxBones) {
+				*reinterpret_cast<glm::mat4*>(target + info.mMeshAnimationIndex * aMeshStride + info.mMeshLocalBoneIndex * matStride) =
+					bone_matrices_space::mesh_space == aTargetSpace
+					? aTarget.mInverseMeshRootMatrix * aGlobalTransform * aTarget.mInverseBindPoseMatrix
+					: aGlobalTransform * aTarget.mInverseBindPoseMatrix;
+			}
+		});
+	}
+
+	void animation_blender::animate_into_single_target_buffer(bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory)
+	{
+		if (aTargetSpace != bone_matrices_space::mesh_space && aTargetSpace != bone_matrices_space::model_space) {
+			throw avk::runtime_error("Unknown target space value.");
+		}
+		evaluate([&](const bone_mesh_data& aTarget, const glm::mat4& aGlobalTransform) {
+			const auto& info = aTarget.mMeshBoneInfo;
+			aTargetMemory[info.mGlobalBoneIndexOffset + info.mMeshLocalBoneIndex] =
+				bone_matrices_space::mesh_space == aTargetSpace
+				? aTarget.mInverseMeshRootMatrix * aGlobalTransform * aTarget.mInverseBindPoseMatrix
+				: aGlobalTransform * aTarget.mInverseBindPoseMatrix;
+		});
+	}
+}
@@ -0,0 +1,319 @@
+
+#include "async_model_loader.hpp"
+
+namespace avk
+{
+	size_t streamed_mesh::size_in_bytes() const
+	{
+		return mPositions.size() * sizeof(glm::vec3)
+			+ mIndices.size() * sizeof(uint32_t)
+			+ mNormals.size() * sizeof(glm::vec3)
+			+ mTextureCoordinates.size() * sizeof(glm::vec2);
+	}
+
+	size_t streamed_texture::size_in_bytes() const
+	{
+		return mImageData.size();
+	}
+
+	async_model_loader::async_model_loader(size_t aStagingBudgetInBytes, size_t aNumWorkerThreads)
+		: mStagingBudget{ aStagingBudgetInBytes }
+	{
+		mModelLoadedEvent = std::make_shared<ready_event>([this]() {
+			std::scoped_lock lock(mMutex);
+			return !mLoadedModels.empty();
+		});
+		mMeshReadyEvent = std::make_shared<ready_event>([this]() {
+			std::scoped_lock lock(mMutex);
+			return !mReadyMeshes.empty();
+		});
+		mTextureReadyEvent = std::make_shared<ready_event>([this]() {
+			std::scoped_lock lock(mMutex);
+			return !mReadyTextures.empty();
+		});
+
+		const auto numWorkers = std::max(aNumWorkerThreads, size_t{ 1 });
+		mWorkers.reserve(numWorkers);
+		for (size_t i = 0; i < numWorkers; ++i) {
+			mWorkers.emplace_back([this]() { worker(); });
+		}
+	}
+
+	async_model_loader::~async_model_loader()
+	{
+		{
+			std::scoped_lock lock(mMutex);
+			mStopping = true;
+		}
+		mJobAvailable.notify_all();
+		mStagingMemoryFreed.notify_all();
+		for (auto& t : mWorkers) {
+			t.join();
+		}
+
+		// Whoever still holds one of the events must not access this loader anymore:
+		mModelLoadedEvent->detach();
+		mMeshReadyEvent->detach();
+		mTextureReadyEvent->detach();
+	}
+
+	size_t async_model_loader::request_model(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags, bool aLoadTextures, bool aLoadTexturesInSrgb, bool aFlipTextures)
+	{
+		size_t requestIndex;
+		{
+			std::scoped_lock lock(mMutex);
+			requestIndex = mNextRequestIndex++;
+		}
+		enqueue_job([this, requestIndex, aPath, aAssimpFlags, aLoadTextures, aLoadTexturesInSrgb, aFlipTextures]() {
+			load_model(requestIndex, aPath, aAssimpFlags, aLoadTextures, aLoadTexturesInSrgb, aFlipTextures);
+		}, false);
+		return requestIndex;
+	}
+
+	std::vector<size_t> async_model_loader::request_orca_scene_models(const orca_scene_t& aScene, model_t::aiProcessFlagsType aAssimpFlags, bool aLoadTextures, bool aLoadTexturesInSrgb, bool aFlipTextures)
+	{
+		std::vector<size_t> requestIndices;
+		requestIndices.reserve(aScene.models().size());
+		for (const auto& modelData : aScene.models()) {
+			requestIndices.push_back(request_model(modelData.mFullPathName, aAssimpFlags, aLoadTextures, aLoadTexturesInSrgb, aFlipTextures));
+		}
+		return requestIndices;
+	}
+
+	std::vector<std::tuple<size_t, avk::model>> async_model_loader::take_loaded_models()
+	{
+		std::scoped_lock lock(mMutex);
+		return std::exchange(mLoadedModels, {});
+	}
+
+	std::vector<streamed_mesh> async_model_loader::take_ready_meshes(size_t aMaxBytes)
+	{
+		std::vector<streamed_mesh> result;
+		{
+			std::scoped_lock lock(mMutex);
+			size_t takenBytes = 0;
+			while (!mReadyMeshes.empty()) {
+				const auto bytes = mReadyMeshes.front().size_in_bytes();
+				if (!result.empty() && takenBytes + bytes > aMaxBytes) {
+					break;
+				}
+				takenBytes += bytes;
+				result.push_back(std::move(mReadyMeshes.front()));
+				mReadyMeshes.pop_front();
+			}
+			mStagedBytes -= takenBytes;
+		}
+		if (!result.empty()) {
+			mStagingMemoryFreed.notify_all();
+		}
+		return result;
+	}
+
+	std::vector<streamed_texture> async_model_loader::take_ready_textures(size_t aMaxBytes)
+	{
+		std::vector<streamed_texture> result;
+		{
+			std::scoped_lock lock(mMutex);
+			size_t takenBytes = 0;
+			while (!mReadyTextures.empty()) {
+				const auto bytes = mReadyTextures.front().size_in_bytes();
+				if (!result.empty() && takenBytes + bytes > aMaxBytes) {
+					break;
+				}
+				takenBytes += bytes;
+				result.push_back(std::move(mReadyTextures.front()));
+				mReadyTextures.pop_front();
+			}
+			mStagedBytes -= takenBytes;
+		}
+		if (!result.empty()) {
+			mStagingMemoryFreed.notify_all();
+		}
+		return result;
+	}
+
+	std::vector<std::tuple<size_t, std::string>> async_model_loader::take_failed_requests()
+	{
+		std::scoped_lock lock(mMutex);
+		return std::exchange(mFailedRequests, {});
+	}
+
+	bool async_model_loader::is_finished() const
+	{
+		std::scoped_lock lock(mMutex);
+		return mJobs.empty() && 0 == mRunningJobs
+			&& mLoadedModels.empty() && mReadyMeshes.empty() && mReadyTextures.empty();
+	}
+
+	size_t async_model_loader::staged_bytes() const
+	{
+		std::scoped_lock lock(mMutex);
+		return mStagedBytes;
+	}
+
+	void async_model_loader::worker()
+	{
+		for (;;) {
+			std::function<void()> job;
+			{
+				std::unique_lock lock(mMutex);
+				mJobAvailable.wait(lock, [this]() { return mStopping || !mJobs.empty(); });
+				if (mStopping) {
+					return;
+				}
+				job = std::move(mJobs.front());
+				mJobs.pop_front();
+				++mRunningJobs;
+			}
+			job();
+			{
+				std::scoped_lock lock(mMutex);
+				--mRunningJobs;
+			}
+		}
+	}
+
+	void async_model_loader::enqueue_job(std::function<void()> aJob, bool aPrioritize)
+	{
+		{
+			std::scoped_lock lock(mMutex);
+			if (aPrioritize) {
+				mJobs.push_front(std::move(aJob));
+			}
+			else {
+				mJobs.push_back(std::move(aJob));
+			}
+		}
+		mJobAvailable.notify_one();
+	}
+
+	bool async_model_loader::acquire_staging_memory(size_t aBytes)
+	{
+		std::unique_lock lock(mMutex);
+		// If nothing is staged, the data is accepted even if it exceeds the budget on its own:
+		mStagingMemoryFreed.wait(lock, [this, aBytes]() {
+			return mStopping || 0 == mStagedBytes || mStagedBytes + aBytes <= mStagingBudget;
+		});
+		if (mStopping) {
+			return false;
+		}
+		mStagedBytes += aBytes;
+		return true;
+	}
+
+	void async_model_loader::load_model(size_t aRequestIndex, const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags, bool aLoadTextures, bool aLoadTexturesInSrgb, bool aFlipTextures)
+	{
+		avk::model loadedModel;
+		std::vector<std::tuple<std::string, bool>> texturesToDecode;
+		try {
+			loadedModel = model_t::load_from_file(aPath, aAssimpFlags);
+			loadedModel.enable_shared_ownership();
+
+			// Gather the textures while we're still the only thread accessing the model:
+			const auto numMeshes = loadedModel->num_meshes();
+			for (mesh_index_t i = 0; i < numMeshes; ++i) {
+				auto mc = loadedModel->material_config_for_mesh(i);
+				if (!aLoadTextures) {
+					continue;
+				}
+				for (const auto& [tex, potentiallySrgb] : {
+						std::make_tuple(&mc.mDiffuseTex, true),       std::make_tuple(&mc.mSpecularTex, false),   std::make_tuple(&mc.mAmbientTex, true),
+						std::make_tuple(&mc.mEmissiveTex, false),     std::make_tuple(&mc.mHeightTex, false),     std::make_tuple(&mc.mNormalsTex, false),
+						std::make_tuple(&mc.mShininessTex, false),    std::make_tuple(&mc.mOpacityTex, false),    std::make_tuple(&mc.mDisplacementTex, false),
+						std::make_tuple(&mc.mReflectionTex, false),   std::make_tuple(&mc.mLightmapTex, false),   std::make_tuple(&mc.mExtraTex, true) }) {
+					if (tex->empty()) {
+						continue;
+					}
+					texturesToDecode.emplace_back(avk::clean_up_path(*tex), aLoadTexturesInSrgb && potentiallySrgb);
+				}
+			}
+		}
+		catch (std::exception& e) {
+			LOG_ERROR(std::format("Loading model '{}' in the background failed: {}", aPath, e.what()));
+			record_failure(aRequestIndex, e.what());
+			return;
+		}
+
+		// Decode this model's meshes and textures before starting with the next model:
+		std::vector<std::function<void()>> jobs;
+		for (mesh_index_t i = 0; i < loadedModel->num_meshes(); ++i) {
+			jobs.emplace_back([this, aRequestIndex, loadedModel, i]() {
+				decode_mesh(aRequestIndex, loadedModel, i);
+			});
+		}
+
+		{
+			std::scoped_lock lock(mMutex);
+			for (auto& [path, srgb] : texturesToDecode) {
+				if (!mRequestedTextures.insert(path).second) {
+					continue;
+				}
+				jobs.emplace_back([this, aRequestIndex, path, srgb, aFlipTextures]() {
+					decode_texture(aRequestIndex, path, srgb, aFlipTextures);
+				});
+			}
+			mJobs.insert(mJobs.begin(), std::make_move_iterator(jobs.begin()), std::make_move_iterator(jobs.end()));
+			mLoadedModels.emplace_back(aRequestIndex, loadedModel);
+		}
+		mJobAvailable.notify_all();
+	}
+
+	void async_model_loader::decode_mesh(size_t aRequestIndex, const avk::model& aModel, mesh_index_t aMeshIndex)
+	{
+		try {
+			const auto numVertices = aModel->number_of_vertices_for_mesh(aMeshIndex);
+			const auto numIndices = static_cast<size_t>(aModel->number_of_indices_for_mesh(aMeshIndex));
+			const auto hasTexCoords = aModel->num_uv_components_for_mesh(aMeshIndex, 0) > 0;
+			const auto estimatedBytes = numVertices * (2 * sizeof(glm::vec3) + (hasTexCoords ? sizeof(glm::vec2) : 0)) + numIndices * sizeof(uint32_t);
+			if (!acquire_staging_memory(estimatedBytes)) {
+				return;
+			}
+
+			streamed_mesh mesh{ aRequestIndex, aModel, aMeshIndex };
+			mesh.mPositions = aModel->positions_for_mesh(aMeshIndex);
+			mesh.mIndices = aModel->indices_for_mesh<uint32_t>(aMeshIndex);
+			mesh.mNormals = aModel->normals_for_mesh(aMeshIndex);
+			if (hasTexCoords) {
+				mesh.mTextureCoordinates = aModel->texture_coordinates_for_mesh<glm::vec2>(aMeshIndex, 0);
+			}
+
+			std::scoped_lock lock(mMutex);
+			// Replace the estimate with the actual size:
+			mStagedBytes = mStagedBytes - estimatedBytes + mesh.size_in_bytes();
+			mReadyMeshes.push_back(std::move(mesh));
+		}
+		catch (std::exception& e) {
+			LOG_ERROR(std::format("Decoding mesh {} of request {} in the background failed: {}", aMeshIndex, aRequestIndex, e.what()));
+			record_failure(aRequestIndex, e.what());
+		}
+	}
+
+	void async_model_loader::decode_texture(size_t aRequestIndex, const std::string& aPath, bool aLoadInSrgb, bool aFlip)
+	{
+		try {
+			streamed_texture texture{ aRequestIndex, aPath, image_data(aPath, true, aLoadInSrgb, aFlip) };
+			texture.mImageData.load();
+
+			// The size of a texture is not known before decoding it, hence the budget is acquired afterwards:
+			if (!acquire_staging_memory(texture.size_in_bytes())) {
+				return;
+			}
+
+			std::scoped_lock lock(mMutex);
+			mReadyTextures.push_back(std::move(texture));
+		}
+		catch (std::exception& e) {
+			LOG_ERROR(std::format("Decoding texture '{}' of request {} in the background failed: {}", aPath, aRequestIndex, e.what()));
+			record_failure(aRequestIndex, e.what());
+		}
+	}
+
+	void async_model_loader::record_failure(size_t aRequestIndex, const std::string& aMessage)
+	{
+		std::scoped_lock lock(mMutex);
+		// Multiple meshes and textures of the same request can fail:
+		if (mFailedRequestIndices.insert(aRequestIndex).second) {
+			mFailedRequests.emplace_back(aRequestIndex, aMessage);
+		}
+	}
+}
@@ -0,0 +1,259 @@
+#include "baked_animation.hpp"
+#include "transform.hpp"
+
+namespace avk
+{
+	// Range of the three smallest components of a unit quaternion: [-1/sqrt(2), 1/sqrt(2)]
+	static constexpr float sSmallestThreeRange = 0.70710678118f;
+	static constexpr float sMax15Bit = 32767.f;
+
+	quantized_rotation_3x16 pack_rotation_smallest_three(const glm::quat& aRotation)
+	{
+		const glm::vec4 v{ aRotation.x, aRotation.y, aRotation.z, aRotation.w };
+		glm::length_t largest = 0;
+		for (glm::length_t i = 1; i < 4; ++i) {
+			if (std::abs(v[i]) > std::abs(v[largest])) {
+				largest = i;
+			}
+		}
+		// q and -q represent the same rotation => ensure that the omitted component is positive:
+		const float sign = v[largest] < 0.f ? -1.f : 1.f;
+		std::array<uint16_t, 3> q;
+		size_t j = 0;
+		for (glm::length_t i = 0; i < 4; ++i) {
+			if (i == largest) {
+				continue;
+			}
+			const float normalized = glm::clamp(v[i] * sign / sSmallestThreeRange * 0.5f + 0.5f, 0.f, 1.f);
+			q[j++] = static_cast<uint16_t>(std::round(normalized * sMax15Bit));
+		}
+		return { glm::u16vec3{
+			static_cast<uint16_t>(q[0] | ((largest >> 1) << 15)),
+			static_cast<uint16_t>(q[1] | ((largest & 1) << 15)),
+			q[2]
+		} };
+	}
+
+	/** Decodes a quaternion from smallest-three encoding without normalizing it afterwards. */
+	static inline glm::quat decode_smallest_three(const quantized_rotation_3x16& aValue)
+	{
+		// The positions of the three stored components, for each index of the omitted component:
+		static constexpr glm::length_t sStoredComponents[4][3] = { { 1, 2, 3 }, { 0, 2, 3 }, { 0, 1, 3 }, { 0, 1, 2 } };
+		const glm::length_t largest = ((aValue.mValue.x >> 15) << 1) | (aValue.mValue.y >> 15);
+		const glm::vec3 smallest = glm::vec3{ aValue.mValue & glm::u16vec3{ 0x7FFF } } * (2.f * sSmallestThreeRange / sMax15Bit) - sSmallestThreeRange;
+		glm::vec4 v;
+		v[sStoredComponents[largest][0]] = smallest.x;
+		v[sStoredComponents[largest][1]] = smallest.y;
+		v[sStoredComponents[largest][2]] = smallest.z;
+		v[largest] = std::sqrt(std::max(0.f, 1.f - glm::dot(smallest, smallest)));
+		return glm::quat{ v.w, v.x, v.y, v.z };
+	}
+
+	glm::quat unpack_rotation_smallest_three(const quantized_rotation_3x16& aValue)
+	{
+		return glm::normalize(decode_smallest_three(aValue));
+	}
+
+	/** Quantizes the given values against their bounds. If all of them are equal after quantization, only one sample is stored. */
+	static baked_vec3_track quantize_vec3_track(const std::vector<glm::vec3>& aValues)
+	{
+		baked_vec3_track track;
+		glm::vec3 minValue{ std::numeric_limits<float>::max() };
+		glm::vec3 maxValue{ std::numeric_limits<float>::lowest() };
+		for (const auto& v : aValues) {
+			minValue = glm::min(minValue, v);
+			maxValue = glm::max(maxValue, v);
+		}
+		track.mRange = position_dequantization_for_bounds(minValue, maxValue);
+		track.mSamples.reserve(aValues.size());
+		for (const auto& v : aValues) {
+			track.mSamples.push_back({ glm::u16vec3{ quantize_position_4x16(v, track.mRange).mValue } });
+		}
+		if (std::all_of(std::begin(track.mSamples), std::end(track.mSamples), [&track](const quantized_vec3_3x16& aSample) { return aSample.mValue == track.mSamples.front().mValue; })) {
+			track.mSamples.resize(1);
+		}
+		return track;
+	}
+
+	static glm::vec3 dequantize_vec3(const baked_vec3_track& aTrack, size_t aSampleIndex)
+	{
+		const auto& q = aTrack.mSamples[std::min(aSampleIndex, aTrack.mSamples.size() - 1)];
+		return aTrack.mRange.mOffset + aTrack.mRange.mScale * (glm::vec3{ q.mValue } * (1.f / 65535.f));
+	}
+
+	baked_animation baked_animation::bake(const animation& aAnimation, const animation_clip_data& aClip, std::optional<double> aSamplesPerSecond)
+	{
+		if (aClip.mTicksPerSecond == 0.0) {
+			throw avk::runtime_error("animation_clip_data::mTicksPerSecond may not be 0.0 => set a different value!");
+		}
+		if (aClip.mEndTicks < aClip.mStartTicks) {
+			throw avk::runtime_error(std::format("The clip's end ({} ticks) is before its start ({} ticks).", aClip.mEndTicks, aClip.mStartTicks));
+		}
+
+		double samplesPerSecond = 1.0;
+		if (aSamplesPerSecond.has_value()) {
+			if (aSamplesPerSecond.value() <= 0.0) {
+				throw avk::runtime_error(std::format("The sample rate must be positive, but it is {}.", aSamplesPerSecond.value()));
+			}
+			samplesPerSecond = aSamplesPerSecond.value();
+		}
+		else {
+			const auto keyTimes = aAnimation.animation_key_times_for_clip_in_ticks(aClip);
+			double minDistance = std::numeric_limits<double>::max();
+			for (size_t i = 1; i < keyTimes.size(); ++i) {
+				const auto d = keyTimes[i] - keyTimes[i - 1];
+				if (d > 1e-9) {
+					minDistance = std::min(minDistance, d);
+				}
+			}
+			if (minDistance < std::numeric_limits<double>::max()) {
+				samplesPerSecond = std::min(aClip.mTicksPerSecond / minDistance, sMaxDerivedSamplesPerSecond);
+			}
+		}
+
+		const double durationInTicks = aClip.mEndTicks - aClip.mStartTicks;
+		const double duration = durationInTicks / aClip.mTicksPerSecond;
+		const size_t numIntervals = duration > 0.0 ? std::max(size_t{ 1 }, static_cast<size_t>(std::ceil(duration * samplesPerSecond - 1e-6))) : 0;
+
+		baked_animation result;
+		result.mStartTime = aClip.start_time();
+		result.mNumSamples = numIntervals + 1;
+		result.mSamplesPerSecond = numIntervals > 0 ? static_cast<double>(numIntervals) / duration : samplesPerSecond;
+
+		std::vector<double> sampleTicks(result.mNumSamples);
+		for (size_t s = 0; s < result.mNumSamples; ++s) {
+			sampleTicks[s] = numIntervals > 0 ? aClip.mStartTicks + durationInTicks * static_cast<double>(s) / static_cast<double>(numIntervals) : aClip.mStartTicks;
+		}
+
+		const auto n = aAnimation.number_of_animated_nodes();
+		result.mNodes.resize(n);
+		std::vector<glm::vec3> translations(result.mNumSamples);
+		std::vector<glm::vec3> scales(result.mNumSamples);
+		for (size_t i = 0; i < n; ++i) {
+			const auto& anode = aAnimation.get_animated_node_at(i).get();
+			auto& bnode = result.mNodes[i];
+			bnode.mAnimatedParentIndex = anode.mAnimatedParentIndex;
+			bnode.mParentTransform = anode.mParentTransform;
+			bnode.mBoneMeshTargets = anode.mBoneMeshTargets;
+
+			bnode.mRotations.mSamples.reserve(result.mNumSamples);
+			for (size_t s = 0; s < result.mNumSamples; ++s) {
+				translations[s] = aAnimation.compute_node_local_translation(anode, sampleTicks[s]);
+				scales[s] = aAnimation.compute_node_local_scale(anode, sampleTicks[s]);
+				bnode.mRotations.mSamples.push_back(pack_rotation_smallest_three(aAnimation.compute_node_local_rotation(anode, sampleTicks[s])));
+			}
+			bnode.mTranslations = quantize_vec3_track(translations);
+			bnode.mScales = quantize_vec3_track(scales);
+			const auto& rotations = bnode.mRotations.mSamples;
+			if (std::all_of(std::begin(rotations), std::end(rotations), [&rotations](const quantized_rotation_3x16& aSample) { return aSample.mValue == rotations.front().mValue; })) {
+				bnode.mRotations.mSamples.resize(1);
+			}
+		}
+		return result;
+	}
+
+	size_t baked_animation::size_in_bytes() const
+	{
+		size_t result = 0;
+		for (const auto& bnode : mNodes) {
+			result += 2 * sizeof(position_dequantization)
+				+ (bnode.mTranslations.mSamples.size() + bnode.mScales.mSamples.size()) * sizeof(quantized_vec3_3x16)
+				+ bnode.mRotations.mSamples.size() * sizeof(quantized_rotation_3x16);
+		}
+		return result;
+	}
+
+	void baked_animation::compute_local_transforms(double aTime, std::span<glm::mat4> aLocalTransforms) const
+	{
+		assert(aLocalTransforms.size() >= mNodes.size());
+		if (0 == mNumSamples) {
+			return;
+		}
+
+		const double s = glm::clamp((aTime - mStartTime) * mSamplesPerSecond, 0.0, static_cast<double>(mNumSamples - 1));
+		const auto i0 = static_cast<size_t>(s);
+		const auto i1 = std::min(i0 + 1, mNumSamples - 1);
+		const auto f = static_cast<float>(s - static_cast<double>(i0));
+
+		for (size_t i = 0; i < mNodes.size(); ++i) {
+			const auto& bnode = mNodes[i];
+			// Constant tracks store only one sample => nothing to interpolate:
+			const auto translation = bnode.mTranslations.mSamples.size() > 1
+				? glm::mix(dequantize_vec3(bnode.mTranslations, i0), dequantize_vec3(bnode.mTranslations, i1), f)
+				: dequantize_vec3(bnode.mTranslations, 0);
+			const auto scale = bnode.mScales.mSamples.size() > 1
+				? glm::mix(dequantize_vec3(bnode.mScales, i0), dequantize_vec3(bnode.mScales, i1), f)
+				: dequantize_vec3(bnode.mScales, 0);
+
+			const auto& rotations = bnode.mRotations.mSamples;
+			glm::quat rotation;
+			if (rotations.size() > 1) {
+				const auto r0 = decode_smallest_three(rotations[i0]);
+				auto r1 = decode_smallest_three(rotations[i1]);
+				if (glm::dot(r0, r1) < 0.f) {
+					r1 = -r1;
+				}
+				rotation = glm::normalize(r0 * (1.f - f) + r1 * f);
+			}
+			else {
+				rotation = unpack_rotation_smallest_three(rotations.front());
+			}
+
+			aLocalTransforms[i] = matrix_from_transforms(translation, rotation, scale);
+		}
+	}
+
+	void baked_animation::animate_into_single_target_buffer(double aTime, bone_matrices_space aTargetSpace, glm::mat4* aTargetMemory) const
+	{
+		if (aTargetSpace != bone_matrices_space::mesh_space && aTargetSpace != bone_matrices_space::model_space) {
+			throw avk::runtime_error("Unknown target space value.");
+		}
+
+		// Per-thread scratch memory, s.t. playback does not allocate, and multiple threads can play back concurrently:
+		thread_local std::vector<glm::mat4> sTransforms;
+		const auto n = mNodes.size();
+		sTransforms.resize(n);
+		compute_local_transforms(aTime, sTransforms);
+
+		// Parents are always stored before their children => replace the local transforms by the global ones in place:
+		for (size_t i = 0; i < n; ++i) {
+			const auto& bnode = mNodes[i];
+			if (bnode.mAnimatedParentIndex.has_value()) {
+				sTransforms[i] = sTransforms[bnode.mAnimatedParentIndex.value()] * bnode.mParentTransform * sTransforms[i];
+			}
+			else {
+				sTransforms[i] = bnode.mParentTransform * sTransforms[i];
+			}
+
+			for (const auto& target : bnode.mBoneMeshTargets) {
+				const auto& info = target.mMeshBoneInfo;
+				if (bone_matrices_space::mesh_space == aTargetSpace) {
+					aTargetMemory[info.mGlobalBoneIndexOffset + info.mMeshLocalBoneIndex] = target.mInverseMeshRootMatrix * sTransforms[i] * target.mInverseBindPoseMatrix;
+				}
+				else {
+					aTargetMemory[info.mGlobalBoneIndexOffset + info.mMeshLocalBoneIndex] = sTransforms[i] * target.mInverseBindPoseMatrix;
+				}
+			}
+		}
+	}
+
+	void baked_animation::animate_instances(std::span<const double> aTimes, std::span<glm::mat4* const> aTargetMemories, bone_matrices_space aTargetSpace, size_t aMaxThreads) const
+	{
+		if (aTimes.size() != aTargetMemories.size()) {
+			throw avk::runtime_error(std::format("animate_instances requires the same number of times ({}) and target memories ({}).", aTimes.size(), aTargetMemories.size()));
+		}
+		parallel_for(aTimes.size(), [&](size_t i) {
+			animate_into_single_target_buffer(aTimes[i], aTargetSpace, aTargetMemories[i]);
+		}, aMaxThreads);
+	}
+
+	baked_animation bake_animation_cached(avk::serializer& aSerializer, const animation& aAnimation, const animation_clip_data& aClip, std::optional<double> aSamplesPerSecond)
+	{
+		baked_animation result;
+		if (aSerializer.mode() == serializer::mode::serialize) {
+			result = baked_animation::bake(aAnimation, aClip, aSamplesPerSecond);
+		}
+		aSerializer.archive(result);
+		return result;
+	}
+}
@@ -0,0 +1,280 @@
+#include "cpu_profiler.hpp"
+
+namespace avk
+{
+	namespace
+	{
+		/** The zones of one thread. The mutex is only contended while the buffer is being read. */
+		struct cpu_profile_thread_buffer
+		{
+			std::mutex mMutex;
+			std::vector<cpu_profile_event> mEvents = std::vector<cpu_profile_event>(CPU_PROFILE_EVENTS_PER_THREAD);
+			uint64_t mNumWritten = 0;
+			uint64_t mNumAccumulated = 0;
+			std::string mThreadName;
+			uint32_t mThreadIndex = 0;
+			std::atomic<bool> mThreadExited = false;
+		};
+
+		/** Marks the buffer of a thread which exits, s.t. it is released after its zones have been accumulated */
+		struct cpu_profile_thread_registration
+		{
+			~cpu_profile_thread_registration()
+			{
+				if (mBuffer) {
+					mBuffer->mThreadExited = true;
+				}
+			}
+
+			std::shared_ptr<cpu_profile_thread_buffer> mBuffer;
+		};
+
+		struct cpu_profiler_state
+		{
+			std::atomic<bool> mEnabled = true;
+
+			std::mutex mNamesMutex;
+			std::deque<std::string> mNames; // A deque, s.t. the views of mNameIds and of cpu_profile_name stay valid
+			std::unordered_map<std::string_view, uint32_t> mNameIds;
+
+			std::mutex mThreadsMutex;
+			std::vector<std::shared_ptr<cpu_profile_thread_buffer>> mThreads;
+			uint32_t mNextThreadIndex = 0;
+
+			std::mutex mStatisticsMutex;
+			profile_statistics_accumulator mStatistics;
+		};
+
+		cpu_profiler_state& the_cpu_profiler_state()
+		{
+			static cpu_profiler_state sState;
+			return sState;
+		}
+
+		/** Returns the calling thread's buffer, which is created and registered on first use */
+		cpu_profile_thread_buffer& this_threads_cpu_profile_buffer()
+		{
+			thread_local cpu_profile_thread_registration tRegistration;
+			if (!tRegistration.mBuffer) {
+				auto& state = the_cpu_profiler_state();
+				auto buffer = std::make_shared<cpu_profile_thread_buffer>();
+				std::scoped_lock<std::mutex> guard(state.mThreadsMutex);
+				buffer->mThreadIndex = state.mNextThreadIndex++;
+				buffer->mThreadName = std::format("thread #{}", buffer->mThreadIndex);
+				state.mThreads.push_back(buffer);
+				tRegistration.mBuffer = std::move(buffer);
+			}
+			return *tRegistration.mBuffer;
+		}
+
+		std::vector<std::shared_ptr<cpu_profile_thread_buffer>> all_cpu_profile_buffers()
+		{
+			auto& state = the_cpu_profiler_state();
+			std::scoped_lock<std::mutex> guard(state.mThreadsMutex);
+			return state.mThreads;
+		}
+	}
+
+	void profile_statistics_accumulator::add(uint32_t aNameId, double aDurationMs)
+	{
+		if (aNameId >= mHistories.size()) {
+			mHistories.resize(aNameId + 1);
+		}
+		auto& h = mHistories[aNameId];
+		if (0 == h.mCurrentCalls) {
+			mNameIdsInCurrentFrame.push_back(aNameId);
+		}
+		h.mCurrentMs += aDurationMs;
+		++h.mCurrentCalls;
+	}
+
+	void profile_statistics_accumulator::end_frame()
+	{
+		for (auto id : mNameIdsInCurrentFrame) {
+			auto& h = mHistories[id];
+			h.mFrameMs[h.mNumFrames % h.mFrameMs.size()] = h.mCurrentMs;
+			++h.mNumFrames;
+			h.mLastFrame = mFrame;
+			h.mLastCalls = h.mCurrentCalls;
+			h.mCurrentMs = 0.0;
+			h.mCurrentCalls = 0;
+		}
+		mNameIdsInCurrentFrame.clear();
+		++mFrame;
+	}
+
+	std::vector<profile_zone_statistics> profile_statistics_accumulator::statistics() const
+	{
+		std::vector<profile_zone_statistics> result;
+		for (uint32_t id = 0; id < static_cast<uint32_t>(mHistories.size()); ++id) {
+			const auto& h = mHistories[id];
+			if (0 == h.mNumFrames || h.mLastFrame + CPU_PROFILE_STATISTICS_FRAMES < mFrame) {
+				continue;
+			}
+			const auto n = std::min(h.mNumFrames, static_cast<uint32_t>(h.mFrameMs.size()));
+			const auto values = std::span<const double>{ h.mFrameMs.data(), n };
+			const auto [minIt, maxIt] = std::minmax_element(std::begin(values), std::end(values));
+			result.push_back(profile_zone_statistics{
+				cpu_profile_name(id),
+				h.mFrameMs[(h.mNumFrames - 1) % h.mFrameMs.size()],
+				std::accumulate(std::begin(values), std::end(values), 0.0) / static_cast<double>(n),
+				*minIt,
+				*maxIt,
+				h.mLastCalls,
+				n
+			});
+		}
+		return result;
+	}
+
+	int64_t cpu_profile_now_ns()
+	{
+		static const auto sEpoch = std::chrono::steady_clock::now();
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - sEpoch).count();
+	}
+
+	uint32_t cpu_profile_name_id(std::string_view aName)
+	{
+		auto& state = the_cpu_profiler_state();
+		std::scoped_lock<std::mutex> guard(state.mNamesMutex);
+		const auto it = state.mNameIds.find(aName);
+		if (std::end(state.mNameIds) != it) {
+			return it->second;
+		}
+		const auto id = static_cast<uint32_t>(state.mNames.size());
+		state.mNameIds.emplace(state.mNames.emplace_back(aName), id);
+		return id;
+	}
+
+	uint32_t cpu_profile_name_id(std::string_view aPrefix, std::string_view aSuffix)
+	{
+		thread_local std::string tName;
+		tName.assign(aPrefix);
+		tName.append(aSuffix);
+		return cpu_profile_name_id(tName);
+	}
+
+	std::string_view cpu_profile_name(uint32_t aNameId)
+	{
+		auto& state = the_cpu_profiler_state();
+		std::scoped_lock<std::mutex> guard(state.mNamesMutex);
+		return aNameId < state.mNames.size() ? std::string_view{ state.mNames[aNameId] } : std::string_view{};
+	}
+
+	void set_cpu_profiling_enabled(bool aEnabled)
+	{
+		the_cpu_profiler_state().mEnabled.store(aEnabled, std::memory_order_relaxed);
+	}
+
+	bool is_cpu_profiling_enabled()
+	{
+		return the_cpu_profiler_state().mEnabled.load(std::memory_order_relaxed);
+	}
+
+	void set_cpu_profile_thread_name(std::string_view aName)
+	{
+		auto& buffer = this_threads_cpu_profile_buffer();
+		std::scoped_lock<std::mutex> guard(buffer.mMutex);
+		buffer.mThreadName = aName;
+	}
+
+	void record_cpu_profile_event(uint32_t aNameId, int64_t aBeginNs, int64_t aEndNs)
+	{
+		auto& buffer = this_threads_cpu_profile_buffer();
+		std::scoped_lock<std::mutex> guard(buffer.mMutex);
+		buffer.mEvents[buffer.mNumWritten % buffer.mEvents.size()] = cpu_profile_event{ aNameId, aBeginNs, aEndNs };
+		++buffer.mNumWritten;
+	}
+
+	void end_cpu_profile_frame()
+	{
+		auto& state = the_cpu_profiler_state();
+		std::scoped_lock<std::mutex> statisticsGuard(state.mStatisticsMutex);
+
+		for (const auto& buffer : all_cpu_profile_buffers()) {
+			std::scoped_lock<std::mutex> guard(buffer->mMutex);
+			// Zones which have already been overwritten are lost for the statistics:
+			const auto capacity = static_cast<uint64_t>(buffer->mEvents.size());
+			const auto first = std::max(buffer->mNumAccumulated, buffer->mNumWritten > capacity ? buffer->mNumWritten - capacity : uint64_t{ 0 });
+			for (auto i = first; i < buffer->mNumWritten; ++i) {
+				const auto& e = buffer->mEvents[i % capacity];
+				state.mStatistics.add(e.mNameId, static_cast<double>(e.mEndNs - e.mBeginNs) * 1e-6);
+			}
+			buffer->mNumAccumulated = buffer->mNumWritten;
+		}
+
+		{
+			// The zones of threads which have exited have been accumulated above => release their buffers:
+			std::scoped_lock<std::mutex> guard(state.mThreadsMutex);
+			std::erase_if(state.mThreads, [](const auto& aBuffer) { return aBuffer->mThreadExited.load(); });
+		}
+
+		state.mStatistics.end_frame();
+	}
+
+	std::vector<profile_zone_statistics> cpu_profile_statistics_of_recent_frames()
+	{
+		auto& state = the_cpu_profiler_state();
+		std::scoped_lock<std::mutex> guard(state.mStatisticsMutex);
+		return state.mStatistics.statistics();
+	}
+
+	void export_cpu_profile_chrome_trace(const std::filesystem::path& aPath)
+	{
+		std::ofstream file{ aPath, std::ios::out | std::ios::trunc };
+		if (!file.is_open()) {
+			throw avk::runtime_error(std::format("Unable to open file '{}' for writing the CPU profile.", aPath.string()));
+		}
+
+		// Copy the events first, s.t. the threads are not blocked while the names are being looked up and the file is being written:
+		struct thread_events
+		{
+			uint32_t mThreadIndex;
+			std::string mThreadName;
+			std::vector<cpu_profile_event> mEvents;
+		};
+		std::vector<thread_events> threads;
+		for (const auto& buffer : all_cpu_profile_buffers()) {
+			std::scoped_lock<std::mutex> guard(buffer->mMutex);
+			auto& t = threads.emplace_back(thread_events{ buffer->mThreadIndex, buffer->mThreadName });
+			const auto capacity = static_cast<uint64_t>(buffer->mEvents.size());
+			for (auto i = buffer->mNumWritten > capacity ? buffer->mNumWritten - capacity : uint64_t{ 0 }; i < buffer->mNumWritten; ++i) {
+				t.mEvents.push_back(buffer->mEvents[i % capacity]);
+			}
+		}
+
+		auto traceEvents = nlohmann::json::array();
+		for (const auto& t : threads) {
+			traceEvents.push_back({
+				{ "name", "thread_name" }, { "ph", "M" }, { "pid", 1 }, { "tid", t.mThreadIndex },
+				{ "args", { { "name", t.mThreadName } } }
+			});
+			for (const auto& e : t.mEvents) {
+				traceEvents.push_back({
+					{ "name", cpu_profile_name(e.mNameId) }, { "ph", "X" }, { "pid", 1 }, { "tid", t.mThreadIndex },
+					{ "ts", static_cast<double>(e.mBeginNs) * 1e-3 }, { "dur", static_cast<double>(e.mEndNs - e.mBeginNs) * 1e-3 }
+				});
+			}
+		}
+		file << nlohmann::json{ { "traceEvents", std::move(traceEvents) }, { "displayTimeUnit", "ms" } }.dump();
+	}
+
+	cpu_profile_zone::cpu_profile_zone(uint32_t aNameId)
+		: mNameId{ sNoZone }
+		, mBeginNs{ 0 }
+	{
+		if (!is_cpu_profiling_enabled()) {
+			return;
+		}
+		mNameId = aNameId;
+		mBeginNs = cpu_profile_now_ns();
+	}
+
+	cpu_profile_zone::~cpu_profile_zone()
+	{
+		if (sNoZone == mNameId) {
+			return;
+		}
+		record_cpu_profile_event(mNameId, mBeginNs, cpu_profile_now_ns());
+	}
+}
@@ -0,0 +1,225 @@
+#include "deferred_log.hpp"
+
+namespace avk
+{
+	std::string& thread_local_log_argument_buffer()
+	{
+		thread_local std::string tBuffer;
+		return tBuffer;
+	}
+
+	namespace
+	{
+		using decoded_log_argument = std::variant<int64_t, uint64_t, float, double, bool, char, std::string_view, const void*>;
+
+		/** Decodes arguments which have been encoded via encode_log_argument. Returns false if they are malformed. */
+		bool decode_log_arguments(std::string_view aArguments, std::vector<decoded_log_argument>& aOut)
+		{
+			size_t pos = 0;
+			auto read = [&](void* aDst, size_t aSize) {
+				if (pos + aSize > aArguments.size()) {
+					return false;
+				}
+				std::memcpy(aDst, aArguments.data() + pos, aSize);
+				pos += aSize;
+				return true;
+			};
+			auto readValue = [&]<typename T>(T aValue) {
+				if (!read(&aValue, sizeof(T))) {
+					return false;
+				}
+				aOut.emplace_back(aValue);
+				return true;
+			};
+
+			while (pos < aArguments.size()) {
+				bool ok;
+				switch (static_cast<log_argument_tag>(aArguments[pos++])) {
+				case log_argument_tag::int64:
+					ok = readValue(int64_t{});
+					break;
+				case log_argument_tag::uint64:
+					ok = readValue(uint64_t{});
+					break;
+				case log_argument_tag::float32:
+					ok = readValue(float{});
+					break;
+				case log_argument_tag::float64:
+					ok = readValue(double{});
+					break;
+				case log_argument_tag::boolean:
+					ok = readValue(bool{});
+					break;
+				case log_argument_tag::character:
+					ok = readValue(char{});
+					break;
+				case log_argument_tag::string: {
+					uint32_t size;
+					ok = read(&size, sizeof(size)) && pos + size <= aArguments.size();
+					if (ok) {
+						aOut.emplace_back(aArguments.substr(pos, size));
+						pos += size;
+					}
+					break;
+				}
+				case log_argument_tag::pointer: {
+					uint64_t value;
+					ok = read(&value, sizeof(value));
+					if (ok) {
+						aOut.emplace_back(reinterpret_cast<const void*>(static_cast<uintptr_t>(value)));
+					}
+					break;
+				}
+				default:
+					ok = false;
+					break;
+				}
+				if (!ok) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/** Parses a non-negative decimal number, as used for arg-ids. Returns std::nullopt if aText is no such number. */
+		std::optional<size_t> parse_arg_id(std::string_view aText)
+		{
+			if (aText.empty()) {
+				return {};
+			}
+			size_t result = 0;
+			for (auto c : aText) {
+				if (c < '0' || c > '9') {
+					return {};
+				}
+				result = result * 10 + static_cast<size_t>(c - '0');
+			}
+			return result;
+		}
+
+		/** Returns the index of the '}' which closes the replacement field whose '{' is right before aStart */
+		size_t find_end_of_replacement_field(std::string_view aFormat, size_t aStart)
+		{
+			int depth = 1;
+			for (auto i = aStart; i < aFormat.size(); ++i) {
+				if ('{' == aFormat[i]) {
+					++depth;
+				}
+				else if ('}' == aFormat[i] && 0 == --depth) {
+					return i;
+				}
+			}
+			return aFormat.size();
+		}
+
+		/**	Appends all replacement fields of aFormat, formatted like std::format would format them. Each replacement
+		 *	field is formatted separately, which supports explicit and automatic arg-ids, as well as nested replacement
+		 *	fields for width and precision.
+		 */
+		void append_formatted(std::string& aOut, std::string_view aFormat, const std::vector<decoded_log_argument>& aArgs)
+		{
+			thread_local std::string tField;
+			size_t nextArgId = 0;
+			auto argumentFor = [&](std::string_view aArgId) -> const decoded_log_argument* {
+				const auto index = aArgId.empty() ? std::optional<size_t>{ nextArgId++ } : parse_arg_id(aArgId);
+				return index.has_value() && *index < aArgs.size() ? &aArgs[*index] : nullptr;
+			};
+
+			for (size_t i = 0; i < aFormat.size(); ++i) {
+				const auto c = aFormat[i];
+				if ('{' != c && '}' != c) {
+					aOut.push_back(c);
+					continue;
+				}
+				// Escaped braces:
+				if (i + 1 < aFormat.size() && aFormat[i + 1] == c) {
+					aOut.push_back(c);
+					++i;
+					continue;
+				}
+				if ('}' == c) {
+					aOut.push_back(c);
+					continue;
+				}
+
+				// Replacement field {arg-id:format-spec}, whose format-spec may contain nested replacement fields:
+				const auto end = find_end_of_replacement_field(aFormat, i + 1);
+				const auto field = aFormat.substr(i + 1, end - i - 1);
+				i = end;
+				const auto colon = field.find(':');
+				const auto* arg = argumentFor(field.substr(0, colon));
+
+				tField.assign("{:");
+				if (std::string_view::npos != colon) {
+					const auto spec = field.substr(colon + 1);
+					for (size_t j = 0; j < spec.size(); ++j) {
+						if ('{' != spec[j]) {
+							tField.push_back(spec[j]);
+							continue;
+						}
+						const auto nestedEnd = std::min(spec.find('}', j), spec.size());
+						const auto* nestedArg = argumentFor(spec.substr(j + 1, nestedEnd - j - 1));
+						j = nestedEnd;
+						std::visit([&](const auto& aValue) {
+							using T = std::remove_cvref_t<decltype(aValue)>;
+							if constexpr (std::is_same_v<T, int64_t> || std::is_same_v<T, uint64_t>) {
+								tField.append(std::to_string(aValue));
+							}
+							else {
+								tField.push_back('0');
+							}
+						}, nestedArg ? *nestedArg : decoded_log_argument{ int64_t{ 0 } });
+					}
+				}
+				tField.push_back('}');
+
+				if (nullptr == arg) {
+					aOut.append("{?}");
+					continue;
+				}
+				try {
+					std::visit([&](const auto& aValue) {
+						std::vformat_to(std::back_inserter(aOut), tField, std::make_format_args(aValue));
+					}, *arg);
+				}
+				catch (const std::format_error&) {
+					aOut.append("{?}");
+				}
+			}
+		}
+
+		void append_location(std::string& aOut, const log_site& aSite)
+		{
+			if (!aSite.mFile.empty()) {
+				std::format_to(std::back_inserter(aOut), " | file[{}] line[{}]", aSite.mFile, aSite.mLine);
+			}
+			aOut.push_back('\n');
+		}
+	}
+
+	void append_log_message(std::string& aOut, const log_site& aSite, std::string_view aFormat, std::string_view aArguments)
+	{
+		thread_local std::vector<decoded_log_argument> tArgs;
+		tArgs.clear();
+
+		aOut.append(aSite.mPrefix);
+		if (decode_log_arguments(aArguments, tArgs)) {
+			append_formatted(aOut, aFormat, tArgs);
+		}
+		else {
+			aOut.append(aFormat);
+			aOut.append(" (malformed arguments)");
+		}
+		append_location(aOut, aSite);
+	}
+
+	std::string compose_log_message(const log_site& aSite, std::string_view aFormatted)
+	{
+		std::string result;
+		result.reserve(aSite.mPrefix.size() + aFormatted.size() + aSite.mFile.size() + 32);
+		result.append(aSite.mPrefix);
+		result.append(aFormatted);
+		append_location(result, aSite);
+		return result;
+	}
+}
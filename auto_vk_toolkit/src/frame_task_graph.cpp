@@ -0,0 +1,106 @@
+#include "frame_task_graph.hpp"
+
+namespace avk
+{
+	frame_task_graph::task_id frame_task_graph::add_task(std::string aName, std::function<void()> aFunc, frame_task_access aAccess, bool aOnCallingThread)
+	{
+		const auto id = mTasks.size();
+		auto& t = mTasks.emplace_back(task{ std::move(aName), std::move(aFunc), std::move(aAccess), aOnCallingThread, {}, {} });
+		for (task_id other = 0; other < id; ++other) {
+			if (frame_task_access::conflict(mTasks[other].mAccess, t.mAccess)) {
+				t.mDependencies.push_back(other);
+				mTasks[other].mDependents.push_back(id);
+			}
+		}
+		return id;
+	}
+
+	void frame_task_graph::add_dependency(task_id aTask, task_id aPrerequisite)
+	{
+		if (aPrerequisite >= aTask || aTask >= mTasks.size()) {
+			throw avk::runtime_error(std::format("Task {} can not depend on task {}. Only dependencies on previously added tasks are supported.", aTask, aPrerequisite));
+		}
+		auto& deps = mTasks[aTask].mDependencies;
+		if (std::find(std::begin(deps), std::end(deps), aPrerequisite) == std::end(deps)) {
+			deps.push_back(aPrerequisite);
+			mTasks[aPrerequisite].mDependents.push_back(aTask);
+		}
+	}
+
+	void frame_task_graph::clear()
+	{
+		mTasks.clear();
+	}
+
+	void frame_task_graph::execute(parallel_invoker& aInvoker)
+	{
+		const auto n = mTasks.size();
+		if (0 == n) {
+			return;
+		}
+
+		std::vector<size_t> remainingDependencies(n);
+		std::deque<task_id> readyAnywhere;
+		std::deque<task_id> readyOnCallingThread;
+		for (task_id i = 0; i < n; ++i) {
+			remainingDependencies[i] = mTasks[i].mDependencies.size();
+			if (0 == remainingDependencies[i]) {
+				(mTasks[i].mOnCallingThread ? readyOnCallingThread : readyAnywhere).push_back(i);
+			}
+		}
+
+		std::mutex mutex;
+		std::condition_variable taskStateChanged;
+		size_t numFinished = 0;
+		std::exception_ptr firstException;
+
+		// Every thread runs this loop, and the calling thread (loop index 0) is the only one which may take tasks which are restricted to it:
+		auto loop = [&](size_t aLoopIndex) {
+			const bool isCallingThread = 0 == aLoopIndex;
+			std::unique_lock<std::mutex> lk(mutex);
+			while (true) {
+				taskStateChanged.wait(lk, [&] {
+					return numFinished == n || firstException || !readyAnywhere.empty() || (isCallingThread && !readyOnCallingThread.empty());
+				});
+				if (numFinished == n || firstException) {
+					return;
+				}
+
+				// The calling thread prefers its own tasks, since no other thread can execute them:
+				auto& readyQueue = isCallingThread && !readyOnCallingThread.empty() ? readyOnCallingThread : readyAnywhere;
+				const auto id = readyQueue.front();
+				readyQueue.pop_front();
+
+				lk.unlock();
+				std::exception_ptr exception;
+				try {
+					mTasks[id].mFunc();
+				}
+				catch (...) {
+					exception = std::current_exception();
+				}
+				lk.lock();
+
+				if (exception) {
+					if (!firstException) {
+						firstException = exception;
+					}
+				}
+				else {
+					++numFinished;
+					for (auto dependent : mTasks[id].mDependents) {
+						if (0 == --remainingDependencies[dependent]) {
+							(mTasks[dependent].mOnCallingThread ? readyOnCallingThread : readyAnywhere).push_back(dependent);
+						}
+					}
+				}
+				taskStateChanged.notify_all();
+			}
+		};
+		aInvoker.run(aInvoker.number_of_threads(), loop, 1);
+
+		if (firstException) {
+			std::rethrow_exception(firstException);
+		}
+	}
+}
@@ -0,0 +1,154 @@
+#include "gpu_profiler.hpp"
+#include "context_vulkan.hpp"
+
+namespace avk
+{
+	gpu_profiler::gpu_profiler(uint32_t aMaxZonesPerFrame)
+		: mMaxZonesPerFrame{ std::max(aMaxZonesPerFrame, 1u) }
+		, mTimestampPeriodNs{ 0.0 }
+		, mTimestampMask{ 0 }
+	{ }
+
+	avk::command::action_type_command gpu_profiler::zone(uint32_t aNameId, std::vector<avk::recorded_commands_t> aNestedCommands)
+	{
+		std::scoped_lock<std::mutex> guard(mMutex);
+		// mFrames stays empty if timestamps are not supported:
+		if (mFrames.empty() || mFrames[mCurrentInFlightIndex].mNameIds.size() >= mMaxZonesPerFrame) {
+			// Not measured, but the nested commands must still be recorded:
+			if (!mFrames.empty()) {
+				++mNumDroppedZones;
+			}
+			return avk::command::action_type_command{ {}, {}, {}, std::move(aNestedCommands) };
+		}
+
+		auto& frame = mFrames[mCurrentInFlightIndex];
+		const auto firstQuery = static_cast<uint32_t>(2 * frame.mNameIds.size());
+		frame.mNameIds.push_back(aNameId);
+
+		std::vector<avk::recorded_commands_t> commands;
+		commands.reserve(aNestedCommands.size() + 3);
+		commands.push_back(frame.mPool->reset(firstQuery, 2));
+		commands.push_back(frame.mPool->write_timestamp(firstQuery, avk::stage::all_commands));
+		std::move(std::begin(aNestedCommands), std::end(aNestedCommands), std::back_inserter(commands));
+		commands.push_back(frame.mPool->write_timestamp(firstQuery + 1, avk::stage::all_commands));
+		return avk::command::action_type_command{ {}, {}, {}, std::move(commands) };
+	}
+
+	avk::command::action_type_command gpu_profiler::zone(std::string_view aName, std::vector<avk::recorded_commands_t> aNestedCommands)
+	{
+		return zone(cpu_profile_name_id(aName), std::move(aNestedCommands));
+	}
+
+	void gpu_profiler::begin_frame(size_t aInFlightIndex, size_t aNumFramesInFlight, uint32_t aQueueFamilyIndex)
+	{
+		std::scoped_lock<std::mutex> guard(mMutex);
+		// The device might not have existed when this profiler has been created:
+		if (!mTimestampValidBits.has_value()) {
+			mTimestampPeriodNs = static_cast<double>(context().physical_device().getProperties().limits.timestampPeriod);
+			const auto queueFamilies = context().physical_device().getQueueFamilyProperties();
+			mTimestampValidBits = aQueueFamilyIndex < queueFamilies.size() ? queueFamilies[aQueueFamilyIndex].timestampValidBits : 0u;
+			mTimestampMask = mTimestampValidBits.value() >= 64 ? std::numeric_limits<uint64_t>::max() : (uint64_t{ 1 } << mTimestampValidBits.value()) - 1;
+			if (0 == mTimestampValidBits.value()) {
+				LOG_WARNING_F("Queue family {} does not support timestamps. GPU zones are not going to be measured.", aQueueFamilyIndex);
+			}
+		}
+		if (0 == mTimestampValidBits.value()) {
+			return;
+		}
+		// The number of frames in flight can change at runtime:
+		if (mFrames.size() < aNumFramesInFlight) {
+			mFrames.resize(aNumFramesInFlight);
+			for (auto& frame : mFrames) {
+				if (!frame.mPool.has_value()) {
+					frame.mPool = context().create_query_pool_for_timestamp_queries(2 * mMaxZonesPerFrame);
+				}
+			}
+		}
+
+		read_back(mFrames[aInFlightIndex]);
+		mFrames[aInFlightIndex].mNameIds.clear();
+		mCurrentInFlightIndex = aInFlightIndex;
+	}
+
+	void gpu_profiler::read_back(frame_queries& aFrame)
+	{
+		if (aFrame.mNameIds.empty()) {
+			return;
+		}
+
+		// Each query's result is followed by its availability, which is non-zero if the result is available:
+		struct result_with_availability
+		{
+			uint64_t mTimestamp;
+			uint64_t mAvailability;
+		};
+		thread_local std::vector<result_with_availability> tResults;
+		const auto numQueries = static_cast<uint32_t>(2 * aFrame.mNameIds.size());
+		tResults.resize(numQueries);
+		const auto result = context().device().getQueryPoolResults(
+			aFrame.mPool->handle(), 0u, numQueries,
+			tResults.size() * sizeof(result_with_availability), tResults.data(), sizeof(result_with_availability),
+			vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWithAvailability, // No eWait => never stalls
+			context().dispatch_loader_core()
+		);
+		if (vk::Result::eSuccess != result && vk::Result::eNotReady != result) {
+			LOG_WARNING_F("Reading back GPU profiler results failed with {}.", vk::to_string(result));
+			return;
+		}
+
+		// Only the lower timestampValidBits bits are valid, and the counter may wrap around between any two timestamps.
+		// Hence, all differences are taken modulo 2^timestampValidBits. Begin times are taken relative to a reference
+		// timestamp, and interpreted as signed, since zones which have been recorded later may have been executed earlier.
+		const auto mask = mTimestampMask;
+		const auto signedDifference = [mask](uint64_t aTo, uint64_t aFrom) {
+			const auto diff = (aTo - aFrom) & mask;
+			return diff > (mask >> 1) ? -static_cast<double>((mask - diff) + 1) : static_cast<double>(diff);
+		};
+		std::optional<uint64_t> reference;
+		double earliest = 0.0;
+		for (size_t i = 0; i < aFrame.mNameIds.size(); ++i) {
+			if (0 == tResults[2 * i].mAvailability) {
+				continue;
+			}
+			if (!reference.has_value()) {
+				reference = tResults[2 * i].mTimestamp;
+			}
+			earliest = std::min(earliest, signedDifference(tResults[2 * i].mTimestamp, reference.value()));
+		}
+
+		mLastFrameResults.clear();
+		for (size_t i = 0; i < aFrame.mNameIds.size(); ++i) {
+			const auto& begin = tResults[2 * i];
+			const auto& end = tResults[2 * i + 1];
+			if (0 == begin.mAvailability || 0 == end.mAvailability) {
+				continue;
+			}
+			const auto durationMs = static_cast<double>((end.mTimestamp - begin.mTimestamp) & mask) * mTimestampPeriodNs * 1e-6;
+			mLastFrameResults.push_back(gpu_profile_zone_result{
+				cpu_profile_name(aFrame.mNameIds[i]),
+				(signedDifference(begin.mTimestamp, reference.value()) - earliest) * mTimestampPeriodNs * 1e-6,
+				durationMs
+			});
+			mStatistics.add(aFrame.mNameIds[i], durationMs);
+		}
+		mStatistics.end_frame();
+	}
+
+	std::vector<gpu_profile_zone_result> gpu_profiler::last_frame_results() const
+	{
+		std::scoped_lock<std::mutex> guard(mMutex);
+		return mLastFrameResults;
+	}
+
+	std::vector<profile_zone_statistics> gpu_profiler::statistics() const
+	{
+		std::scoped_lock<std::mutex> guard(mMutex);
+		return mStatistics.statistics();
+	}
+
+	uint64_t gpu_profiler::number_of_dropped_zones() const
+	{
+		std::scoped_lock<std::mutex> guard(mMutex);
+		return mNumDroppedZones;
+	}
+}
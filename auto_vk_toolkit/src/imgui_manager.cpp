@@ -334,6 +334,9 @@ namespace avk
 		for (auto& cb : mCallback) {
 			cb();
 		}
+		if (mProfilerOverlayEnabled) {
+			draw_profiler_overlay();
+		}
 
 		auto& cmdBfr = aCommandBuffer;
 
@@ -402,6 +405,9 @@ namespace avk
 				for (auto& cb : mCallback) {
 					cb();
 				}
+				if (mProfilerOverlayEnabled) {
+					draw_profiler_overlay();
+				}
 				
 				// if no invokee has written on the attachment (no previous render calls this frame),
 				// reset layout (cannot be "store_in_presentable_format").
@@ -590,4 +596,112 @@ namespace avk
 		// Return the first DescriptorSet as ImTextureID
 		return (ImTextureID)sets[0].handle();
 	}
+
+	namespace
+	{
+		/** Draws a table of the given zones, the most expensive ones first */
+		void draw_profile_statistics_table(const char* aTableId, std::vector<profile_zone_statistics> aStatistics)
+		{
+			std::ranges::sort(aStatistics, std::ranges::greater{}, &profile_zone_statistics::mAverageMs);
+			if (!ImGui::BeginTable(aTableId, 6, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable)) {
+				return;
+			}
+			ImGui::TableSetupColumn("Zone", ImGuiTableColumnFlags_WidthStretch);
+			ImGui::TableSetupColumn("Last", ImGuiTableColumnFlags_WidthFixed);
+			ImGui::TableSetupColumn("Avg", ImGuiTableColumnFlags_WidthFixed);
+			ImGui::TableSetupColumn("Min", ImGuiTableColumnFlags_WidthFixed);
+			ImGui::TableSetupColumn("Max", ImGuiTableColumnFlags_WidthFixed);
+			ImGui::TableSetupColumn("Calls", ImGuiTableColumnFlags_WidthFixed);
+			ImGui::TableHeadersRow();
+			for (const auto& s : aStatistics) {
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(s.mName.data(), s.mName.data() + s.mName.size());
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", s.mLastMs);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", s.mAverageMs);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", s.mMinMs);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", s.mMaxMs);
+				ImGui::TableNextColumn();
+				ImGui::Text("%u", s.mCallsInLastFrame);
+			}
+			ImGui::EndTable();
+		}
+	}
+
+	void imgui_manager::draw_profiler_overlay()
+	{
+		ImGui::SetNextWindowSize(ImVec2(480.0f, 400.0f), ImGuiCond_FirstUseEver);
+		if (!ImGui::Begin("Profiler", &mProfilerOverlayEnabled)) {
+			ImGui::End();
+			return;
+		}
+
+		ImGui::Text("Timings in ms over the last %d frames", CPU_PROFILE_STATISTICS_FRAMES);
+		if (ImGui::CollapsingHeader("CPU", ImGuiTreeNodeFlags_DefaultOpen)) {
+			bool enabled = is_cpu_profiling_enabled();
+			if (ImGui::Checkbox("Record", &enabled)) {
+				set_cpu_profiling_enabled(enabled);
+			}
+			ImGui::SameLine();
+			if (ImGui::Button("Export Chrome trace")) {
+				const std::filesystem::path path = "cpu_profile.json";
+				try {
+					export_cpu_profile_chrome_trace(path);
+					LOG_INFO_F("Exported the CPU profile to '{}'.", std::filesystem::absolute(path).string());
+				}
+				catch (std::exception& e) {
+					LOG_ERROR(e.what());
+				}
+			}
+			draw_profile_statistics_table("##cpu_profile", cpu_profile_statistics_of_recent_frames());
+		}
+
+		// GPU zones are only measured if they have been enabled for the window:
+		const auto* gpuProfiler = context().main_window()->get_gpu_profiler();
+		if (nullptr != gpuProfiler && ImGui::CollapsingHeader("GPU", ImGuiTreeNodeFlags_DefaultOpen)) {
+			ImGui::Text("Zones not measured: %llu", static_cast<unsigned long long>(gpuProfiler->number_of_dropped_zones()));
+			draw_profile_statistics_table("##gpu_profile", gpuProfiler->statistics());
+		}
+
+		auto* wnd = context().main_window();
+		if (ImGui::CollapsingHeader("Frame latency")) {
+			bool pipelined = wnd->is_pipelined_acquire_enabled();
+			if (ImGui::Checkbox("Pipelined acquire", &pipelined)) {
+				wnd->enable_pipelined_acquire(pipelined);
+			}
+			ImGui::SameLine();
+			ImGui::Text("Frames in flight: %lld", static_cast<long long>(wnd->number_of_frames_in_flight()));
+
+			const auto& latencies = wnd->recent_frame_latencies();
+			const std::array<std::tuple<const char*, double window::frame_latency::*>, 4> phases{{
+				{ "Fence wait", &window::frame_latency::mFenceWaitMs },
+				{ "Acquire", &window::frame_latency::mAcquireMs },
+				{ "Acquire -> submit", &window::frame_latency::mAcquireToSubmitMs },
+				{ "Submit -> present", &window::frame_latency::mSubmitToPresentMs }
+			}};
+			if (!latencies.empty() && ImGui::BeginTable("##frame_latency", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable)) {
+				ImGui::TableSetupColumn("Phase", ImGuiTableColumnFlags_WidthStretch);
+				ImGui::TableSetupColumn("Avg", ImGuiTableColumnFlags_WidthFixed);
+				ImGui::TableSetupColumn("Max", ImGuiTableColumnFlags_WidthFixed);
+				ImGui::TableHeadersRow();
+				for (const auto& [label, member] : phases) {
+					double sum = 0.0, max = 0.0;
+					for (const auto& l : latencies) {
+						sum += l.*member;
+						max = std::max(max, l.*member);
+					}
+					ImGui::TableNextRow();
+					ImGui::TableNextColumn(); ImGui::TextUnformatted(label);
+					ImGui::TableNextColumn(); ImGui::Text("%.3f", sum / static_cast<double>(latencies.size()));
+					ImGui::TableNextColumn(); ImGui::Text("%.3f", max);
+				}
+				ImGui::EndTable();
+			}
+		}
+		ImGui::End();
+	}
 }
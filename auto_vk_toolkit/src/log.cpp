@@ -1,3 +1,5 @@
+#include "log_queue.hpp"
+
 #if defined(_WIN32) && defined (_DEBUG) && defined (PRINT_STACKTRACE)
 #include <Windows.h>
 #include <DbgHelp.h>
@@ -172,114 +174,246 @@ namespace avk
 #endif // WIN32
 	}
 
+	namespace
+	{
+		/** The sinks and settings which are shared by all logging threads */
+		struct log_state
+		{
+			std::mutex mSinksMutex;
+			std::vector<std::shared_ptr<log_sink>> mSinks{ std::make_shared<console_log_sink>() };
+			std::atomic<log_queue_full_policy> mQueueFullPolicy{ log_queue_full_policy::block };
+			std::atomic<uint64_t> mNumDropped{ 0 };
+
+			void write(std::span<const log_pack> aMessages, bool aFlush)
+			{
+				std::scoped_lock<std::mutex> guard(mSinksMutex);
+				for (auto& sink : mSinks) {
+					sink->write(aMessages);
+					if (aFlush) {
+						sink->flush();
+					}
+				}
+			}
+		};
+
+		log_state& the_log_state()
+		{
+			static log_state sLogState;
+			return sLogState;
+		}
+
+		std::string stacktrace_for(log_type aLogType)
+		{
+#if defined(_WIN32) && defined (_DEBUG) && defined (PRINT_STACKTRACE)
+			if (aLogType == log_type::error /*|| aLogType == log_type::warning*/) {
+				return get_current_callstack();
+			}
+#endif
+			return {};
+		}
+
 #ifdef LOGGING_ON_SEPARATE_THREAD
+		/**	Owns the logger thread, which takes messages from a log_queue in batches and writes them to the sinks.
+		 *	The sinks are flushed whenever the queue has run empty, or after LOG_QUEUE_CAPACITY messages.
+		 *	While there is nothing to do, the logger thread sleeps; logging threads only wake it up if it does.
+		 */
+		class logger_thread
+		{
+		public:
+			logger_thread()
+				: mState{ the_log_state() } // Ensure that the state is constructed before, and hence destroyed after this
+				, mQueue{ LOG_QUEUE_CAPACITY }
+				, mBatch(std::min<size_t>(LOG_QUEUE_CAPACITY, 64))
+				, mThread{ [this]() { run(); } }
+			{ }
 
-	void dispatch_log(log_pack pToBeLogged)
-	{
-		static std::mutex sLogMutex;
-		static std::condition_variable sCondVar;
-		static std::queue<log_pack> sLogQueue;
-		static bool sContinueLogging = true;
-		static std::thread sLogThread = std::thread([]() {
-			
-			avk::set_console_output_color(avk::log_type::system, avk::log_importance::important);
-			std::cout << "Logger thread started...";
-			avk::reset_console_output_color();
-			std::cout << std::endl;
-
-			while (sContinueLogging) {
-				// Process all messages
-				{
-					log_pack front;
-					bool empty;
-					// 1st lock => See if there is something
-					{
-						std::scoped_lock<std::mutex> guard(sLogMutex);
-						empty = sLogQueue.empty();
-						if (!empty)
-						{
-							front = sLogQueue.front();
-							sLogQueue.pop();
-						}
+			~logger_thread()
+			{
+				mStop.store(true);
+				wake();
+				mThread.join();
+			}
+
+			template <typename... Args>
+			void push(const Args&... aArgs)
+			{
+				while (!mQueue.try_push(aArgs...)) {
+					if (log_queue_full_policy::block != mState.mQueueFullPolicy.load(std::memory_order_relaxed)) {
+						mState.mNumDropped.fetch_add(1, std::memory_order_relaxed);
+						return;
+					}
+					if (mSleeping.exchange(false)) {
+						wake();
 					}
+					std::this_thread::yield();
+				}
+				mNumPushed.fetch_add(1);
+				// Pairs with the fence in run(): either the logger thread sees the message, or we see it sleeping.
+				// Only the first thread which sees it sleeping wakes it up, all others can skip the system call.
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				if (mSleeping.load(std::memory_order_relaxed) && mSleeping.exchange(false)) {
+					wake();
+				}
+			}
 
-					if (!sContinueLogging) continue;
-
-					// If we were able to successfully pop an element => handle it, i.e. print it
-					if (!empty)
-					{
-						// ACTUAL LOGGING:
-						avk::set_console_output_color(front.mLogType, front.mLogImportance);
-						std::cout << front.mMessage;
-						if (!front.mStacktrace.empty()) {
-							avk::set_console_output_color_for_stacktrace(front.mLogType, front.mLogImportance);
-							std::cout << front.mStacktrace;
+			void flush()
+			{
+				const auto target = mNumPushed.load();
+				wake();
+				auto written = mNumWritten.load();
+				while (written < target) {
+					mNumWritten.wait(written);
+					written = mNumWritten.load();
+				}
+			}
+
+		private:
+			void wake()
+			{
+				mSignal.fetch_add(1);
+				mSignal.notify_one();
+			}
+
+			void write_system_message(std::string aMessage)
+			{
+				const log_pack msg{ std::move(aMessage), log_type::system, log_importance::important };
+				mState.write(std::span(&msg, 1), true);
+			}
+
+			void run()
+			{
+				write_system_message("Logger thread started...\n");
+
+				uint64_t numUnflushed = 0;
+				uint64_t numReportedDropped = 0;
+				while (true) {
+					const auto n = mQueue.pop_batch(mBatch);
+					if (n > 0) {
+						for (size_t i = 0; i < n; ++i) {
+							if (nullptr != mBatch[i].mSite) {
+								append_log_message(mBatch[i].mMessage, *mBatch[i].mSite, mBatch[i].mFormat, mBatch[i].mArguments);
+							}
+						}
+						mState.write(std::span(mBatch.data(), n), false);
+						numUnflushed += n;
+						if (numUnflushed < LOG_QUEUE_CAPACITY) {
+							continue;
 						}
-						avk::reset_console_output_color();
+					}
 
-						// 2nd lock => get correct empty-value
-						{
-							std::scoped_lock<std::mutex> guard(sLogMutex);
-							empty = sLogQueue.empty();
-							if (!empty) continue;
+					if (log_queue_full_policy::count == mState.mQueueFullPolicy.load(std::memory_order_relaxed)) {
+						const auto numDropped = mState.mNumDropped.load(std::memory_order_relaxed);
+						if (numDropped != numReportedDropped) {
+							const log_pack msg{ std::format("WARN: {} log messages have been dropped, because the log queue was full.\n", numDropped - numReportedDropped), log_type::warning, log_importance::important };
+							mState.write(std::span(&msg, 1), false);
+							numReportedDropped = numDropped;
 						}
 					}
-				}
 
-				// No more messages => wait
-				{
-					std::unique_lock<std::mutex> lock(sLogMutex);
-					if (!sContinueLogging) {
+					if (numUnflushed > 0) {
+						mState.write({}, true);
+						mNumWritten.fetch_add(numUnflushed);
+						mNumWritten.notify_all();
+						numUnflushed = 0;
+						continue;
+					}
+
+					if (mStop.load()) {
 						break;
 					}
-					
-					sCondVar.wait(lock);
-				}
-			}
 
-			avk::set_console_output_color(avk::log_type::system, avk::log_importance::important);
-			std::cout << "Logger thread terminating.";
-			avk::reset_console_output_color();
-			std::cout << std::endl;
-		});
-		
-		static struct thread_stopper {
-			~thread_stopper() {
-				{
-					std::unique_lock<std::mutex> lock(sLogMutex);
-					sContinueLogging = false;
+					// Nothing to do => sleep until a message is pushed, someone waits for a flush, or we shall stop:
+					const auto signal = mSignal.load();
+					mSleeping.store(true, std::memory_order_relaxed);
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+					if (mQueue.empty() && !mStop.load()) {
+						mSignal.wait(signal);
+					}
+					mSleeping.store(false, std::memory_order_relaxed);
 				}
-				sCondVar.notify_one();
-				sLogThread.join();
+
+				write_system_message("Logger thread terminating.\n");
 			}
-		} sThreadStopper;
 
-		// Enqueue the message and wake the logger thread
+			log_state& mState;
+			log_queue mQueue;
+			std::vector<log_pack> mBatch;
+			std::atomic<uint64_t> mNumPushed{ 0 };
+			std::atomic<uint64_t> mNumWritten{ 0 };
+			std::atomic<uint32_t> mSignal{ 0 };
+			std::atomic<bool> mSleeping{ false };
+			std::atomic<bool> mStop{ false };
+			std::thread mThread;
+		};
+
+		logger_thread& the_logger_thread()
 		{
-			std::scoped_lock<std::mutex> guard(sLogMutex);
-#if defined(_WIN32) && defined (_DEBUG) && defined (PRINT_STACKTRACE)
-			if (pToBeLogged.mLogType == log_type::error || pToBeLogged.mLogType == log_type::warning) {
-				pToBeLogged.mStacktrace = get_current_callstack();
-			}
-#endif
-			sLogQueue.push(pToBeLogged);
+			static logger_thread sLoggerThread;
+			return sLoggerThread;
 		}
-		sCondVar.notify_one();
+#endif
 	}
-#else
+
 	void dispatch_log(log_pack pToBeLogged)
 	{
-		avk::set_console_output_color(pToBeLogged.mLogType, pToBeLogged.mLogImportance);
-		std::cout << pToBeLogged.mMessage;
-#if defined(_WIN32) && defined (_DEBUG) && defined (PRINT_STACKTRACE)
-		if (pToBeLogged.mLogType == log_type::error /*|| pToBeLogged.mLogType == log_type::warning*/) {
-			set_console_output_color_for_stacktrace(pToBeLogged.mLogType, pToBeLogged.mLogImportance);
-			std::cout << get_current_callstack();
-		}
+		pToBeLogged.mStacktrace = stacktrace_for(pToBeLogged.mLogType);
+#ifdef LOGGING_ON_SEPARATE_THREAD
+		the_logger_thread().push(pToBeLogged);
+#else
+		the_log_state().write(std::span(&pToBeLogged, 1), false);
+#endif
+	}
+
+	void dispatch_log(const log_site& aSite, std::string_view aFormat, std::string_view aArguments)
+	{
+#ifdef LOGGING_ON_SEPARATE_THREAD
+		the_logger_thread().push(aSite, aFormat, aArguments, stacktrace_for(aSite.mLogType));
+#else
+		thread_local log_pack tToBeLogged;
+		tToBeLogged.mMessage.clear();
+		append_log_message(tToBeLogged.mMessage, aSite, aFormat, aArguments);
+		tToBeLogged.mLogType = aSite.mLogType;
+		tToBeLogged.mLogImportance = aSite.mLogImportance;
+		tToBeLogged.mStacktrace = stacktrace_for(aSite.mLogType);
+		tToBeLogged.mSite = &aSite;
+		tToBeLogged.mFormat = aFormat;
+		tToBeLogged.mArguments.assign(aArguments);
+		the_log_state().write(std::span(&tToBeLogged, 1), false);
 #endif
-		avk::reset_console_output_color();
 	}
+
+	void set_log_sinks(std::vector<std::shared_ptr<log_sink>> aSinks)
+	{
+		auto& state = the_log_state();
+		std::scoped_lock<std::mutex> guard(state.mSinksMutex);
+		state.mSinks = std::move(aSinks);
+	}
+
+	void add_log_sink(std::shared_ptr<log_sink> aSink)
+	{
+		auto& state = the_log_state();
+		std::scoped_lock<std::mutex> guard(state.mSinksMutex);
+		state.mSinks.push_back(std::move(aSink));
+	}
+
+	void set_log_queue_full_policy(log_queue_full_policy aPolicy)
+	{
+		the_log_state().mQueueFullPolicy.store(aPolicy);
+	}
+
+	uint64_t number_of_dropped_log_messages()
+	{
+		return the_log_state().mNumDropped.load();
+	}
+
+	void flush_log()
+	{
+#ifdef LOGGING_ON_SEPARATE_THREAD
+		the_logger_thread().flush();
+#else
+		the_log_state().write({}, true);
 #endif
+	}
 
 	std::string to_string(const glm::mat4& pMatrix)
 	{
@@ -0,0 +1,120 @@
+#include "log_queue.hpp"
+
+namespace avk
+{
+	log_queue::log_queue(size_t aCapacity, size_t aReservedMessageLength)
+		: mReservedMessageLength{ aReservedMessageLength }
+	{
+		size_t capacity = 2;
+		while (capacity < aCapacity) {
+			capacity *= 2;
+		}
+		mMask = capacity - 1;
+		mSlots = std::make_unique<slot[]>(capacity);
+		for (size_t i = 0; i < capacity; ++i) {
+			mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+			mSlots[i].mMessage.mMessage.reserve(mReservedMessageLength);
+			mSlots[i].mMessage.mArguments.reserve(mReservedMessageLength);
+		}
+	}
+
+	std::optional<size_t> log_queue::claim()
+	{
+		auto pos = mEnqueuePosition.load(std::memory_order_relaxed);
+		while (true) {
+			const auto seq = mSlots[pos & mMask].mSequence.load(std::memory_order_acquire);
+			const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+			if (0 == diff) {
+				// The slot is free => try to claim it:
+				if (mEnqueuePosition.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					return pos;
+				}
+			}
+			else if (diff < 0) {
+				// The slot still holds the message which has been pushed one round before => full
+				return {};
+			}
+			else {
+				// Another producer has claimed the slot in the meantime
+				pos = mEnqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	void log_queue::publish(size_t aPosition)
+	{
+		mSlots[aPosition & mMask].mSequence.store(aPosition + 1, std::memory_order_release);
+	}
+
+	bool log_queue::try_push(const log_pack& aMessage)
+	{
+		const auto pos = claim();
+		if (!pos.has_value()) {
+			return false;
+		}
+
+		// assign keeps the slot's reserved buffers, if they are large enough:
+		auto& msg = mSlots[*pos & mMask].mMessage;
+		msg.mMessage.assign(aMessage.mMessage);
+		msg.mLogType = aMessage.mLogType;
+		msg.mLogImportance = aMessage.mLogImportance;
+		msg.mStacktrace.assign(aMessage.mStacktrace);
+		msg.mSite = aMessage.mSite;
+		msg.mFormat = aMessage.mFormat;
+		msg.mArguments.assign(aMessage.mArguments);
+		publish(*pos);
+		return true;
+	}
+
+	bool log_queue::try_push(const log_site& aSite, std::string_view aFormat, std::string_view aArguments, std::string_view aStacktrace)
+	{
+		const auto pos = claim();
+		if (!pos.has_value()) {
+			return false;
+		}
+
+		auto& msg = mSlots[*pos & mMask].mMessage;
+		msg.mLogType = aSite.mLogType;
+		msg.mLogImportance = aSite.mLogImportance;
+		msg.mStacktrace.assign(aStacktrace);
+		msg.mSite = &aSite;
+		msg.mFormat = aFormat;
+		msg.mArguments.assign(aArguments);
+		publish(*pos);
+		return true;
+	}
+
+	size_t log_queue::pop_batch(std::span<log_pack> aBatch)
+	{
+		size_t n = 0;
+		for (; n < aBatch.size(); ++n) {
+			auto& s = mSlots[mDequeuePosition & mMask];
+			if (s.mSequence.load(std::memory_order_acquire) != mDequeuePosition + 1) {
+				break;
+			}
+
+			std::swap(aBatch[n], s.mMessage);
+			s.mMessage.mMessage.clear();
+			s.mMessage.mStacktrace.clear();
+			s.mMessage.mSite = nullptr;
+			s.mMessage.mFormat = {};
+			s.mMessage.mArguments.clear();
+			if (s.mMessage.mMessage.capacity() < mReservedMessageLength) {
+				s.mMessage.mMessage.reserve(mReservedMessageLength);
+			}
+			if (s.mMessage.mArguments.capacity() < mReservedMessageLength) {
+				s.mMessage.mArguments.reserve(mReservedMessageLength);
+			}
+
+			// Free the slot for the producer which pushes one round later:
+			s.mSequence.store(mDequeuePosition + capacity(), std::memory_order_release);
+			++mDequeuePosition;
+		}
+		return n;
+	}
+
+	bool log_queue::empty() const
+	{
+		return mSlots[mDequeuePosition & mMask].mSequence.load(std::memory_order_acquire) != mDequeuePosition + 1;
+	}
+}
@@ -0,0 +1,269 @@
+#include "log_sinks.hpp"
+
+namespace avk
+{
+	void console_log_sink::write(std::span<const log_pack> aMessages)
+	{
+		for (const auto& msg : aMessages) {
+			set_console_output_color(msg.mLogType, msg.mLogImportance);
+			std::cout << msg.mMessage;
+			if (!msg.mStacktrace.empty()) {
+				set_console_output_color_for_stacktrace(msg.mLogType, msg.mLogImportance);
+				std::cout << msg.mStacktrace;
+			}
+		}
+		reset_console_output_color();
+	}
+
+	void console_log_sink::flush()
+	{
+		std::cout.flush();
+	}
+
+	rotating_file_log_sink::rotating_file_log_sink(std::filesystem::path aPath, size_t aMaxFileSize, size_t aMaxNumFiles)
+		: mPath{ std::move(aPath) }
+		, mMaxFileSize{ aMaxFileSize }
+		, mMaxNumFiles{ std::max(aMaxNumFiles, size_t{ 1 }) }
+		, mFile{ mPath, std::ios::out | std::ios::trunc | std::ios::binary }
+	{
+		if (!mFile.is_open()) {
+			throw avk::runtime_error(std::format("Unable to open log file '{}'.", mPath.string()));
+		}
+	}
+
+	void rotating_file_log_sink::write(std::span<const log_pack> aMessages)
+	{
+		for (const auto& msg : aMessages) {
+			const auto size = msg.mMessage.size() + msg.mStacktrace.size();
+			if (mCurrentFileSize > 0 && mCurrentFileSize + size > mMaxFileSize) {
+				rotate();
+			}
+			mFile.write(msg.mMessage.data(), static_cast<std::streamsize>(msg.mMessage.size()));
+			mFile.write(msg.mStacktrace.data(), static_cast<std::streamsize>(msg.mStacktrace.size()));
+			mCurrentFileSize += size;
+		}
+	}
+
+	void rotating_file_log_sink::flush()
+	{
+		mFile.flush();
+	}
+
+	void rotating_file_log_sink::rotate()
+	{
+		mFile.close();
+		auto numbered = [this](size_t aNumber) {
+			auto p = mPath;
+			p += std::format(".{}", aNumber);
+			return p;
+		};
+
+		// Shift <path>.1 -> <path>.2 etc., where the oldest one is overwritten; <path> becomes <path>.1
+		std::error_code ec;
+		if (mMaxNumFiles > 1) {
+			for (auto i = mMaxNumFiles - 1; i > 1; --i) {
+				std::filesystem::rename(numbered(i - 1), numbered(i), ec);
+			}
+			std::filesystem::rename(mPath, numbered(1), ec);
+		}
+
+		mFile.open(mPath, std::ios::out | std::ios::trunc | std::ios::binary);
+		mCurrentFileSize = 0;
+	}
+
+	namespace
+	{
+		constexpr char sBinaryLogMagic[] = { 'A', 'V', 'K', 'L', 'O', 'G' };
+		constexpr uint8_t sBinaryLogVersion = 1;
+
+		// Record types of binary log files:
+		constexpr char sBinaryLogSiteRecord = 'S';
+		constexpr char sBinaryLogDeferredRecord = 'D';
+		constexpr char sBinaryLogMessageRecord = 'M';
+	}
+
+	binary_log_sink::binary_log_sink(std::filesystem::path aPath)
+		: mFile{ aPath, std::ios::out | std::ios::trunc | std::ios::binary }
+	{
+		if (!mFile.is_open()) {
+			throw avk::runtime_error(std::format("Unable to open log file '{}'.", aPath.string()));
+		}
+		mFile.write(sBinaryLogMagic, sizeof(sBinaryLogMagic));
+		mFile.put(static_cast<char>(sBinaryLogVersion));
+	}
+
+	void binary_log_sink::write_string(std::string_view aString)
+	{
+		const auto size = static_cast<uint32_t>(aString.size());
+		mFile.write(reinterpret_cast<const char*>(&size), sizeof(size));
+		mFile.write(aString.data(), size);
+	}
+
+	void binary_log_sink::write(std::span<const log_pack> aMessages)
+	{
+		for (const auto& msg : aMessages) {
+			if (nullptr == msg.mSite) {
+				mFile.put(sBinaryLogMessageRecord);
+				mFile.put(static_cast<char>(msg.mLogType));
+				mFile.put(static_cast<char>(msg.mLogImportance));
+				write_string(msg.mMessage);
+				write_string(msg.mStacktrace);
+				continue;
+			}
+
+			// The same site can be used with different format strings, hence both make up a site of the file:
+			const auto [it, isNewSite] = mSiteIndices.try_emplace({ msg.mSite, msg.mFormat.data() }, static_cast<uint32_t>(mSiteIndices.size()));
+			if (isNewSite) {
+				const auto& site = *msg.mSite;
+				mFile.put(sBinaryLogSiteRecord);
+				mFile.put(static_cast<char>(site.mLogType));
+				mFile.put(static_cast<char>(site.mLogImportance));
+				const auto line = static_cast<int32_t>(site.mLine);
+				mFile.write(reinterpret_cast<const char*>(&line), sizeof(line));
+				write_string(site.mPrefix);
+				write_string(site.mFile);
+				write_string(msg.mFormat);
+			}
+			mFile.put(sBinaryLogDeferredRecord);
+			mFile.write(reinterpret_cast<const char*>(&it->second), sizeof(it->second));
+			write_string(msg.mArguments);
+			write_string(msg.mStacktrace);
+		}
+	}
+
+	void binary_log_sink::flush()
+	{
+		mFile.flush();
+	}
+
+	std::vector<log_pack> binary_log_sink::read(const std::filesystem::path& aPath)
+	{
+		std::ifstream file{ aPath, std::ios::in | std::ios::binary };
+		if (!file.is_open()) {
+			throw avk::runtime_error(std::format("Unable to open log file '{}'.", aPath.string()));
+		}
+
+		auto fail = [&aPath]() {
+			throw avk::runtime_error(std::format("Log file '{}' is malformed or truncated.", aPath.string()));
+		};
+		auto readBytes = [&](void* aDst, size_t aSize) {
+			if (!file.read(static_cast<char*>(aDst), static_cast<std::streamsize>(aSize))) {
+				fail();
+			}
+		};
+		auto readString = [&]() {
+			uint32_t size;
+			readBytes(&size, sizeof(size));
+			std::string result(size, '\0');
+			readBytes(result.data(), size);
+			return result;
+		};
+
+		char magic[sizeof(sBinaryLogMagic)];
+		uint8_t version;
+		readBytes(magic, sizeof(magic));
+		readBytes(&version, sizeof(version));
+		if (!std::equal(std::begin(magic), std::end(magic), std::begin(sBinaryLogMagic)) || sBinaryLogVersion != version) {
+			throw avk::runtime_error(std::format("File '{}' is not a binary log file of a supported version.", aPath.string()));
+		}
+
+		// The sites' strings must stay in place, since the log_site instances refer to them:
+		struct stored_site
+		{
+			std::string mPrefix;
+			std::string mFile;
+			std::string mFormat;
+			log_site mSite;
+		};
+		std::deque<stored_site> sites;
+
+		std::vector<log_pack> result;
+		char recordType;
+		while (file.get(recordType)) {
+			uint8_t type, importance;
+			switch (recordType) {
+			case sBinaryLogSiteRecord: {
+				int32_t line;
+				readBytes(&type, sizeof(type));
+				readBytes(&importance, sizeof(importance));
+				readBytes(&line, sizeof(line));
+				auto& s = sites.emplace_back();
+				s.mPrefix = readString();
+				s.mFile = readString();
+				s.mFormat = readString();
+				s.mSite = log_site{ s.mPrefix, s.mFile, line, static_cast<log_type>(type), static_cast<log_importance>(importance) };
+				break;
+			}
+			case sBinaryLogDeferredRecord: {
+				uint32_t index;
+				readBytes(&index, sizeof(index));
+				if (index >= sites.size()) {
+					fail();
+				}
+				const auto& s = sites[index];
+				const auto arguments = readString();
+				auto& msg = result.emplace_back(log_pack{ {}, s.mSite.mLogType, s.mSite.mLogImportance, readString() });
+				append_log_message(msg.mMessage, s.mSite, s.mFormat, arguments);
+				break;
+			}
+			case sBinaryLogMessageRecord: {
+				readBytes(&type, sizeof(type));
+				readBytes(&importance, sizeof(importance));
+				auto message = readString();
+				result.push_back(log_pack{ std::move(message), static_cast<log_type>(type), static_cast<log_importance>(importance), readString() });
+				break;
+			}
+			default:
+				fail();
+			}
+		}
+		return result;
+	}
+
+	memory_log_sink::memory_log_sink(size_t aCapacity)
+		: mCapacity{ std::max(aCapacity, size_t{ 1 }) }
+	{
+		mRing.reserve(mCapacity);
+	}
+
+	void memory_log_sink::write(std::span<const log_pack> aMessages)
+	{
+		std::scoped_lock<std::mutex> guard(mMutex);
+		for (const auto& msg : aMessages) {
+			if (mRing.size() < mCapacity) {
+				mRing.push_back(msg);
+			}
+			else {
+				mRing[mTotal % mCapacity] = msg;
+			}
+			++mTotal;
+		}
+	}
+
+	std::vector<log_pack> memory_log_sink::messages() const
+	{
+		std::scoped_lock<std::mutex> guard(mMutex);
+		if (mRing.size() < mCapacity) {
+			return mRing;
+		}
+		std::vector<log_pack> result;
+		result.reserve(mCapacity);
+		const auto oldest = mTotal % mCapacity;
+		result.insert(std::end(result), std::begin(mRing) + oldest, std::end(mRing));
+		result.insert(std::end(result), std::begin(mRing), std::begin(mRing) + oldest);
+		return result;
+	}
+
+	size_t memory_log_sink::total_number_of_messages() const
+	{
+		std::scoped_lock<std::mutex> guard(mMutex);
+		return mTotal;
+	}
+
+	void memory_log_sink::clear()
+	{
+		std::scoped_lock<std::mutex> guard(mMutex);
+		mRing.clear();
+		mTotal = 0;
+	}
+}
@@ -2,9 +2,77 @@
 #include "image_data.hpp"
 #include "material_image_helpers.hpp"
 #include "serializer.hpp"
+#include "parallel_for.hpp"
 
 namespace avk
 {
+	/** Position of one mesh's data within the combined data of multiple meshes */
+	struct mesh_data_slice
+	{
+		const avk::model_t* mModel;
+		avk::mesh_index_t mMeshIndex;
+		size_t mSelectionIndex;	// index of the mesh among all selected meshes of all models
+		size_t mOffset;
+		size_t mCount;
+	};
+
+	/** Computes where each of the selected meshes' data is located in the combined data, which is
+	 *	the exclusive prefix sum over the counts returned by aCountFunc, in selection order.
+	 *	@param	aCountFunc			Function with signature size_t(const model_t&, mesh_index_t)
+	 *	@param	aTotalCount			Receives the total count of all selected meshes
+	 */
+	template <typename F>
+	static std::vector<mesh_data_slice> compute_mesh_data_slices(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, F aCountFunc, size_t& aTotalCount)
+	{
+		std::vector<mesh_data_slice> slices;
+		aTotalCount = 0;
+		for (auto& pair : aModelsAndSelectedMeshes) {
+			const auto& modelRef = std::get<const avk::model_t&>(pair);
+			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
+				const auto count = aCountFunc(modelRef, meshIndex);
+				slices.push_back(mesh_data_slice{ &modelRef, meshIndex, slices.size(), aTotalCount, count });
+				aTotalCount += count;
+			}
+		}
+		return slices;
+	}
+
+	/** Gathers per-vertex data of all the selected meshes into one vector. The vector is allocated
+	 *	once, and every mesh's data is written directly into its slice of it, with the meshes
+	 *	being processed in parallel.
+	 *	@param	aWriteFunc			Function with signature void(const mesh_data_slice&, std::span<T>) which
+	 *								writes the mesh's data into the given span, e.g. via `model_t::normals_for_mesh_into`
+	 */
+	template <typename T, typename F>
+	static std::vector<T> gather_vertex_data_for_meshes(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, F aWriteFunc)
+	{
+		size_t totalVertices;
+		const auto slices = compute_mesh_data_slices(aModelsAndSelectedMeshes, [](const avk::model_t& aModel, avk::mesh_index_t aMeshIndex) { return aModel.number_of_vertices_for_mesh(aMeshIndex); }, totalVertices);
+
+		std::vector<T> result(totalVertices);
+		parallel_for(slices.size(), [&](size_t i) {
+			const auto& slice = slices[i];
+			aWriteFunc(slice, std::span<T>(result).subspan(slice.mOffset, slice.mCount));
+		});
+		return result;
+	}
+
+	/** Gathers per-vertex data of all the selected meshes into one vector of packed values. Every mesh's
+	 *	full precision data is read into a scratch buffer first, and then packed into its slice of the result.
+	 *	@param	aReadFunc			Function with signature void(const mesh_data_slice&, std::span<U>) which
+	 *								writes the mesh's full precision data into the given span
+	 *	@param	aPackFunc			Function with signature T(const U&) which packs one element
+	 */
+	template <typename T, typename U, typename R, typename P>
+	static std::vector<T> gather_packed_vertex_data_for_meshes(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, R aReadFunc, P aPackFunc)
+	{
+		return gather_vertex_data_for_meshes<T>(aModelsAndSelectedMeshes, [&](const mesh_data_slice& aSlice, std::span<T> aDestination) {
+			std::vector<U> scratch(aSlice.mCount);
+			aReadFunc(aSlice, std::span<U>(scratch));
+			std::transform(std::begin(scratch), std::end(scratch), std::begin(aDestination), aPackFunc);
+		});
+	}
+
 	std::tuple<avk::image, avk::command::action_type_command> create_cubemap_from_image_data_cached(image_data& aImageData, avk::layout::image_layout aImageLayout, avk::memory_usage aMemoryUsage, avk::image_usage aImageUsage, std::optional<std::reference_wrapper<avk::serializer>> aSerializer)
 	{
 		// image must have flag set to be used for cube map
@@ -225,20 +293,21 @@ namespace avk
 		return avk::create_image_from_image_data_cached(imageData, aImageLayout, aMemoryUsage, aImageUsage, aSerializer);
 	}
 
-	std::tuple<std::vector<glm::vec3>, std::vector<uint32_t>> get_vertices_and_indices(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
+	std::tuple<std::vector<glm::vec3>, std::vector<uint32_t>> get_vertices_and_indices(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, size_t aMaxThreads)
 	{
-		std::vector<glm::vec3> positionsData;
-		std::vector<uint32_t> indicesData;
+		size_t totalVertices, totalIndices;
+		const auto vertexSlices = compute_mesh_data_slices(aModelsAndSelectedMeshes, [](const avk::model_t& aModel, avk::mesh_index_t aMeshIndex) { return aModel.number_of_vertices_for_mesh(aMeshIndex); }, totalVertices);
+		const auto indexSlices = compute_mesh_data_slices(aModelsAndSelectedMeshes, [](const avk::model_t& aModel, avk::mesh_index_t aMeshIndex) { return static_cast<size_t>(aModel.number_of_indices_for_mesh(aMeshIndex)); }, totalIndices);
 
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				avk::append_indices_and_vertex_data(
-					avk::additional_index_data(	indicesData,	[&]() { return modelRef.indices_for_mesh<uint32_t>(meshIndex);	} ),
-					avk::additional_vertex_data(positionsData,	[&]() { return modelRef.positions_for_mesh(meshIndex);			} )
-				);
-			}
-		}
+		std::vector<glm::vec3> positionsData(totalVertices);
+		std::vector<uint32_t> indicesData(totalIndices);
+		parallel_for(vertexSlices.size(), [&](size_t i) {
+			const auto& vertexSlice = vertexSlices[i];
+			const auto& indexSlice = indexSlices[i];
+			vertexSlice.mModel->positions_for_mesh_into(vertexSlice.mMeshIndex, std::span<glm::vec3>(positionsData).subspan(vertexSlice.mOffset, vertexSlice.mCount));
+			// Indices refer to the mesh's vertices => offset them by the number of vertices of all meshes before:
+			indexSlice.mModel->indices_for_mesh_into<uint32_t>(indexSlice.mMeshIndex, std::span<uint32_t>(indicesData).subspan(indexSlice.mOffset, indexSlice.mCount), static_cast<uint32_t>(vertexSlice.mOffset));
+		}, aMaxThreads);
 
 		return std::make_tuple( std::move(positionsData), std::move(indicesData) );
 	}
@@ -255,16 +324,9 @@ namespace avk
 
 	std::vector<glm::vec3> get_normals(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
 	{
-		std::vector<glm::vec3> normalsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(normalsData, modelRef.normals_for_mesh(meshIndex));
-			}
-		}
-
-		return normalsData;
+		return gather_vertex_data_for_meshes<glm::vec3>(aModelsAndSelectedMeshes, [&](const mesh_data_slice& aSlice, std::span<glm::vec3> aDestination) {
+			aSlice.mModel->normals_for_mesh_into(aSlice.mMeshIndex, aDestination);
+		});
 	}
 
 	std::vector<glm::vec3> get_normals_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
@@ -280,16 +342,9 @@ namespace avk
 
 	std::vector<glm::vec3> get_tangents(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
 	{
-		std::vector<glm::vec3> tangentsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(tangentsData, modelRef.tangents_for_mesh(meshIndex));
-			}
-		}
-
-		return tangentsData;
+		return gather_vertex_data_for_meshes<glm::vec3>(aModelsAndSelectedMeshes, [&](const mesh_data_slice& aSlice, std::span<glm::vec3> aDestination) {
+			aSlice.mModel->tangents_for_mesh_into(aSlice.mMeshIndex, aDestination);
+		});
 	}
 
 	std::vector<glm::vec3> get_tangents_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
@@ -307,16 +362,9 @@ namespace avk
 
 	std::vector<glm::vec3> get_bitangents(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
 	{
-		std::vector<glm::vec3> bitangentsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(bitangentsData, modelRef.bitangents_for_mesh(meshIndex));
-			}
-		}
-
-		return bitangentsData;
+		return gather_vertex_data_for_meshes<glm::vec3>(aModelsAndSelectedMeshes, [&](const mesh_data_slice& aSlice, std::span<glm::vec3> aDestination) {
+			aSlice.mModel->bitangents_for_mesh_into(aSlice.mMeshIndex, aDestination);
+		});
 	}
 
 	std::vector<glm::vec3> get_bitangents_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
@@ -333,16 +381,9 @@ namespace avk
 
 	std::vector<glm::vec4> get_colors(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aColorsSet)
 	{
-		std::vector<glm::vec4> colorsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(colorsData, modelRef.colors_for_mesh(meshIndex, aColorsSet));
-			}
-		}
-
-		return colorsData;
+		return gather_vertex_data_for_meshes<glm::vec4>(aModelsAndSelectedMeshes, [&](const mesh_data_slice& aSlice, std::span<glm::vec4> aDestination) {
+			aSlice.mModel->colors_for_mesh_into(aSlice.mMeshIndex, aDestination, aColorsSet);
+		});
 	}
 
 	std::vector<glm::vec4> get_colors_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aColorsSet)
@@ -360,16 +401,9 @@ namespace avk
 
 	std::vector<glm::vec4> get_bone_weights(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aNormalizeBoneWeights)
 	{
-		std::vector<glm::vec4> boneWeightsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(boneWeightsData, modelRef.bone_weights_for_mesh(meshIndex, aNormalizeBoneWeights));
-			}
-		}
-
-		return boneWeightsData;
+		return gather_vertex_data_for_meshes<glm::vec4>(aModelsAndSelectedMeshes, [&](const mesh_data_slice& aSlice, std::span<glm::vec4> aDestination) {
+			aSlice.mModel->bone_weights_for_mesh_into(aSlice.mMeshIndex, aDestination, aNormalizeBoneWeights);
+		});
 	}
 
 	std::vector<glm::vec4> get_bone_weights_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, bool aNormalizeBoneWeights)
@@ -386,16 +420,9 @@ namespace avk
 
 	std::vector<glm::uvec4> get_bone_indices(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset)
 	{
-		std::vector<glm::uvec4> boneIndicesData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(boneIndicesData, modelRef.bone_indices_for_mesh(meshIndex, aBoneIndexOffset));
-			}
-		}
-
-		return boneIndicesData;
+		return gather_vertex_data_for_meshes<glm::uvec4>(aModelsAndSelectedMeshes, [&](const mesh_data_slice& aSlice, std::span<glm::uvec4> aDestination) {
+			aSlice.mModel->bone_indices_for_mesh_into(aSlice.mMeshIndex, aDestination, aBoneIndexOffset);
+		});
 	}
 
 	std::vector<glm::uvec4> get_bone_indices_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aBoneIndexOffset)
@@ -412,14 +439,20 @@ namespace avk
 
 	std::vector<glm::uvec4> get_bone_indices_for_single_target_buffer(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aInitialBoneIndexOffset)
 	{
-		std::vector<glm::uvec4> boneIndicesData;
-
+		// The bone index offset of each mesh depends on all the meshes of the same model before it => determine them upfront:
+		std::vector<uint32_t> boneIndexOffsets;
 		for (auto& pair : aModelsAndSelectedMeshes) {
 			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			insert_into(boneIndicesData, modelRef.bone_indices_for_meshes_for_single_target_buffer(std::get<std::vector<avk::mesh_index_t>>(pair), aInitialBoneIndexOffset));
+			uint32_t offset = aInitialBoneIndexOffset;
+			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
+				boneIndexOffsets.push_back(offset);
+				offset += modelRef.num_bone_matrices(meshIndex);
+			}
 		}
 
-		return boneIndicesData;
+		return gather_vertex_data_for_meshes<glm::uvec4>(aModelsAndSelectedMeshes, [&](const mesh_data_slice& aSlice, std::span<glm::uvec4> aDestination) {
+			aSlice.mModel->bone_indices_for_mesh_into(aSlice.mMeshIndex, aDestination, boneIndexOffsets[aSlice.mSelectionIndex]);
+		});
 	}
 
 	std::vector<glm::uvec4> get_bone_indices_for_single_target_buffer_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, uint32_t aInitialBoneIndexOffset)
@@ -436,16 +469,9 @@ namespace avk
 
 	std::vector<glm::uvec4> get_bone_indices_for_single_target_buffer(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, const std::vector<mesh_index_t>& aReferenceMeshIndices)
 	{
-		std::vector<glm::uvec4> boneIndicesData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(boneIndicesData, modelRef.bone_indices_for_mesh_for_single_target_buffer(meshIndex, aReferenceMeshIndices));
-			}
-		}
-
-		return boneIndicesData;
+		return gather_vertex_data_for_meshes<glm::uvec4>(aModelsAndSelectedMeshes, [&](const mesh_data_slice& aSlice, std::span<glm::uvec4> aDestination) {
+			aSlice.mModel->bone_indices_for_mesh_for_single_target_buffer_into(aSlice.mMeshIndex, aReferenceMeshIndices, aDestination);
+		});
 	}
 
 	std::vector<glm::uvec4> get_bone_indices_for_single_target_buffer_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, const std::vector<mesh_index_t>& aReferenceMeshIndices)
@@ -462,16 +488,9 @@ namespace avk
 
 	std::vector<glm::vec2> get_2d_texture_coordinates(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
 	{
-		std::vector<glm::vec2> texCoordsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(texCoordsData, modelRef.texture_coordinates_for_mesh<glm::vec2>(meshIndex, aTexCoordSet));
-			}
-		}
-
-		return texCoordsData;
+		return gather_vertex_data_for_meshes<glm::vec2>(aModelsAndSelectedMeshes, [&](const mesh_data_slice& aSlice, std::span<glm::vec2> aDestination) {
+			aSlice.mModel->texture_coordinates_for_mesh_into<glm::vec2>(aSlice.mMeshIndex, aDestination, aTexCoordSet);
+		});
 	}
 
 	std::vector<glm::vec2> get_2d_texture_coordinates_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
@@ -488,16 +507,9 @@ namespace avk
 
 	std::vector<glm::vec2> get_2d_texture_coordinates_flipped(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
 	{
-		std::vector<glm::vec2> texCoordsData;
-
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(texCoordsData, modelRef.texture_coordinates_for_mesh<glm::vec2>([](const glm::vec2& aValue){ return glm::vec2{aValue.x, 1.0f - aValue.y}; }, meshIndex, aTexCoordSet));
-			}
-		}
-
-		return texCoordsData;
+		return gather_vertex_data_for_meshes<glm::vec2>(aModelsAndSelectedMeshes, [&](const mesh_data_slice& aSlice, std::span<glm::vec2> aDestination) {
+			aSlice.mModel->texture_coordinates_for_mesh_into<glm::vec2>([](const glm::vec2& aValue){ return glm::vec2{aValue.x, 1.0f - aValue.y}; }, aSlice.mMeshIndex, aDestination, aTexCoordSet);
+		});
 	}
 
 	std::vector<glm::vec2> get_2d_texture_coordinates_flipped_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
@@ -513,31 +525,137 @@ namespace avk
 	}
 
 	std::vector<glm::vec3> get_3d_texture_coordinates(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
+	{
+		return gather_vertex_data_for_meshes<glm::vec3>(aModelsAndSelectedMeshes, [&](const mesh_data_slice& aSlice, std::span<glm::vec3> aDestination) {
+			aSlice.mModel->texture_coordinates_for_mesh_into<glm::vec3>(aSlice.mMeshIndex, aDestination, aTexCoordSet);
+		});
+	}
+
+	std::vector<glm::vec3> get_3d_texture_coordinates_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
 	{
 		std::vector<glm::vec3> texCoordsData;
 
-		for (auto& pair : aModelsAndSelectedMeshes) {
-			const auto& modelRef = std::get<const avk::model_t&>(pair);
-			for (auto meshIndex : std::get<std::vector<avk::mesh_index_t>>(pair)) {
-				insert_into(texCoordsData, modelRef.texture_coordinates_for_mesh<glm::vec3>(meshIndex, aTexCoordSet));
-			}
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			texCoordsData = get_3d_texture_coordinates(aModelsAndSelectedMeshes, aTexCoordSet);
 		}
+		aSerializer.archive(texCoordsData);
 
 		return texCoordsData;
 	}
 
-	std::vector<glm::vec3> get_3d_texture_coordinates_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
+	std::vector<octahedral_2x16> get_normals_octahedral(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
 	{
-		std::vector<glm::vec3> texCoordsData;
+		return gather_packed_vertex_data_for_meshes<octahedral_2x16, glm::vec3>(aModelsAndSelectedMeshes, [&](const mesh_data_slice& aSlice, std::span<glm::vec3> aDestination) {
+			aSlice.mModel->normals_for_mesh_into(aSlice.mMeshIndex, aDestination);
+		}, pack_octahedral_2x16);
+	}
 
+	std::vector<octahedral_2x16> get_normals_octahedral_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		std::vector<octahedral_2x16> normalsData;
 		if (aSerializer.mode() == avk::serializer::mode::serialize) {
-			texCoordsData = get_3d_texture_coordinates(aModelsAndSelectedMeshes, aTexCoordSet);
+			normalsData = get_normals_octahedral(aModelsAndSelectedMeshes);
+		}
+		aSerializer.archive(normalsData);
+
+		return normalsData;
+	}
+
+	std::vector<octahedral_2x16> get_tangents_octahedral(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		return gather_packed_vertex_data_for_meshes<octahedral_2x16, glm::vec3>(aModelsAndSelectedMeshes, [&](const mesh_data_slice& aSlice, std::span<glm::vec3> aDestination) {
+			aSlice.mModel->tangents_for_mesh_into(aSlice.mMeshIndex, aDestination);
+		}, pack_octahedral_2x16);
+	}
+
+	std::vector<octahedral_2x16> get_tangents_octahedral_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		std::vector<octahedral_2x16> tangentsData;
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			tangentsData = get_tangents_octahedral(aModelsAndSelectedMeshes);
+		}
+		aSerializer.archive(tangentsData);
+
+		return tangentsData;
+	}
+
+	std::vector<half_2x16> get_2d_texture_coordinates_half(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
+	{
+		return gather_packed_vertex_data_for_meshes<half_2x16, glm::vec2>(aModelsAndSelectedMeshes, [&](const mesh_data_slice& aSlice, std::span<glm::vec2> aDestination) {
+			aSlice.mModel->texture_coordinates_for_mesh_into<glm::vec2>(aSlice.mMeshIndex, aDestination, aTexCoordSet);
+		}, pack_half_2x16);
+	}
+
+	std::vector<half_2x16> get_2d_texture_coordinates_half_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
+	{
+		std::vector<half_2x16> texCoordsData;
+
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			texCoordsData = get_2d_texture_coordinates_half(aModelsAndSelectedMeshes, aTexCoordSet);
 		}
 		aSerializer.archive(texCoordsData);
 
 		return texCoordsData;
 	}
 
+	std::vector<half_2x16> get_2d_texture_coordinates_flipped_half(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
+	{
+		return gather_packed_vertex_data_for_meshes<half_2x16, glm::vec2>(aModelsAndSelectedMeshes, [&](const mesh_data_slice& aSlice, std::span<glm::vec2> aDestination) {
+			aSlice.mModel->texture_coordinates_for_mesh_into<glm::vec2>([](const glm::vec2& aValue) { return glm::vec2{ aValue.x, 1.0f - aValue.y }; }, aSlice.mMeshIndex, aDestination, aTexCoordSet);
+		}, pack_half_2x16);
+	}
+
+	std::vector<half_2x16> get_2d_texture_coordinates_flipped_half_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes, int aTexCoordSet)
+	{
+		std::vector<half_2x16> texCoordsData;
+
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			texCoordsData = get_2d_texture_coordinates_flipped_half(aModelsAndSelectedMeshes, aTexCoordSet);
+		}
+		aSerializer.archive(texCoordsData);
+
+		return texCoordsData;
+	}
+
+	std::tuple<std::vector<quantized_position_4x16>, position_dequantization> get_quantized_positions(const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		const auto positions = gather_vertex_data_for_meshes<glm::vec3>(aModelsAndSelectedMeshes, [&](const mesh_data_slice& aSlice, std::span<glm::vec3> aDestination) {
+			aSlice.mModel->positions_for_mesh_into(aSlice.mMeshIndex, aDestination);
+		});
+		if (positions.empty()) {
+			return std::make_tuple(std::vector<quantized_position_4x16>{}, position_dequantization{});
+		}
+
+		// The bounds are shared by all selected meshes, s.t. they can be drawn with one dequantization transform:
+		glm::vec3 boundsMin = positions.front();
+		glm::vec3 boundsMax = positions.front();
+		for (const auto& p : positions) {
+			boundsMin = glm::min(boundsMin, p);
+			boundsMax = glm::max(boundsMax, p);
+		}
+		const auto dequantization = position_dequantization_for_bounds(boundsMin, boundsMax);
+
+		std::vector<quantized_position_4x16> result(positions.size());
+		std::transform(std::begin(positions), std::end(positions), std::begin(result), [&dequantization](const glm::vec3& aPosition) {
+			return quantize_position_4x16(aPosition, dequantization);
+		});
+		return std::make_tuple(std::move(result), dequantization);
+	}
+
+	std::tuple<std::vector<quantized_position_4x16>, position_dequantization> get_quantized_positions_cached(avk::serializer& aSerializer, const std::vector<std::tuple<const avk::model_t&, std::vector<avk::mesh_index_t>>>& aModelsAndSelectedMeshes)
+	{
+		std::vector<quantized_position_4x16> positionsData;
+		position_dequantization dequantization;
+
+		if (aSerializer.mode() == avk::serializer::mode::serialize) {
+			std::tie(positionsData, dequantization) = get_quantized_positions(aModelsAndSelectedMeshes);
+		}
+		aSerializer.archive(positionsData);
+		aSerializer.archive(dequantization);
+
+		return std::make_tuple(std::move(positionsData), dequantization);
+	}
+
 	avk::sampler create_sampler_cached(avk::serializer& aSerializer, avk::filter_mode aFilterMode, std::array<avk::border_handling_mode, 3> aBorderHandlingModes, float aMipMapMaxLod, std::function<void(avk::sampler_t&)> aAlterConfigBeforeCreation)
 	{
 		aSerializer.archive(aFilterMode);
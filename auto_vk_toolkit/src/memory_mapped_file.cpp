@@ -0,0 +1,108 @@
+#include "memory_mapped_file.hpp"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace avk
+{
+	memory_mapped_file::memory_mapped_file(std::string_view aPath)
+	{
+		const std::string path{ aPath };
+#ifdef _WIN32
+		HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (INVALID_HANDLE_VALUE == file) {
+			throw avk::runtime_error(std::format("Unable to open file '{}' for memory mapping.", path));
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize)) {
+			CloseHandle(file);
+			throw avk::runtime_error(std::format("Unable to determine the size of file '{}'.", path));
+		}
+		mSize = static_cast<size_t>(fileSize.QuadPart);
+		if (0 == mSize) {
+			CloseHandle(file);
+			return;
+		}
+
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		// The view keeps the mapping alive => handles can be closed right away:
+		CloseHandle(file);
+		if (nullptr == mapping) {
+			mSize = 0;
+			throw avk::runtime_error(std::format("Unable to create a file mapping for '{}'.", path));
+		}
+		mData = static_cast<const std::byte*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+		CloseHandle(mapping);
+		if (nullptr == mData) {
+			mSize = 0;
+			throw avk::runtime_error(std::format("Unable to map a view of file '{}'.", path));
+		}
+#else
+		const int fd = open(path.c_str(), O_RDONLY);
+		if (-1 == fd) {
+			throw avk::runtime_error(std::format("Unable to open file '{}' for memory mapping.", path));
+		}
+
+		struct stat fileStat;
+		if (-1 == fstat(fd, &fileStat)) {
+			close(fd);
+			throw avk::runtime_error(std::format("Unable to determine the size of file '{}'.", path));
+		}
+		mSize = static_cast<size_t>(fileStat.st_size);
+		if (0 == mSize) {
+			close(fd);
+			return;
+		}
+
+		void* ptr = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+		// The mapping keeps a reference to the file => descriptor can be closed right away:
+		close(fd);
+		if (MAP_FAILED == ptr) {
+			mSize = 0;
+			throw avk::runtime_error(std::format("Unable to memory map file '{}'.", path));
+		}
+		// Data is typically consumed front to back:
+		madvise(ptr, mSize, MADV_SEQUENTIAL);
+		mData = static_cast<const std::byte*>(ptr);
+#endif
+	}
+
+	memory_mapped_file::memory_mapped_file(memory_mapped_file&& aOther) noexcept
+		: mData{ std::exchange(aOther.mData, nullptr) }
+		, mSize{ std::exchange(aOther.mSize, 0) }
+	{ }
+
+	memory_mapped_file& memory_mapped_file::operator=(memory_mapped_file&& aOther) noexcept
+	{
+		if (this != &aOther) {
+			unmap();
+			mData = std::exchange(aOther.mData, nullptr);
+			mSize = std::exchange(aOther.mSize, 0);
+		}
+		return *this;
+	}
+
+	memory_mapped_file::~memory_mapped_file()
+	{
+		unmap();
+	}
+
+	void memory_mapped_file::unmap() noexcept
+	{
+		if (nullptr == mData) {
+			return;
+		}
+#ifdef _WIN32
+		UnmapViewOfFile(mData);
+#else
+		munmap(const_cast<std::byte*>(mData), mSize);
+#endif
+		mData = nullptr;
+		mSize = 0;
+	}
+}
@@ -11,6 +11,12 @@ namespace avk
 		return divide_into_meshlets(aModelsAndMeshletIndices, basic_meshlets_divider, aCombineSubmeshes, aMaxVertices, aMaxIndices);
 	}
 
+	std::vector<meshlet> divide_into_meshlets_parallel(std::vector<std::tuple<avk::model, std::vector<mesh_index_t>>>& aModelsAndMeshletIndices,
+		const bool aCombineSubmeshes, const uint32_t aMaxVertices, const uint32_t aMaxIndices)
+	{
+		return divide_into_meshlets_parallel(aModelsAndMeshletIndices, basic_meshlets_divider, aCombineSubmeshes, aMaxVertices, aMaxIndices);
+	}
+
 	std::vector<meshlet> basic_meshlets_divider(const std::vector<uint32_t>& aIndices,
 		const model_t& aModel,
 		std::optional<mesh_index_t> aMeshIndex,
@@ -50,5 +56,491 @@ namespace avk
 
 		return result;
 	}
-}
 
+	/** A kd-tree over triangle centroids which supports removing triangles, used by spatial_meshlets_divider
+	 *	to continue with the closest remaining triangle whenever a meshlet can not grow along its boundary.
+	 */
+	class triangle_kd_tree
+	{
+	public:
+		explicit triangle_kd_tree(const std::vector<glm::vec3>& aCentroids)
+			: mCentroids{ aCentroids }
+			, mItems(aCentroids.size())
+			, mLeafOfItem(aCentroids.size())
+			, mRemoved(aCentroids.size(), false)
+		{
+			std::iota(std::begin(mItems), std::end(mItems), 0u);
+			if (!mItems.empty()) {
+				build(0u, static_cast<uint32_t>(mItems.size()), sNoNode);
+			}
+		}
+
+		/** Excludes the given triangle from subsequent nearest() queries. */
+		void remove(uint32_t aTriangle)
+		{
+			for (uint32_t n = mLeafOfItem[aTriangle]; n != sNoNode; n = mNodes[n].mParent) {
+				assert(mNodes[n].mLive > 0);
+				--mNodes[n].mLive;
+			}
+			mRemoved[aTriangle] = true;
+		}
+
+		/** Returns the remaining triangle whose centroid is closest to aPosition, or nothing if no triangles remain. */
+		std::optional<uint32_t> nearest(const glm::vec3& aPosition) const
+		{
+			uint32_t best = sNoNode;
+			float bestDistanceSq = std::numeric_limits<float>::max();
+			if (!mNodes.empty()) {
+				nearest(0u, aPosition, best, bestDistanceSq);
+			}
+			return sNoNode == best ? std::optional<uint32_t>{} : std::optional<uint32_t>{ best };
+		}
+
+	private:
+		static constexpr uint32_t sNoNode = std::numeric_limits<uint32_t>::max();
+		static constexpr uint32_t sLeafSize = 8u;
+
+		struct node
+		{
+			uint32_t mBegin, mEnd;		// Range in mItems
+			uint32_t mParent;
+			uint32_t mLeft = sNoNode, mRight = sNoNode;
+			uint32_t mLive;				// Number of not yet removed items in this subtree
+			glm::length_t mAxis = 0;
+			float mSplit = 0.f;
+		};
+
+		uint32_t build(uint32_t aBegin, uint32_t aEnd, uint32_t aParent)
+		{
+			const auto index = static_cast<uint32_t>(mNodes.size());
+			mNodes.push_back(node{ aBegin, aEnd, aParent, sNoNode, sNoNode, aEnd - aBegin });
+			if (aEnd - aBegin <= sLeafSize) {
+				for (uint32_t i = aBegin; i < aEnd; ++i) {
+					mLeafOfItem[mItems[i]] = index;
+				}
+				return index;
+			}
+
+			// Split at the median along the axis of the largest extent:
+			glm::vec3 boundsMin{ std::numeric_limits<float>::max() };
+			glm::vec3 boundsMax{ std::numeric_limits<float>::lowest() };
+			for (uint32_t i = aBegin; i < aEnd; ++i) {
+				boundsMin = glm::min(boundsMin, mCentroids[mItems[i]]);
+				boundsMax = glm::max(boundsMax, mCentroids[mItems[i]]);
+			}
+			const auto extent = boundsMax - boundsMin;
+			const glm::length_t axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : (extent.y >= extent.z ? 1 : 2);
+			const uint32_t mid = aBegin + (aEnd - aBegin) / 2u;
+			std::nth_element(std::begin(mItems) + aBegin, std::begin(mItems) + mid, std::begin(mItems) + aEnd, [this, axis](uint32_t a, uint32_t b) {
+				return mCentroids[a][axis] < mCentroids[b][axis];
+			});
+
+			const auto left = build(aBegin, mid, index);
+			const auto right = build(mid, aEnd, index);
+			auto& n = mNodes[index];
+			n.mAxis = axis;
+			n.mSplit = mCentroids[mItems[mid]][axis];
+			n.mLeft = left;
+			n.mRight = right;
+			return index;
+		}
+
+		void nearest(uint32_t aNode, const glm::vec3& aPosition, uint32_t& aBest, float& aBestDistanceSq) const
+		{
+			const auto& n = mNodes[aNode];
+			if (0 == n.mLive) {
+				return;
+			}
+			if (sNoNode == n.mLeft) {
+				for (uint32_t i = n.mBegin; i < n.mEnd; ++i) {
+					const auto item = mItems[i];
+					if (mRemoved[item]) {
+						continue;
+					}
+					const auto d = mCentroids[item] - aPosition;
+					const float distanceSq = glm::dot(d, d);
+					if (distanceSq < aBestDistanceSq) {
+						aBestDistanceSq = distanceSq;
+						aBest = item;
+					}
+				}
+				return;
+			}
+
+			const float delta = aPosition[n.mAxis] - n.mSplit;
+			nearest(delta < 0.f ? n.mLeft : n.mRight, aPosition, aBest, aBestDistanceSq);
+			// The other side can only contain closer items if the splitting plane is closer than the best item so far:
+			if (delta * delta < aBestDistanceSq) {
+				nearest(delta < 0.f ? n.mRight : n.mLeft, aPosition, aBest, aBestDistanceSq);
+			}
+		}
+
+		const std::vector<glm::vec3>& mCentroids;
+		std::vector<uint32_t> mItems;
+		std::vector<uint32_t> mLeafOfItem;
+		std::vector<bool> mRemoved;
+		std::vector<node> mNodes;
+	};
+
+	/** Turns the given triangles into a meshlet. Triangles are reordered s.t. consecutive triangles share vertices,
+	 *	and vertices are numbered in the order of their first use, which improves vertex reuse within the meshlet.
+	 *	@param	aLocalIndex		Scratch buffer with one entry per vertex of the mesh, all of which must be -1. They are -1 again when this function returns.
+	 */
+	static meshlet make_optimized_meshlet(const std::vector<uint32_t>& aIndices, const std::vector<uint32_t>& aTriangles, std::vector<int32_t>& aLocalIndex, std::optional<mesh_index_t> aMeshIndex)
+	{
+		const auto numTriangles = aTriangles.size();
+		auto sharedVertices = [&aIndices](uint32_t aTriA, uint32_t aTriB) {
+			int shared = 0;
+			for (uint32_t a = 0; a < 3u; ++a) {
+				for (uint32_t b = 0; b < 3u; ++b) {
+					shared += aIndices[3u * aTriA + a] == aIndices[3u * aTriB + b] ? 1 : 0;
+				}
+			}
+			return shared;
+		};
+
+		// Temporarily number the meshlet's vertices, to find the triangles which are adjacent to each of them:
+		std::vector<uint32_t> vertices;
+		for (const auto tri : aTriangles) {
+			for (uint32_t k = 0; k < 3u; ++k) {
+				const auto vertex = aIndices[3u * tri + k];
+				if (aLocalIndex[vertex] < 0) {
+					aLocalIndex[vertex] = static_cast<int32_t>(vertices.size());
+					vertices.push_back(vertex);
+				}
+			}
+		}
+		std::vector<std::vector<uint32_t>> trianglesOfVertex(vertices.size());
+		for (uint32_t j = 0; j < static_cast<uint32_t>(numTriangles); ++j) {
+			for (uint32_t k = 0; k < 3u; ++k) {
+				trianglesOfVertex[aLocalIndex[aIndices[3u * aTriangles[j] + k]]].push_back(j);
+			}
+		}
+
+		// Always continue with the unused triangle which shares the most vertices with the previous one:
+		std::vector<uint32_t> ordered;
+		ordered.reserve(numTriangles);
+		std::vector<bool> used(numTriangles, false);
+		size_t firstUnused = 0;
+		size_t current = 0;
+		while (ordered.size() < numTriangles) {
+			used[current] = true;
+			ordered.push_back(aTriangles[current]);
+
+			size_t best = numTriangles;
+			int bestShared = 0;
+			for (uint32_t k = 0; k < 3u; ++k) {
+				for (const auto j : trianglesOfVertex[aLocalIndex[aIndices[3u * aTriangles[current] + k]]]) {
+					if (used[j]) {
+						continue;
+					}
+					const int shared = sharedVertices(aTriangles[current], aTriangles[j]);
+					if (shared > bestShared) {
+						bestShared = shared;
+						best = j;
+					}
+				}
+			}
+			if (numTriangles == best) {
+				while (firstUnused < numTriangles && used[firstUnused]) {
+					++firstUnused;
+				}
+				best = firstUnused;
+			}
+			current = best;
+		}
+		for (const auto vertex : vertices) {
+			aLocalIndex[vertex] = -1;
+		}
+
+		meshlet ml;
+		ml.mMeshIndex = aMeshIndex;
+		ml.mIndices.reserve(3u * numTriangles);
+		for (const auto tri : ordered) {
+			// Keep the vertex order, s.t. the winding order of the triangle is maintained:
+			for (uint32_t k = 0; k < 3u; ++k) {
+				const auto vertex = aIndices[3u * tri + k];
+				if (aLocalIndex[vertex] < 0) {
+					aLocalIndex[vertex] = static_cast<int32_t>(ml.mVertices.size());
+					ml.mVertices.push_back(vertex);
+				}
+				ml.mIndices.push_back(static_cast<uint8_t>(aLocalIndex[vertex]));
+			}
+		}
+		for (const auto vertex : ml.mVertices) {
+			aLocalIndex[vertex] = -1;
+		}
+		ml.mVertexCount = static_cast<uint32_t>(ml.mVertices.size());
+		ml.mIndexCount = static_cast<uint32_t>(ml.mIndices.size());
+		return ml;
+	}
+
+	std::vector<meshlet> spatial_meshlets_divider(const std::vector<glm::vec3>& aVertices,
+		const std::vector<uint32_t>& aIndices,
+		const model_t& aModel,
+		std::optional<mesh_index_t> aMeshIndex,
+		uint32_t aMaxVertices, uint32_t aMaxIndices)
+	{
+		// How much the normal cone is weighted against the bounding sphere when choosing the next triangle:
+		constexpr float coneWeight = 0.25f;
+
+		// Vertex indices within a meshlet are stored as uint8_t:
+		const uint32_t maxVertices = std::min(aMaxVertices, 256u);
+		const uint32_t maxTriangles = aMaxIndices / 3u;
+		if (maxVertices < 3u || maxTriangles < 1u) {
+			throw avk::logic_error(std::format("A meshlet must be able to hold at least one triangle, but aMaxVertices is {} and aMaxIndices is {}.", aMaxVertices, aMaxIndices));
+		}
+		assert(aIndices.size() % 3 == 0);
+
+		const auto numTriangles = static_cast<uint32_t>(aIndices.size() / 3);
+		const auto numVertices = aVertices.size();
+
+		std::vector<glm::vec3> centroids(numTriangles);
+		std::vector<glm::vec3> triangleNormals(numTriangles);
+		float totalArea = 0.f;
+		for (uint32_t t = 0; t < numTriangles; ++t) {
+			const auto& p0 = aVertices[aIndices[3u * t + 0u]];
+			const auto& p1 = aVertices[aIndices[3u * t + 1u]];
+			const auto& p2 = aVertices[aIndices[3u * t + 2u]];
+			centroids[t] = (p0 + p1 + p2) / 3.f;
+			const auto n = glm::cross(p1 - p0, p2 - p0);
+			const float len = glm::length(n);
+			triangleNormals[t] = len > 0.f ? n / len : glm::vec3{ 0.f };
+			totalArea += 0.5f * len;
+		}
+
+		// Triangles adjacent to each vertex, and how many of them have not been assigned to a meshlet yet:
+		std::vector<uint32_t> adjacencyOffsets(numVertices + 1, 0u);
+		for (const auto vertex : aIndices) {
+			++adjacencyOffsets[vertex + 1];
+		}
+		std::vector<uint32_t> liveTriangles(numVertices);
+		for (size_t v = 0; v < numVertices; ++v) {
+			liveTriangles[v] = adjacencyOffsets[v + 1];
+			adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+		}
+		std::vector<uint32_t> adjacency(aIndices.size());
+		{
+			auto cursor = adjacencyOffsets;
+			for (uint32_t i = 0; i < static_cast<uint32_t>(aIndices.size()); ++i) {
+				adjacency[cursor[aIndices[i]]++] = i / 3u;
+			}
+		}
+
+		// Radius that a full meshlet of average sized triangles is expected to have, used to normalize distances:
+		const float averageTriangleSize = numTriangles > 0u ? std::sqrt(totalArea / static_cast<float>(numTriangles)) : 0.f;
+		const float expectedRadius = std::max(averageTriangleSize * std::sqrt(static_cast<float>(maxTriangles)) * 0.5f, std::numeric_limits<float>::min());
+
+		triangle_kd_tree kdTree(centroids);
+		std::vector<bool> emitted(numTriangles, false);
+		std::vector<int32_t> localIndex(numVertices, -1);
+
+		std::vector<meshlet> result;
+		std::vector<uint32_t> currentVertices;
+		std::vector<uint32_t> currentTriangles;
+		glm::vec3 centroidSum{ 0.f };
+		glm::vec3 normalSum{ 0.f };
+
+		auto extraVerticesFor = [&](uint32_t aTriangle) {
+			uint32_t extra = 0u;
+			for (uint32_t k = 0; k < 3u; ++k) {
+				extra += localIndex[aIndices[3u * aTriangle + k]] < 0 ? 1u : 0u;
+			}
+			return extra;
+		};
+
+		auto addTriangle = [&](uint32_t aTriangle) {
+			for (uint32_t k = 0; k < 3u; ++k) {
+				const auto vertex = aIndices[3u * aTriangle + k];
+				if (localIndex[vertex] < 0) {
+					localIndex[vertex] = static_cast<int32_t>(currentVertices.size());
+					currentVertices.push_back(vertex);
+				}
+				--liveTriangles[vertex];
+			}
+			currentTriangles.push_back(aTriangle);
+			emitted[aTriangle] = true;
+			kdTree.remove(aTriangle);
+			centroidSum += centroids[aTriangle];
+			normalSum += triangleNormals[aTriangle];
+		};
+
+		auto finishMeshlet = [&]() {
+			if (currentTriangles.empty()) {
+				return;
+			}
+			for (const auto vertex : currentVertices) {
+				localIndex[vertex] = -1;
+			}
+			result.push_back(make_optimized_meshlet(aIndices, currentTriangles, localIndex, aMeshIndex));
+			currentVertices.clear();
+			currentTriangles.clear();
+			centroidSum = glm::vec3{ 0.f };
+			normalSum = glm::vec3{ 0.f };
+		};
+
+		// Among the remaining triangles adjacent to the current meshlet, find the one which requires the fewest new vertices,
+		// and among those, the one which keeps the bounding sphere and the normal cone of the meshlet tightest:
+		auto findBestAdjacentTriangle = [&]() -> std::optional<uint32_t> {
+			const glm::vec3 center = centroidSum / static_cast<float>(currentTriangles.size());
+			const float normalSumLength = glm::length(normalSum);
+			const glm::vec3 axis = normalSumLength > 0.f ? normalSum / normalSumLength : glm::vec3{ 0.f };
+
+			std::optional<uint32_t> best;
+			uint32_t bestExtra = std::numeric_limits<uint32_t>::max();
+			float bestCost = std::numeric_limits<float>::max();
+			for (const auto vertex : currentVertices) {
+				if (0u == liveTriangles[vertex]) {
+					continue;
+				}
+				for (uint32_t a = adjacencyOffsets[vertex]; a < adjacencyOffsets[vertex + 1]; ++a) {
+					const auto tri = adjacency[a];
+					if (emitted[tri]) {
+						continue;
+					}
+					const auto extra = extraVerticesFor(tri);
+					if (extra > bestExtra) {
+						continue;
+					}
+					const float distance = glm::length(centroids[tri] - center);
+					const float spread = std::max(1.f - glm::dot(triangleNormals[tri], axis) * coneWeight, 1e-3f);
+					const float cost = (1.f + distance / expectedRadius * (1.f - coneWeight)) * spread;
+					if (extra < bestExtra || cost < bestCost) {
+						best = tri;
+						bestExtra = extra;
+						bestCost = cost;
+					}
+				}
+			}
+			return best;
+		};
+
+		std::optional<uint32_t> next = kdTree.nearest(numTriangles > 0u ? centroids[0] : glm::vec3{ 0.f });
+		while (next.has_value()) {
+			const bool fits = currentTriangles.size() + 1u <= maxTriangles && currentVertices.size() + extraVerticesFor(*next) <= maxVertices;
+			if (!fits) {
+				// The meshlet is full => continue with the candidate as the seed of the next one:
+				finishMeshlet();
+			}
+			addTriangle(*next);
+
+			next = findBestAdjacentTriangle();
+			if (!next.has_value()) {
+				// Nothing left along the boundary of the meshlet (e.g., at the end of a disconnected part of the mesh):
+				next = kdTree.nearest(centroidSum / static_cast<float>(currentTriangles.size()));
+			}
+		}
+		finishMeshlet();
+
+		return result;
+	}
+
+	meshlet_bounds compute_meshlet_bounds(const meshlet& aMeshlet, std::span<const glm::vec3> aVertexPositions)
+	{
+		meshlet_bounds bounds{};
+		if (0u == aMeshlet.mVertexCount) {
+			return bounds;
+		}
+		auto position = [&](uint32_t aLocalVertex) -> const glm::vec3& {
+			const auto vertex = aMeshlet.mVertices[aLocalVertex];
+			if (vertex >= aVertexPositions.size()) {
+				throw avk::logic_error(std::format("Meshlet refers to vertex {}, but only {} vertex positions have been passed.", vertex, aVertexPositions.size()));
+			}
+			return aVertexPositions[vertex];
+		};
+
+		// Axis aligned bounding box:
+		glm::vec3 aabbMin = position(0u);
+		glm::vec3 aabbMax = position(0u);
+		for (uint32_t i = 1; i < aMeshlet.mVertexCount; ++i) {
+			aabbMin = glm::min(aabbMin, position(i));
+			aabbMax = glm::max(aabbMax, position(i));
+		}
+		bounds.mAabbMin = glm::vec4{ aabbMin, 0.f };
+		bounds.mAabbMax = glm::vec4{ aabbMax, 0.f };
+
+		// Bounding sphere after Ritter: Start with the two points which are (approximately) farthest apart, and grow the sphere as needed:
+		auto farthestFrom = [&](const glm::vec3& aPoint) {
+			uint32_t farthest = 0u;
+			float farthestDistanceSq = -1.f;
+			for (uint32_t i = 0; i < aMeshlet.mVertexCount; ++i) {
+				const auto d = position(i) - aPoint;
+				if (glm::dot(d, d) > farthestDistanceSq) {
+					farthestDistanceSq = glm::dot(d, d);
+					farthest = i;
+				}
+			}
+			return farthest;
+		};
+		const auto& p1 = position(farthestFrom(position(0u)));
+		const auto& p2 = position(farthestFrom(p1));
+		glm::vec3 center = (p1 + p2) * 0.5f;
+		float radius = glm::length(p2 - p1) * 0.5f;
+		for (uint32_t i = 0; i < aMeshlet.mVertexCount; ++i) {
+			const float distance = glm::length(position(i) - center);
+			if (distance > radius) {
+				const float newRadius = (radius + distance) * 0.5f;
+				center += (position(i) - center) * ((newRadius - radius) / distance);
+				radius = newRadius;
+			}
+		}
+		// Ritter's sphere is not always tighter than the sphere around the bounding box:
+		const glm::vec3 aabbCenter = (aabbMin + aabbMax) * 0.5f;
+		float aabbCenterRadius = 0.f;
+		for (uint32_t i = 0; i < aMeshlet.mVertexCount; ++i) {
+			aabbCenterRadius = std::max(aabbCenterRadius, glm::length(position(i) - aabbCenter));
+		}
+		if (aabbCenterRadius < radius) {
+			center = aabbCenter;
+			radius = aabbCenterRadius;
+		}
+		bounds.mBoundingSphere = glm::vec4{ center, radius };
+
+		// Normal cone, following the approach of meshoptimizer: The axis is the average triangle normal. The cutoff is derived
+		// from the normal which deviates the most from the axis, and the apex is placed s.t. it is behind all triangles' planes.
+		const uint32_t numTriangles = aMeshlet.mIndexCount / 3u;
+		std::vector<glm::vec3> triangleNormals;
+		triangleNormals.reserve(numTriangles);
+		glm::vec3 normalSum{ 0.f };
+		for (uint32_t t = 0; t < numTriangles; ++t) {
+			const auto& a = position(aMeshlet.mIndices[3u * t + 0u]);
+			const auto& b = position(aMeshlet.mIndices[3u * t + 1u]);
+			const auto& c = position(aMeshlet.mIndices[3u * t + 2u]);
+			const auto n = glm::cross(b - a, c - a);
+			const float len = glm::length(n);
+			if (len > 0.f) {
+				triangleNormals.push_back(n / len);
+				normalSum += n / len;
+			}
+		}
+		const float normalSumLength = glm::length(normalSum);
+		const glm::vec3 axis = normalSumLength > 0.f ? normalSum / normalSumLength : glm::vec3{ 0.f, 0.f, 1.f };
+		float minDot = 1.f;
+		for (const auto& n : triangleNormals) {
+			minDot = std::min(minDot, glm::dot(n, axis));
+		}
+
+		bounds.mConeApex = glm::vec4{ center, 0.f };
+		// If the normals deviate by more than ~84 degrees from the axis, cone culling is not reasonably possible:
+		if (triangleNormals.empty() || minDot <= 0.1f) {
+			bounds.mConeAxisAndCutoff = glm::vec4{ axis, 1.f };
+			return bounds;
+		}
+
+		float maxDistanceAlongAxis = 0.f;
+		for (uint32_t t = 0, ni = 0; t < numTriangles; ++t) {
+			const auto& a = position(aMeshlet.mIndices[3u * t + 0u]);
+			const auto& b = position(aMeshlet.mIndices[3u * t + 1u]);
+			const auto& c = position(aMeshlet.mIndices[3u * t + 2u]);
+			if (glm::length(glm::cross(b - a, c - a)) <= 0.f) {
+				continue;
+			}
+			// Distance along the axis from the center to the triangle's plane:
+			const auto& n = triangleNormals[ni++];
+			maxDistanceAlongAxis = std::max(maxDistanceAlongAxis, glm::dot(center - a, n) / glm::dot(axis, n));
+		}
+		bounds.mConeApex = glm::vec4{ center - axis * maxDistanceAlongAxis, 0.f };
+		bounds.mConeAxisAndCutoff = glm::vec4{ axis, std::sqrt(1.f - minDot * minDot) };
+		return bounds;
+	}
+}
@@ -0,0 +1,663 @@
+#include "meshlet_lod_helpers.hpp"
+
+namespace avk
+{
+	// The number of clusters which are simplified together:
+	static constexpr size_t sClustersPerGroup = 8;
+	// A group is only replaced by its simplified version if the triangle count has been reduced at least to this fraction:
+	static constexpr float sMinSimplificationRatio = 0.85f;
+
+	/** Symmetric 4x4 matrix which accumulates the squared distances to a set of planes. */
+	struct error_quadric
+	{
+		double a00 = 0, a01 = 0, a02 = 0, a03 = 0, a11 = 0, a12 = 0, a13 = 0, a22 = 0, a23 = 0, a33 = 0;
+
+		static error_quadric from_plane(const glm::dvec3& aNormal, double aDistance)
+		{
+			const auto& n = aNormal;
+			const double d = aDistance;
+			return { n.x * n.x, n.x * n.y, n.x * n.z, n.x * d, n.y * n.y, n.y * n.z, n.y * d, n.z * n.z, n.z * d, d * d };
+		}
+
+		error_quadric& operator+=(const error_quadric& aOther)
+		{
+			a00 += aOther.a00; a01 += aOther.a01; a02 += aOther.a02; a03 += aOther.a03;
+			a11 += aOther.a11; a12 += aOther.a12; a13 += aOther.a13;
+			a22 += aOther.a22; a23 += aOther.a23;
+			a33 += aOther.a33;
+			return *this;
+		}
+
+		/** Sum of the squared distances of the given point to all planes */
+		double evaluate(const glm::dvec3& p) const
+		{
+			return a00 * p.x * p.x + 2.0 * a01 * p.x * p.y + 2.0 * a02 * p.x * p.z + 2.0 * a03 * p.x
+				+ a11 * p.y * p.y + 2.0 * a12 * p.y * p.z + 2.0 * a13 * p.y
+				+ a22 * p.z * p.z + 2.0 * a23 * p.z
+				+ a33;
+		}
+	};
+
+	/** Assigns to each vertex the smallest index of all vertices at the same position. */
+	static std::vector<uint32_t> make_position_remap(const std::vector<glm::vec3>& aVertices)
+	{
+		const auto numVertices = static_cast<uint32_t>(aVertices.size());
+		std::vector<uint32_t> order(numVertices);
+		std::iota(std::begin(order), std::end(order), 0u);
+		auto lexicographicLess = [&](uint32_t a, uint32_t b) {
+			const auto& pa = aVertices[a];
+			const auto& pb = aVertices[b];
+			if (pa.x != pb.x) return pa.x < pb.x;
+			if (pa.y != pb.y) return pa.y < pb.y;
+			if (pa.z != pb.z) return pa.z < pb.z;
+			return a < b;
+		};
+		std::sort(std::begin(order), std::end(order), lexicographicLess);
+
+		std::vector<uint32_t> remap(numVertices);
+		for (uint32_t i = 0; i < numVertices; ++i) {
+			const bool samePositionAsPrevious = i > 0u && aVertices[order[i]] == aVertices[order[i - 1]];
+			remap[order[i]] = samePositionAsPrevious ? remap[order[i - 1]] : order[i];
+		}
+		return remap;
+	}
+
+	/** Returns a sphere which encloses both given spheres (center in xyz, radius in w). */
+	static glm::vec4 merge_spheres(const glm::vec4& aFirst, const glm::vec4& aSecond)
+	{
+		const glm::vec3 offset = glm::vec3{ aSecond } - glm::vec3{ aFirst };
+		const float distance = glm::length(offset);
+		if (distance + aSecond.w <= aFirst.w) {
+			return aFirst;
+		}
+		if (distance + aFirst.w <= aSecond.w) {
+			return aSecond;
+		}
+		const float radius = (distance + aFirst.w + aSecond.w) * 0.5f;
+		const glm::vec3 center = glm::vec3{ aFirst } + offset * ((radius - aFirst.w) / distance);
+		return { center, radius };
+	}
+
+	/** Appends the triangles of the given meshlet as indices into the original vertices. */
+	static void append_triangles(const meshlet& aMeshlet, std::vector<uint32_t>& aIndices)
+	{
+		for (uint32_t i = 0; i < aMeshlet.mIndexCount; ++i) {
+			aIndices.push_back(aMeshlet.mVertices[aMeshlet.mIndices[i]]);
+		}
+	}
+
+	/** Simplifies the given triangles via half-edge collapses driven by error quadrics, until at most aTargetTriangles
+	 *	remain or no further collapses are possible. Collapses only ever move vertices onto other existing vertices.
+	 *	@param	aIndices			The triangles to simplify, which are modified in place.
+	 *	@param	aVertices			All vertex positions.
+	 *	@param	aLocked				For every vertex, whether it must not be collapsed.
+	 *	@param	aTargetTriangles	The number of triangles to aim for.
+	 *	@return	The maximum error of all performed collapses, in object space units.
+	 */
+	static float simplify_triangles(std::vector<uint32_t>& aIndices, const std::vector<glm::vec3>& aVertices, const std::vector<bool>& aLocked, size_t aTargetTriangles)
+	{
+		// Local numbering of the vertices:
+		std::vector<uint32_t> globalOf(aIndices);
+		std::sort(std::begin(globalOf), std::end(globalOf));
+		globalOf.erase(std::unique(std::begin(globalOf), std::end(globalOf)), std::end(globalOf));
+		const auto numVertices = static_cast<uint32_t>(globalOf.size());
+		const auto numTriangles = static_cast<uint32_t>(aIndices.size() / 3);
+		std::vector<glm::uvec3> triangles(numTriangles);
+		for (uint32_t t = 0; t < numTriangles; ++t) {
+			for (glm::length_t k = 0; k < 3; ++k) {
+				triangles[t][k] = static_cast<uint32_t>(std::lower_bound(std::begin(globalOf), std::end(globalOf), aIndices[3u * t + k]) - std::begin(globalOf));
+			}
+		}
+
+		std::vector<glm::dvec3> positions(numVertices);
+		std::vector<bool> locked(numVertices);
+		for (uint32_t v = 0; v < numVertices; ++v) {
+			positions[v] = glm::dvec3{ aVertices[globalOf[v]] };
+			locked[v] = aLocked[globalOf[v]];
+		}
+
+		std::vector<std::vector<uint32_t>> trianglesOfVertex(numVertices);
+		std::vector<error_quadric> quadrics(numVertices);
+		for (uint32_t t = 0; t < numTriangles; ++t) {
+			const auto& tri = triangles[t];
+			const auto n = glm::cross(positions[tri[1]] - positions[tri[0]], positions[tri[2]] - positions[tri[0]]);
+			const double len = glm::length(n);
+			const auto plane = len > 0.0
+				? error_quadric::from_plane(n / len, -glm::dot(n / len, positions[tri[0]]))
+				: error_quadric{};
+			for (glm::length_t k = 0; k < 3; ++k) {
+				trianglesOfVertex[tri[k]].push_back(t);
+				quadrics[tri[k]] += plane;
+			}
+		}
+
+		std::vector<bool> triangleAlive(numTriangles, true);
+		size_t liveTriangles = numTriangles;
+		double maxSquaredError = 0.0;
+
+		auto neighboursOf = [&](uint32_t aVertex) {
+			std::vector<uint32_t> neighbours;
+			for (const auto t : trianglesOfVertex[aVertex]) {
+				if (!triangleAlive[t]) {
+					continue;
+				}
+				for (glm::length_t k = 0; k < 3; ++k) {
+					if (triangles[t][k] != aVertex) {
+						neighbours.push_back(triangles[t][k]);
+					}
+				}
+			}
+			std::sort(std::begin(neighbours), std::end(neighbours));
+			neighbours.erase(std::unique(std::begin(neighbours), std::end(neighbours)), std::end(neighbours));
+			return neighbours;
+		};
+
+		// Whether collapsing aFrom onto aTo keeps the mesh manifold and does not flip any triangle:
+		auto isValidCollapse = [&](uint32_t aFrom, uint32_t aTo) {
+			uint32_t sharedTriangles = 0u;
+			for (const auto t : trianglesOfVertex[aFrom]) {
+				if (!triangleAlive[t]) {
+					continue;
+				}
+				const auto& tri = triangles[t];
+				if (tri[0] == aTo || tri[1] == aTo || tri[2] == aTo) {
+					++sharedTriangles;
+					continue;
+				}
+				glm::dvec3 p[3];
+				for (glm::length_t k = 0; k < 3; ++k) {
+					p[k] = positions[tri[k]];
+				}
+				const auto before = glm::cross(p[1] - p[0], p[2] - p[0]);
+				for (glm::length_t k = 0; k < 3; ++k) {
+					if (tri[k] == aFrom) {
+						p[k] = positions[aTo];
+					}
+				}
+				const auto after = glm::cross(p[1] - p[0], p[2] - p[0]);
+				if (glm::dot(before, after) <= 0.0) {
+					return false;
+				}
+			}
+			// Link condition: The only vertices adjacent to both must be the ones of the triangles on the collapsed edge:
+			const auto fromNeighbours = neighboursOf(aFrom);
+			const auto toNeighbours = neighboursOf(aTo);
+			std::vector<uint32_t> common;
+			std::set_intersection(std::begin(fromNeighbours), std::end(fromNeighbours), std::begin(toNeighbours), std::end(toNeighbours), std::back_inserter(common));
+			if (common.size() > sharedTriangles) {
+				return false;
+			}
+			// New edges between two locked vertices might already exist outside of aIndices, which would make them non-manifold:
+			if (locked[aTo]) {
+				for (const auto neighbour : fromNeighbours) {
+					if (neighbour != aTo && locked[neighbour] && !std::binary_search(std::begin(toNeighbours), std::end(toNeighbours), neighbour)) {
+						return false;
+					}
+				}
+			}
+			return true;
+		};
+
+		struct collapse
+		{
+			double mCost;
+			uint32_t mFrom;
+			uint32_t mTo;
+		};
+		std::vector<collapse> candidates;
+		std::vector<bool> touched(numVertices);
+		std::vector<bool> removed(numVertices, false);
+
+		// Collapse in passes: each pass performs the cheapest collapses first, and touches every vertex at most once:
+		while (liveTriangles > aTargetTriangles) {
+			candidates.clear();
+			for (uint32_t t = 0; t < numTriangles; ++t) {
+				if (!triangleAlive[t]) {
+					continue;
+				}
+				for (glm::length_t k = 0; k < 3; ++k) {
+					const auto a = triangles[t][k];
+					const auto b = triangles[t][(k + 1) % 3];
+					error_quadric q = quadrics[a];
+					q += quadrics[b];
+					if (!locked[a]) {
+						candidates.push_back({ q.evaluate(positions[b]), a, b });
+					}
+					if (!locked[b]) {
+						candidates.push_back({ q.evaluate(positions[a]), b, a });
+					}
+				}
+			}
+			std::sort(std::begin(candidates), std::end(candidates), [](const collapse& a, const collapse& b) {
+				return a.mCost < b.mCost || (a.mCost == b.mCost && (a.mFrom < b.mFrom || (a.mFrom == b.mFrom && a.mTo < b.mTo)));
+			});
+
+			std::fill(std::begin(touched), std::end(touched), false);
+			size_t numCollapses = 0;
+			for (const auto& c : candidates) {
+				if (liveTriangles <= aTargetTriangles) {
+					break;
+				}
+				if (touched[c.mFrom] || touched[c.mTo] || removed[c.mFrom] || removed[c.mTo] || !isValidCollapse(c.mFrom, c.mTo)) {
+					continue;
+				}
+
+				for (const auto t : trianglesOfVertex[c.mFrom]) {
+					if (!triangleAlive[t]) {
+						continue;
+					}
+					auto& tri = triangles[t];
+					if (tri[0] == c.mTo || tri[1] == c.mTo || tri[2] == c.mTo) {
+						triangleAlive[t] = false;
+						--liveTriangles;
+						continue;
+					}
+					for (glm::length_t k = 0; k < 3; ++k) {
+						if (tri[k] == c.mFrom) {
+							tri[k] = c.mTo;
+						}
+					}
+					trianglesOfVertex[c.mTo].push_back(t);
+				}
+				quadrics[c.mTo] += quadrics[c.mFrom];
+				removed[c.mFrom] = true;
+				touched[c.mFrom] = true;
+				touched[c.mTo] = true;
+				maxSquaredError = std::max(maxSquaredError, c.mCost);
+				++numCollapses;
+			}
+			if (0 == numCollapses) {
+				break;
+			}
+		}
+
+		aIndices.clear();
+		for (uint32_t t = 0; t < numTriangles; ++t) {
+			if (triangleAlive[t]) {
+				for (glm::length_t k = 0; k < 3; ++k) {
+					aIndices.push_back(globalOf[triangles[t][k]]);
+				}
+			}
+		}
+		return static_cast<float>(std::sqrt(std::max(maxSquaredError, 0.0)));
+	}
+
+	/** Partitions the given clusters into groups of up to sClustersPerGroup clusters, s.t. clusters within a group share as many vertices as possible.
+	 *	@param	aTriangles			The triangles of each cluster, as indices into the original vertices.
+	 *	@param	aPositionRemap		The position remap of the original vertices, s.t. clusters are also adjacent across texture coordinate seams.
+	 *	@return	The groups, as indices into aTriangles.
+	 */
+	static std::vector<std::vector<uint32_t>> group_clusters(const std::vector<std::vector<uint32_t>>& aTriangles, const std::vector<uint32_t>& aPositionRemap)
+	{
+		const auto numClusters = static_cast<uint32_t>(aTriangles.size());
+
+		// Pairs of (vertex, cluster), sorted by vertex, to find the clusters which share vertices:
+		std::vector<std::tuple<uint32_t, uint32_t>> vertexClusters;
+		for (uint32_t c = 0; c < numClusters; ++c) {
+			for (const auto vertex : aTriangles[c]) {
+				vertexClusters.emplace_back(aPositionRemap[vertex], c);
+			}
+		}
+		std::sort(std::begin(vertexClusters), std::end(vertexClusters));
+		vertexClusters.erase(std::unique(std::begin(vertexClusters), std::end(vertexClusters)), std::end(vertexClusters));
+
+		// Number of shared vertices between each pair of adjacent clusters:
+		std::vector<std::vector<std::tuple<uint32_t, uint32_t>>> neighbours(numClusters);
+		for (size_t begin = 0; begin < vertexClusters.size(); ) {
+			size_t end = begin + 1;
+			while (end < vertexClusters.size() && std::get<0>(vertexClusters[end]) == std::get<0>(vertexClusters[begin])) {
+				++end;
+			}
+			for (size_t i = begin; i < end; ++i) {
+				for (size_t j = begin; j < end; ++j) {
+					if (i != j) {
+						neighbours[std::get<1>(vertexClusters[i])].emplace_back(std::get<1>(vertexClusters[j]), 1u);
+					}
+				}
+			}
+			begin = end;
+		}
+		for (auto& n : neighbours) {
+			std::sort(std::begin(n), std::end(n));
+			std::vector<std::tuple<uint32_t, uint32_t>> merged;
+			for (const auto& [cluster, count] : n) {
+				if (!merged.empty() && std::get<0>(merged.back()) == cluster) {
+					std::get<1>(merged.back()) += count;
+				}
+				else {
+					merged.emplace_back(cluster, count);
+				}
+			}
+			n = std::move(merged);
+		}
+
+		constexpr uint32_t noGroup = std::numeric_limits<uint32_t>::max();
+		std::vector<uint32_t> groupOf(numClusters, noGroup);
+		std::vector<std::vector<uint32_t>> groups;
+		std::vector<uint32_t> connection(numClusters, 0u);
+		for (uint32_t seed = 0; seed < numClusters; ++seed) {
+			if (noGroup != groupOf[seed]) {
+				continue;
+			}
+			const auto groupIndex = static_cast<uint32_t>(groups.size());
+			auto& group = groups.emplace_back();
+			group.push_back(seed);
+			groupOf[seed] = groupIndex;
+
+			// Grow the group by the unassigned cluster which shares most vertices with it:
+			std::vector<uint32_t> candidates;
+			auto addNeighboursOf = [&](uint32_t aCluster) {
+				for (const auto& [neighbour, count] : neighbours[aCluster]) {
+					if (noGroup == groupOf[neighbour]) {
+						if (0u == connection[neighbour]) {
+							candidates.push_back(neighbour);
+						}
+						connection[neighbour] += count;
+					}
+				}
+			};
+			addNeighboursOf(seed);
+			while (group.size() < sClustersPerGroup) {
+				std::optional<uint32_t> best;
+				for (const auto candidate : candidates) {
+					if (noGroup == groupOf[candidate] && (!best.has_value() || connection[candidate] > connection[*best])) {
+						best = candidate;
+					}
+				}
+				if (!best.has_value()) {
+					break;
+				}
+				group.push_back(*best);
+				groupOf[*best] = groupIndex;
+				addNeighboursOf(*best);
+			}
+			for (const auto candidate : candidates) {
+				connection[candidate] = 0u;
+			}
+
+			// A cluster without unassigned neighbours can hardly be simplified on its own => join the best connected neighbouring group instead:
+			if (1u == group.size()) {
+				std::optional<uint32_t> bestGroup;
+				uint32_t bestCount = 0u;
+				for (const auto& [neighbour, count] : neighbours[seed]) {
+					const auto other = groupOf[neighbour];
+					if (other != groupIndex && groups[other].size() < 2u * sClustersPerGroup && count > bestCount) {
+						bestGroup = other;
+						bestCount = count;
+					}
+				}
+				if (bestGroup.has_value()) {
+					groups[*bestGroup].push_back(seed);
+					groupOf[seed] = *bestGroup;
+					groups.pop_back();
+				}
+			}
+		}
+		return groups;
+	}
+
+	meshlet_lod_hierarchy build_meshlet_lod_hierarchy(
+		const std::vector<glm::vec3>& aVertices,
+		const std::vector<uint32_t>& aIndices,
+		avk::model aModel,
+		std::optional<mesh_index_t> aMeshIndex,
+		uint32_t aMaxVertices, uint32_t aMaxIndices)
+	{
+		aModel.enable_shared_ownership();
+		meshlet_lod_hierarchy hierarchy;
+
+		auto addCluster = [&](meshlet aMeshlet, uint32_t aLevel, uint32_t aSourceGroup, float aError, std::optional<glm::vec4> aLodSphere) {
+			aMeshlet.mModel = aModel;
+			aMeshlet.mMeshIndex = aMeshIndex;
+			auto& cluster = hierarchy.mClusters.emplace_back();
+			cluster.mLevel = aLevel;
+			cluster.mSourceGroup = aSourceGroup;
+			cluster.mParentGroup = meshlet_lod_hierarchy::sNoGroup;
+			cluster.mBounds = compute_meshlet_bounds(aMeshlet, aVertices);
+			cluster.mError = aError;
+			cluster.mLodSphere = aLodSphere.value_or(cluster.mBounds.mBoundingSphere);
+			cluster.mParentError = std::numeric_limits<float>::max();
+			cluster.mParentLodSphere = cluster.mLodSphere;
+			hierarchy.mMeshlets.push_back(std::move(aMeshlet));
+			hierarchy.mNumLevels = std::max(hierarchy.mNumLevels, aLevel + 1u);
+			return static_cast<uint32_t>(hierarchy.mClusters.size() - 1);
+		};
+
+		// The clusters which currently represent the whole geometry, starting with the original geometry:
+		std::vector<uint32_t> currentClusters;
+		for (auto& ml : spatial_meshlets_divider(aVertices, aIndices, aModel.get(), aMeshIndex, aMaxVertices, aMaxIndices)) {
+			currentClusters.push_back(addCluster(std::move(ml), 0u, meshlet_lod_hierarchy::sNoGroup, 0.f, std::nullopt));
+		}
+
+		const auto positionRemap = make_position_remap(aVertices);
+		// Vertices which share their position with others must not move, otherwise the geometry would tear apart at the seams:
+		std::vector<uint32_t> verticesPerPosition(aVertices.size(), 0u);
+		for (const auto canonical : positionRemap) {
+			++verticesPerPosition[canonical];
+		}
+
+		while (currentClusters.size() > 1) {
+			std::vector<std::vector<uint32_t>> clusterTriangles(currentClusters.size());
+			for (size_t i = 0; i < currentClusters.size(); ++i) {
+				append_triangles(hierarchy.mMeshlets[currentClusters[i]], clusterTriangles[i]);
+			}
+			const auto groups = group_clusters(clusterTriangles, positionRemap);
+
+			// Lock all vertices which are shared between groups, at seams, or at the border of the geometry:
+			std::vector<bool> locked(aVertices.size(), false);
+			{
+				std::vector<uint32_t> groupOfPosition(aVertices.size(), meshlet_lod_hierarchy::sNoGroup);
+				for (uint32_t g = 0; g < static_cast<uint32_t>(groups.size()); ++g) {
+					for (const auto c : groups[g]) {
+						for (const auto vertex : clusterTriangles[c]) {
+							const auto canonical = positionRemap[vertex];
+							if (verticesPerPosition[canonical] > 1u) {
+								locked[vertex] = true;
+							}
+							if (meshlet_lod_hierarchy::sNoGroup == groupOfPosition[canonical]) {
+								groupOfPosition[canonical] = g;
+							}
+							else if (groupOfPosition[canonical] != g) {
+								locked[canonical] = true;
+							}
+						}
+					}
+				}
+				// Edges which are used by a single triangle only are at the border of the geometry:
+				std::vector<std::tuple<uint32_t, uint32_t>> edges;
+				for (const auto& triangles : clusterTriangles) {
+					for (size_t t = 0; t < triangles.size(); t += 3) {
+						for (size_t k = 0; k < 3; ++k) {
+							const auto a = positionRemap[triangles[t + k]];
+							const auto b = positionRemap[triangles[t + (k + 1) % 3]];
+							edges.emplace_back(std::min(a, b), std::max(a, b));
+						}
+					}
+				}
+				std::sort(std::begin(edges), std::end(edges));
+				for (size_t i = 0; i < edges.size(); ) {
+					size_t j = i + 1;
+					while (j < edges.size() && edges[j] == edges[i]) {
+						++j;
+					}
+					if (j - i == 1) {
+						locked[std::get<0>(edges[i])] = true;
+						locked[std::get<1>(edges[i])] = true;
+					}
+					i = j;
+				}
+				// Positions which have been locked via their canonical vertex apply to all vertices at that position:
+				for (size_t v = 0; v < aVertices.size(); ++v) {
+					locked[v] = locked[v] || locked[positionRemap[v]];
+				}
+			}
+
+			// Simplify and re-split the groups independently of each other:
+			struct simplified_group
+			{
+				float mError = 0.f;
+				std::vector<meshlet> mMeshlets;
+			};
+			std::vector<simplified_group> simplifiedGroups(groups.size());
+			parallel_for(groups.size(), [&](size_t g) {
+				std::vector<uint32_t> indices;
+				for (const auto c : groups[g]) {
+					indices.insert(std::end(indices), std::begin(clusterTriangles[c]), std::end(clusterTriangles[c]));
+				}
+				const auto numTriangles = indices.size() / 3;
+				const auto error = simplify_triangles(indices, aVertices, locked, numTriangles / 2);
+				if (static_cast<float>(indices.size() / 3) > static_cast<float>(numTriangles) * sMinSimplificationRatio) {
+					return;
+				}
+
+				// Divide the simplified geometry with compact vertex indices, and map them back afterwards:
+				std::vector<uint32_t> globalOf(indices);
+				std::sort(std::begin(globalOf), std::end(globalOf));
+				globalOf.erase(std::unique(std::begin(globalOf), std::end(globalOf)), std::end(globalOf));
+				std::vector<glm::vec3> localVertices(globalOf.size());
+				for (size_t v = 0; v < globalOf.size(); ++v) {
+					localVertices[v] = aVertices[globalOf[v]];
+				}
+				for (auto& index : indices) {
+					index = static_cast<uint32_t>(std::lower_bound(std::begin(globalOf), std::end(globalOf), index) - std::begin(globalOf));
+				}
+				auto meshlets = spatial_meshlets_divider(localVertices, indices, aModel.get(), aMeshIndex, aMaxVertices, aMaxIndices);
+				for (auto& ml : meshlets) {
+					for (uint32_t v = 0; v < ml.mVertexCount; ++v) {
+						ml.mVertices[v] = globalOf[ml.mVertices[v]];
+					}
+				}
+				simplifiedGroups[g].mError = error;
+				simplifiedGroups[g].mMeshlets = std::move(meshlets);
+			});
+
+			// Assemble the next level in group order, s.t. the result does not depend on the number of threads:
+			std::vector<uint32_t> nextClusters;
+			for (size_t g = 0; g < groups.size(); ++g) {
+				if (simplifiedGroups[g].mMeshlets.empty()) {
+					// Could not be simplified sufficiently => retry with other neighbours on the next iteration:
+					for (const auto c : groups[g]) {
+						nextClusters.push_back(currentClusters[c]);
+					}
+					continue;
+				}
+
+				const auto groupIndex = static_cast<uint32_t>(hierarchy.mGroups.size());
+				meshlet_lod_group group;
+				float maxChildError = 0.f;
+				uint32_t maxChildLevel = 0u;
+				for (const auto c : groups[g]) {
+					const auto& child = hierarchy.mClusters[currentClusters[c]];
+					group.mChildren.push_back(currentClusters[c]);
+					group.mLodSphere = group.mChildren.size() == 1 ? child.mLodSphere : merge_spheres(group.mLodSphere, child.mLodSphere);
+					maxChildError = std::max(maxChildError, child.mError);
+					maxChildLevel = std::max(maxChildLevel, child.mLevel);
+				}
+				// Accumulate the errors, s.t. they grow monotonically towards the roots:
+				group.mError = maxChildError + simplifiedGroups[g].mError;
+				for (const auto child : group.mChildren) {
+					auto& cluster = hierarchy.mClusters[child];
+					cluster.mParentGroup = groupIndex;
+					cluster.mParentError = group.mError;
+					cluster.mParentLodSphere = group.mLodSphere;
+				}
+				for (auto& ml : simplifiedGroups[g].mMeshlets) {
+					const auto parent = addCluster(std::move(ml), maxChildLevel + 1u, groupIndex, group.mError, group.mLodSphere);
+					group.mParents.push_back(parent);
+					nextClusters.push_back(parent);
+				}
+				hierarchy.mGroups.push_back(std::move(group));
+			}
+
+			if (nextClusters == currentClusters) {
+				// None of the groups could be simplified any further => the current clusters are the roots.
+				break;
+			}
+			currentClusters = std::move(nextClusters);
+		}
+
+		return hierarchy;
+	}
+
+	meshlet_lod_hierarchy build_meshlet_lod_hierarchy_cached(
+		avk::serializer& aSerializer,
+		const std::vector<glm::vec3>& aVertices,
+		const std::vector<uint32_t>& aIndices,
+		avk::model aModel,
+		std::optional<mesh_index_t> aMeshIndex,
+		uint32_t aMaxVertices, uint32_t aMaxIndices)
+	{
+		meshlet_lod_hierarchy hierarchy;
+		if (aSerializer.mode() == serializer::mode::serialize) {
+			hierarchy = build_meshlet_lod_hierarchy(aVertices, aIndices, aModel, aMeshIndex, aMaxVertices, aMaxIndices);
+		}
+		aSerializer.archive(hierarchy);
+		if (aSerializer.mode() == serializer::mode::deserialize) {
+			aModel.enable_shared_ownership();
+			for (auto& ml : hierarchy.mMeshlets) {
+				ml.mModel = aModel;
+			}
+		}
+		return hierarchy;
+	}
+
+	std::vector<meshlet_lod_gpu_data> convert_lod_clusters_for_gpu_usage(const meshlet_lod_hierarchy& aHierarchy)
+	{
+		std::vector<meshlet_lod_gpu_data> result;
+		result.reserve(aHierarchy.mClusters.size());
+		for (const auto& cluster : aHierarchy.mClusters) {
+			result.push_back({ cluster.mLodSphere, cluster.mParentLodSphere, cluster.mError, cluster.mParentError, cluster.mLevel, 0u });
+		}
+		return result;
+	}
+
+	std::vector<uint32_t> select_meshlet_lod_clusters(const meshlet_lod_hierarchy& aHierarchy, const glm::vec3& aViewPosition, float aErrorThreshold)
+	{
+		std::vector<uint32_t> selected;
+		for (uint32_t i = 0; i < static_cast<uint32_t>(aHierarchy.mClusters.size()); ++i) {
+			const auto& cluster = aHierarchy.mClusters[i];
+			if (meshlet_lod_projected_error(cluster.mLodSphere, cluster.mError, aViewPosition) <= aErrorThreshold
+				&& meshlet_lod_projected_error(cluster.mParentLodSphere, cluster.mParentError, aViewPosition) > aErrorThreshold) {
+				selected.push_back(i);
+			}
+		}
+		return selected;
+	}
+
+	std::vector<uint32_t> select_meshlet_lod_clusters_for_budget(const meshlet_lod_hierarchy& aHierarchy, const glm::vec3& aViewPosition, uint32_t aMaxTriangles)
+	{
+		auto countTriangles = [&](const std::vector<uint32_t>& aClusters) {
+			size_t count = 0;
+			for (const auto c : aClusters) {
+				count += aHierarchy.mMeshlets[c].mIndexCount / 3u;
+			}
+			return count;
+		};
+
+		// The number of selected triangles decreases monotonically with increasing thresholds => bisect the threshold:
+		auto best = select_meshlet_lod_clusters(aHierarchy, aViewPosition, 0.f);
+		if (countTriangles(best) <= aMaxTriangles) {
+			return best;
+		}
+		float low = 0.f;
+		float high = 1.f;
+		best = select_meshlet_lod_clusters(aHierarchy, aViewPosition, high);
+		while (countTriangles(best) > aMaxTriangles && high < std::numeric_limits<float>::max() / 4.f) {
+			low = high;
+			high *= 4.f;
+			best = select_meshlet_lod_clusters(aHierarchy, aViewPosition, high);
+		}
+		for (int i = 0; i < 24; ++i) {
+			const float mid = 0.5f * (low + high);
+			auto selection = select_meshlet_lod_clusters(aHierarchy, aViewPosition, mid);
+			if (countTriangles(selection) <= aMaxTriangles) {
+				high = mid;
+				best = std::move(selection);
+			}
+			else {
+				low = mid;
+			}
+		}
+		return best;
+	}
+}
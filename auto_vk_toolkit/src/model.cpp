@@ -2,6 +2,7 @@
 #include <sstream>
 
 #include "model.hpp"
+#include "serializer.hpp"
 #include <assimp/qnan.h>
 
 namespace avk
@@ -33,6 +34,311 @@ namespace avk
 		return result;
 	}
 
+
+	namespace
+	{
+		constexpr uint32_t sBakedModelMagic = 0x4D4B5641; // "AVKM"
+		constexpr uint32_t sBakedModelVersion = 2u;
+
+		/** Writes the magic number and the version of the baked model format, or reads them and returns whether they match */
+		bool archive_baked_model_header(serializer& aSerializer)
+		{
+			uint32_t magic = sBakedModelMagic, version = sBakedModelVersion;
+			aSerializer.archive(magic);
+			aSerializer.archive(version);
+			return sBakedModelMagic == magic && sBakedModelVersion == version;
+		}
+
+		/** Writes a scene into, or reads a scene from a baked model file. The same code path is used for
+		 *	both directions, s.t. the format can not diverge. When reading, all arrays are allocated with
+		 *	new[] as Assimp's destructors expect.
+		 */
+		class baked_scene_archive
+		{
+		public:
+			explicit baked_scene_archive(serializer& aSerializer)
+				: mSerializer{ aSerializer }
+				, mReading{ aSerializer.mode() == serializer::mode::deserialize }
+			{}
+
+			void archive_scene(aiScene& aScene)
+			{
+				archive_string(aScene.mName);
+				mSerializer.archive(aScene.mFlags);
+
+				bool hasRootNode = nullptr != aScene.mRootNode;
+				mSerializer.archive(hasRootNode);
+				if (hasRootNode) {
+					if (mReading) {
+						aScene.mRootNode = new aiNode();
+					}
+					archive_node(*aScene.mRootNode);
+				}
+
+				archive_objects(aScene.mMeshes, aScene.mNumMeshes, [this, &aScene](aiMesh& aMesh) { archive_mesh(aMesh, aScene.mRootNode); });
+				archive_objects(aScene.mMaterials, aScene.mNumMaterials, [this](aiMaterial& aMaterial) { archive_material(aMaterial); });
+				archive_objects(aScene.mAnimations, aScene.mNumAnimations, [this](aiAnimation& aAnimation) { archive_animation(aAnimation); });
+				archive_objects(aScene.mLights, aScene.mNumLights, [this](aiLight& aLight) { archive_light(aLight); });
+				archive_objects(aScene.mCameras, aScene.mNumCameras, [this](aiCamera& aCamera) { archive_camera(aCamera); });
+			}
+
+		private:
+			void archive_string(aiString& aValue)
+			{
+				std::string value = mReading ? std::string{} : std::string{ aValue.C_Str() };
+				mSerializer.archive(value);
+				if (mReading) {
+					aValue.Set(value);
+				}
+			}
+
+			template <typename... T>
+			void archive_values(T&... aValues)
+			{
+				(mSerializer.archive(aValues), ...);
+			}
+
+			template <typename T>
+			void archive_pod(T& aValue)
+			{
+				mSerializer.archive_memory(&aValue, sizeof(T));
+			}
+
+			/** Archives an array of plain data of the given length. */
+			template <typename T>
+			void archive_array(T*& aArray, unsigned int aCount)
+			{
+				if (mReading) {
+					aArray = aCount > 0 ? new T[aCount] : nullptr;
+				}
+				if (aCount > 0) {
+					mSerializer.archive_memory(aArray, sizeof(T) * aCount);
+				}
+			}
+
+			/** Archives an array of plain data of the given length, which may be nullptr. */
+			template <typename T>
+			void archive_optional_array(T*& aArray, unsigned int aCount)
+			{
+				bool present = nullptr != aArray;
+				mSerializer.archive(present);
+				if (present) {
+					archive_array(aArray, aCount);
+				}
+				else if (mReading) {
+					aArray = nullptr;
+				}
+			}
+
+			/** Archives the length of an array of pointers, and every object pointed to via aArchiveObject. */
+			template <typename T, typename F>
+			void archive_objects(T**& aArray, unsigned int& aCount, F aArchiveObject)
+			{
+				mSerializer.archive(aCount);
+				if (mReading) {
+					aArray = aCount > 0 ? new T*[aCount] : nullptr;
+				}
+				for (unsigned int i = 0; i < aCount; ++i) {
+					if (mReading) {
+						aArray[i] = new T();
+					}
+					aArchiveObject(*aArray[i]);
+				}
+			}
+
+			void archive_node(aiNode& aNode)
+			{
+				archive_string(aNode.mName);
+				archive_pod(aNode.mTransformation);
+				mSerializer.archive(aNode.mNumMeshes);
+				archive_array(aNode.mMeshes, aNode.mNumMeshes);
+				archive_objects(aNode.mChildren, aNode.mNumChildren, [this, &aNode](aiNode& aChild) {
+					aChild.mParent = &aNode;
+					archive_node(aChild);
+				});
+			}
+
+			/** Archives a pointer to a node of the scene by the node's name. When reading, the node is looked up below aRootNode. */
+			void archive_node_reference(aiNode*& aNode, const aiNode* aRootNode)
+			{
+				bool present = nullptr != aNode;
+				mSerializer.archive(present);
+				if (!present) {
+					if (mReading) {
+						aNode = nullptr;
+					}
+					return;
+				}
+				aiString name = mReading ? aiString{} : aNode->mName;
+				archive_string(name);
+				if (mReading) {
+					aNode = nullptr != aRootNode ? const_cast<aiNode*>(aRootNode)->FindNode(name) : nullptr;
+				}
+			}
+
+			void archive_mesh(aiMesh& aMesh, const aiNode* aRootNode)
+			{
+				archive_string(aMesh.mName);
+				archive_values(aMesh.mPrimitiveTypes, aMesh.mMaterialIndex, aMesh.mNumVertices);
+				archive_pod(aMesh.mAABB);
+
+				archive_array(aMesh.mVertices, aMesh.mNumVertices);
+				archive_optional_array(aMesh.mNormals, aMesh.mNumVertices);
+				archive_optional_array(aMesh.mTangents, aMesh.mNumVertices);
+				archive_optional_array(aMesh.mBitangents, aMesh.mNumVertices);
+				for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+					archive_optional_array(aMesh.mColors[i], aMesh.mNumVertices);
+				}
+				for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+					mSerializer.archive(aMesh.mNumUVComponents[i]);
+					archive_optional_array(aMesh.mTextureCoords[i], aMesh.mNumVertices);
+				}
+
+				// Faces are stored as one stream of index counts and one stream of indices:
+				mSerializer.archive(aMesh.mNumFaces);
+				std::vector<unsigned int> indexCounts(aMesh.mNumFaces);
+				if (!mReading) {
+					for (unsigned int i = 0; i < aMesh.mNumFaces; ++i) {
+						indexCounts[i] = aMesh.mFaces[i].mNumIndices;
+					}
+				}
+				if (!indexCounts.empty()) {
+					mSerializer.archive_memory(indexCounts.data(), sizeof(unsigned int) * indexCounts.size());
+				}
+				if (mReading) {
+					aMesh.mFaces = aMesh.mNumFaces > 0 ? new aiFace[aMesh.mNumFaces] : nullptr;
+				}
+				for (unsigned int i = 0; i < aMesh.mNumFaces; ++i) {
+					aMesh.mFaces[i].mNumIndices = indexCounts[i];
+					archive_array(aMesh.mFaces[i].mIndices, indexCounts[i]);
+				}
+
+				archive_objects(aMesh.mBones, aMesh.mNumBones, [this, aRootNode](aiBone& aBone) {
+					archive_string(aBone.mName);
+					archive_pod(aBone.mOffsetMatrix);
+					mSerializer.archive(aBone.mNumWeights);
+					archive_array(aBone.mWeights, aBone.mNumWeights);
+					// Only set if the model has been loaded with aiProcess_PopulateArmatureData:
+					archive_node_reference(aBone.mArmature, aRootNode);
+					archive_node_reference(aBone.mNode, aRootNode);
+				});
+			}
+
+			void archive_material(aiMaterial& aMaterial)
+			{
+				auto numProperties = aMaterial.mNumProperties;
+				mSerializer.archive(numProperties);
+				for (unsigned int i = 0; i < numProperties; ++i) {
+					aiMaterialProperty tmp;
+					aiMaterialProperty& property = mReading ? tmp : *aMaterial.mProperties[i];
+					archive_string(property.mKey);
+					archive_values(property.mSemantic, property.mIndex, property.mDataLength);
+					archive_pod(property.mType);
+					archive_array(property.mData, property.mDataLength);
+					if (mReading) {
+						aMaterial.AddBinaryProperty(property.mData, property.mDataLength, property.mKey.C_Str(), property.mSemantic, property.mIndex, property.mType);
+						// tmp's destructor releases property.mData
+					}
+				}
+			}
+
+			void archive_animation(aiAnimation& aAnimation)
+			{
+				archive_string(aAnimation.mName);
+				archive_values(aAnimation.mDuration, aAnimation.mTicksPerSecond);
+				archive_objects(aAnimation.mChannels, aAnimation.mNumChannels, [this](aiNodeAnim& aChannel) {
+					archive_string(aChannel.mNodeName);
+					archive_values(aChannel.mNumPositionKeys, aChannel.mNumRotationKeys, aChannel.mNumScalingKeys);
+					archive_array(aChannel.mPositionKeys, aChannel.mNumPositionKeys);
+					archive_array(aChannel.mRotationKeys, aChannel.mNumRotationKeys);
+					archive_array(aChannel.mScalingKeys, aChannel.mNumScalingKeys);
+					archive_pod(aChannel.mPreState);
+					archive_pod(aChannel.mPostState);
+				});
+			}
+
+			void archive_light(aiLight& aLight)
+			{
+				archive_string(aLight.mName);
+				archive_pod(aLight.mType);
+				archive_pod(aLight.mPosition);
+				archive_pod(aLight.mDirection);
+				archive_pod(aLight.mUp);
+				archive_values(aLight.mAttenuationConstant, aLight.mAttenuationLinear, aLight.mAttenuationQuadratic);
+				archive_pod(aLight.mColorDiffuse);
+				archive_pod(aLight.mColorSpecular);
+				archive_pod(aLight.mColorAmbient);
+				archive_values(aLight.mAngleInnerCone, aLight.mAngleOuterCone);
+				archive_pod(aLight.mSize);
+			}
+
+			void archive_camera(aiCamera& aCamera)
+			{
+				archive_string(aCamera.mName);
+				archive_pod(aCamera.mPosition);
+				archive_pod(aCamera.mUp);
+				archive_pod(aCamera.mLookAt);
+				archive_values(aCamera.mHorizontalFOV, aCamera.mClipPlaneNear, aCamera.mClipPlaneFar, aCamera.mAspect, aCamera.mOrthographicWidth);
+			}
+
+			serializer& mSerializer;
+			bool mReading;
+		};
+	}
+
+	avk::owning_resource<model_t> model_t::load_from_baked_file(const std::string& aPath)
+	{
+		if (!std::filesystem::exists(aPath)) {
+			throw avk::runtime_error(std::format("Baked model file '{}' does not exist.", aPath));
+		}
+		serializer s(aPath, serializer::mode::deserialize, serializer::read_strategy::memory_mapped);
+		if (!archive_baked_model_header(s)) {
+			throw avk::runtime_error(std::format("'{}' is not a baked model file of version {}.", aPath, sBakedModelVersion));
+		}
+
+		model_t result;
+		s.archive(result.mModelPath);
+		result.mBakedScene = std::make_unique<aiScene>();
+		baked_scene_archive{ s }.archive_scene(*result.mBakedScene);
+		result.mScene = result.mBakedScene.get();
+		result.initialize_materials();
+		return result;
+	}
+
+	avk::owning_resource<model_t> model_t::load_from_file_baked(const std::string& aPath, const std::string& aBakedPath, aiProcessFlagsType aAssimpFlags)
+	{
+		if (std::filesystem::exists(aBakedPath)) {
+			// A serializer version mismatch, a file which is too short, or a file which has been truncated by an
+			// interrupted bake_to_file throw => fall back to baking it again in all of these cases:
+			try {
+				bool isCurrentFormat;
+				{
+					serializer s(aBakedPath, serializer::mode::deserialize, serializer::read_strategy::memory_mapped);
+					isCurrentFormat = archive_baked_model_header(s);
+				}
+				if (isCurrentFormat) {
+					return load_from_baked_file(aBakedPath);
+				}
+				LOG_INFO(std::format("'{}' is not a baked model file of version {}. Going to bake '{}' again...", aBakedPath, sBakedModelVersion, aPath));
+			}
+			catch (std::exception& e) {
+				LOG_WARNING(std::format("Loading the baked model file '{}' failed: {}. Going to bake '{}' again...", aBakedPath, e.what(), aPath));
+			}
+		}
+		auto result = load_from_file(aPath, aAssimpFlags);
+		result->bake_to_file(aBakedPath);
+		return result;
+	}
+
+	void model_t::bake_to_file(const std::string& aPath) const
+	{
+		serializer s(aPath, serializer::mode::serialize);
+		archive_baked_model_header(s);
+		auto modelPath = mModelPath;
+		s.archive(modelPath);
+		// The archive is symmetric for reading and writing; in serialize mode, the scene is only read from:
+		baked_scene_archive{ s }.archive_scene(*const_cast<aiScene*>(mScene));
+	}
 	
 	void model_t::initialize_materials()
 	{
@@ -566,127 +872,149 @@ namespace avk
 		return static_cast<size_t>(paiMesh->mNumVertices);
 	}
 
-	std::vector<glm::vec3> model_t::positions_for_mesh(mesh_index_t aMeshIndex) const
+	void model_t::positions_for_mesh_into(mesh_index_t aMeshIndex, std::span<glm::vec3> aDestination) const
 	{
 		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
 		auto n = paiMesh->mNumVertices;
-		std::vector<glm::vec3> result;
-		result.reserve(n);
+		assert(aDestination.size() == n);
 		for (decltype(n) i = 0; i < n; ++i) {
-			result.push_back(glm::vec3(paiMesh->mVertices[i][0], paiMesh->mVertices[i][1], paiMesh->mVertices[i][2]));
+			aDestination[i] = glm::vec3(paiMesh->mVertices[i][0], paiMesh->mVertices[i][1], paiMesh->mVertices[i][2]);
 		}
+	}
+
+	std::vector<glm::vec3> model_t::positions_for_mesh(mesh_index_t aMeshIndex) const
+	{
+		std::vector<glm::vec3> result(number_of_vertices_for_mesh(aMeshIndex));
+		positions_for_mesh_into(aMeshIndex, result);
 		return result;
 	}
 
-	std::vector<glm::vec3> model_t::normals_for_mesh(mesh_index_t aMeshIndex) const
+	void model_t::normals_for_mesh_into(mesh_index_t aMeshIndex, std::span<glm::vec3> aDestination) const
 	{
 		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
 		auto n = paiMesh->mNumVertices;
-		std::vector<glm::vec3> result;
-		result.reserve(n);
+		assert(aDestination.size() == n);
 		if (nullptr == paiMesh->mNormals) {
 			LOG_WARNING(std::format("The mesh at index {} does not contain normals. Will return (0,0,1) normals for each vertex.", aMeshIndex));
 			for (decltype(n) i = 0; i < n; ++i) {
-				result.emplace_back(0.f, 0.f, 1.f);
+				aDestination[i] = glm::vec3(0.f, 0.f, 1.f);
 			}
 		}
 		else {
 			// We've got normals. Proceed as planned.
 			for (decltype(n) i = 0; i < n; ++i) {
-				result.emplace_back(paiMesh->mNormals[i][0], paiMesh->mNormals[i][1], paiMesh->mNormals[i][2]);
+				aDestination[i] = glm::vec3(paiMesh->mNormals[i][0], paiMesh->mNormals[i][1], paiMesh->mNormals[i][2]);
 			}
 		}
-		return result;
 	}
 
-	std::vector<glm::vec3> model_t::tangents_for_mesh(mesh_index_t aMeshIndex) const
+	std::vector<glm::vec3> model_t::normals_for_mesh(mesh_index_t aMeshIndex) const
 	{
-		std::vector<glm::vec3> result;
+		std::vector<glm::vec3> result(number_of_vertices_for_mesh(aMeshIndex));
+		normals_for_mesh_into(aMeshIndex, result);
+		return result;
+	}
 
+	void model_t::tangents_for_mesh_into(mesh_index_t aMeshIndex, std::span<glm::vec3> aDestination) const
+	{
+		assert(aDestination.size() == number_of_vertices_for_mesh(aMeshIndex));
 		if (mTangentsAndBitangents.contains(aMeshIndex)) {
-			result = std::get<0>(mTangentsAndBitangents.at(aMeshIndex));
+			const auto& tangents = std::get<0>(mTangentsAndBitangents.at(aMeshIndex));
+			std::copy(std::begin(tangents), std::end(tangents), std::begin(aDestination));
 		}
 		else {
 			const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
 			auto n = paiMesh->mNumVertices;
-			result.reserve(n);
 			if (nullptr == paiMesh->mTangents) {
 				LOG_WARNING(std::format("The mesh at index {} does not contain tangents. Will return (1,0,0) tangents for each vertex.", aMeshIndex));
 				for (decltype(n) i = 0; i < n; ++i) {
-					result.emplace_back(1.f, 0.f, 0.f);
+					aDestination[i] = glm::vec3(1.f, 0.f, 0.f);
 				}
 			}
 			else {
 				// We've got tangents. Proceed as planned.
 				for (decltype(n) i = 0; i < n; ++i) {
-					result.emplace_back(paiMesh->mTangents[i][0], paiMesh->mTangents[i][1], paiMesh->mTangents[i][2]);
+					aDestination[i] = glm::vec3(paiMesh->mTangents[i][0], paiMesh->mTangents[i][1], paiMesh->mTangents[i][2]);
 				}
 			}
 		}
+	}
 
+	std::vector<glm::vec3> model_t::tangents_for_mesh(mesh_index_t aMeshIndex) const
+	{
+		std::vector<glm::vec3> result(number_of_vertices_for_mesh(aMeshIndex));
+		tangents_for_mesh_into(aMeshIndex, result);
 		return result;
 	}
 
-	std::vector<glm::vec3> model_t::bitangents_for_mesh(mesh_index_t aMeshIndex) const
+	void model_t::bitangents_for_mesh_into(mesh_index_t aMeshIndex, std::span<glm::vec3> aDestination) const
 	{
-		std::vector<glm::vec3> result;
-
+		assert(aDestination.size() == number_of_vertices_for_mesh(aMeshIndex));
 		if (mTangentsAndBitangents.contains(aMeshIndex)) {
-			result = std::get<1>(mTangentsAndBitangents.at(aMeshIndex));
+			const auto& bitangents = std::get<1>(mTangentsAndBitangents.at(aMeshIndex));
+			std::copy(std::begin(bitangents), std::end(bitangents), std::begin(aDestination));
 		}
 		else {
 			const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
 			auto n = paiMesh->mNumVertices;
-			result.reserve(n);
 			if (nullptr == paiMesh->mBitangents) {
 				LOG_WARNING(std::format("The mesh at index {} does not contain bitangents. Will return (0,1,0) bitangents for each vertex.", aMeshIndex));
 				for (decltype(n) i = 0; i < n; ++i) {
-					result.emplace_back(0.f, 1.f, 0.f);
+					aDestination[i] = glm::vec3(0.f, 1.f, 0.f);
 				}
 			}
 			else {
 				// We've got bitangents. Proceed as planned.
 				for (decltype(n) i = 0; i < n; ++i) {
-					result.emplace_back(paiMesh->mBitangents[i][0], paiMesh->mBitangents[i][1], paiMesh->mBitangents[i][2]);
+					aDestination[i] = glm::vec3(paiMesh->mBitangents[i][0], paiMesh->mBitangents[i][1], paiMesh->mBitangents[i][2]);
 				}
 			}
 		}
+	}
 
+	std::vector<glm::vec3> model_t::bitangents_for_mesh(mesh_index_t aMeshIndex) const
+	{
+		std::vector<glm::vec3> result(number_of_vertices_for_mesh(aMeshIndex));
+		bitangents_for_mesh_into(aMeshIndex, result);
 		return result;
 	}
 
-	std::vector<glm::vec4> model_t::colors_for_mesh(mesh_index_t aMeshIndex, int aSet) const
+	void model_t::colors_for_mesh_into(mesh_index_t aMeshIndex, std::span<glm::vec4> aDestination, int aSet) const
 	{
 		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
 		auto n = paiMesh->mNumVertices;
-		std::vector<glm::vec4> result;
-		result.reserve(n);
+		assert(aDestination.size() == n);
 		assert(aSet >= 0 && aSet < AI_MAX_NUMBER_OF_COLOR_SETS);
 		if (nullptr == paiMesh->mColors[aSet]) {
 			LOG_WARNING(std::format("The mesh at index {} does not contain a color set at index {}. Will return opaque magenta for each vertex.", aMeshIndex, aSet));
 			for (decltype(n) i = 0; i < n; ++i) {
-				result.emplace_back(1.f, 0.f, 1.f, 1.f);
+				aDestination[i] = glm::vec4(1.f, 0.f, 1.f, 1.f);
 			}
 		}
 		else {
 			// We've got colors[_Set]. Proceed as planned.
 			for (decltype(n) i = 0; i < n; ++i) {
-				result.emplace_back(paiMesh->mColors[aSet][i][0], paiMesh->mColors[aSet][i][1], paiMesh->mColors[aSet][i][2], paiMesh->mColors[aSet][i][3]);
+				aDestination[i] = glm::vec4(paiMesh->mColors[aSet][i][0], paiMesh->mColors[aSet][i][1], paiMesh->mColors[aSet][i][2], paiMesh->mColors[aSet][i][3]);
 			}
 		}
+	}
+
+	std::vector<glm::vec4> model_t::colors_for_mesh(mesh_index_t aMeshIndex, int aSet) const
+	{
+		std::vector<glm::vec4> result(number_of_vertices_for_mesh(aMeshIndex));
+		colors_for_mesh_into(aMeshIndex, result, aSet);
 		return result;
 	}
 
-	std::vector<glm::vec4> model_t::bone_weights_for_mesh(mesh_index_t aMeshIndex, bool aNormalizeBoneWeights) const
+	void model_t::bone_weights_for_mesh_into(mesh_index_t aMeshIndex, std::span<glm::vec4> aDestination, bool aNormalizeBoneWeights) const
 	{
 		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
 		auto n = paiMesh->mNumVertices;
-		std::vector<glm::vec4> result;
-		result.reserve(n);
+		assert(aDestination.size() == n);
 		if (!paiMesh->HasBones()) {
 			LOG_WARNING(std::format("The mesh at index {} does not contain bones. Will return (1,0,0,0) bone weights for each vertex.", aMeshIndex));
 			for (decltype(n) i = 0; i < n; ++i) {
-				result.emplace_back(1.f, 0.f, 0.f, 0.f);
+				aDestination[i] = glm::vec4(1.f, 0.f, 0.f, 0.f);
 			}
 		}
 		else {
@@ -707,7 +1035,8 @@ namespace avk
 				// sort the current vertex' <bone id, weight> pairs descending by weight (so we can take the four most important ones)
 				std::sort(vTempWeightsPerVertex[i].begin(), vTempWeightsPerVertex[i].end(), [](std::tuple<uint32_t, float> a, std::tuple<uint32_t, float> b) { return std::get<float>(a) > std::get<float>(b); });
 
-				auto& weights = result.emplace_back(0.0f, 0.0f, 0.0f, 0.0f);
+				auto& weights = aDestination[i];
+				weights = glm::vec4(0.0f, 0.0f, 0.0f, 0.0f);
 				const auto numIndexWeightPairs = std::min(int{ 4 }, static_cast<int>(vTempWeightsPerVertex[i].size()));
 				for (int j = 0; j < numIndexWeightPairs; ++j) {
 					weights[j] = std::get<float>(vTempWeightsPerVertex[i][j]);
@@ -732,20 +1061,25 @@ namespace avk
 				LOG_WARNING(std::format("The mesh at index {} contains non-normalized bone weights, adding up to more than 1.001.", aMeshIndex));
 			}
 		}
+	}
+
+	std::vector<glm::vec4> model_t::bone_weights_for_mesh(mesh_index_t aMeshIndex, bool aNormalizeBoneWeights) const
+	{
+		std::vector<glm::vec4> result(number_of_vertices_for_mesh(aMeshIndex));
+		bone_weights_for_mesh_into(aMeshIndex, result, aNormalizeBoneWeights);
 		return result;
 	}
 
-	std::vector<glm::uvec4> model_t::bone_indices_for_mesh(mesh_index_t aMeshIndex, uint32_t aBoneIndexOffset) const
+	void model_t::bone_indices_for_mesh_into(mesh_index_t aMeshIndex, std::span<glm::uvec4> aDestination, uint32_t aBoneIndexOffset) const
 	{
 		const aiMesh* paiMesh = mScene->mMeshes[aMeshIndex];
 		auto n = paiMesh->mNumVertices;
-		std::vector<glm::uvec4> result;
-		result.reserve(n);
+		assert(aDestination.size() == n);
 		if (!paiMesh->HasBones()) {
 			const uint32_t fallbackIndex = aBoneIndexOffset;
 			LOG_WARNING(std::format("The mesh at index {} does not contain bones. Will return ({},{},{},{}) bone indices for each vertex.", aMeshIndex, fallbackIndex, fallbackIndex, fallbackIndex, fallbackIndex));
 			for (decltype(n) i = 0; i < n; ++i) {
-				result.emplace_back(fallbackIndex, fallbackIndex, fallbackIndex, fallbackIndex);
+				aDestination[i] = glm::uvec4(fallbackIndex, fallbackIndex, fallbackIndex, fallbackIndex);
 			}
 		}
 		else {
@@ -765,39 +1099,60 @@ namespace avk
 				// sort the current vertex' <bone id, weight> pairs descending by weight (so we can take the four most important ones)
 				std::sort(vTempWeightsPerVertex[i].begin(), vTempWeightsPerVertex[i].end(), [](std::tuple<uint32_t, float> a, std::tuple<uint32_t, float> b) { return std::get<float>(a) > std::get<float>(b); });
 
-				auto& indices = result.emplace_back(aBoneIndexOffset, aBoneIndexOffset, aBoneIndexOffset, aBoneIndexOffset);
+				auto& indices = aDestination[i];
+				indices = glm::uvec4(aBoneIndexOffset, aBoneIndexOffset, aBoneIndexOffset, aBoneIndexOffset);
 				const auto numIndexWeightPairs = std::min(int{ 4 }, static_cast<int>(vTempWeightsPerVertex[i].size()));
 				for (int j = 0; j < numIndexWeightPairs; ++j) {
 					indices[j] = std::get<uint32_t>(vTempWeightsPerVertex[i][j]) + aBoneIndexOffset;
 				}
 			}
 		}
+	}
+
+	std::vector<glm::uvec4> model_t::bone_indices_for_mesh(mesh_index_t aMeshIndex, uint32_t aBoneIndexOffset) const
+	{
+		std::vector<glm::uvec4> result(number_of_vertices_for_mesh(aMeshIndex));
+		bone_indices_for_mesh_into(aMeshIndex, result, aBoneIndexOffset);
 		return result;
 	}
 
 	std::vector<glm::uvec4> model_t::bone_indices_for_meshes_for_single_target_buffer(const std::vector<mesh_index_t>& aMeshIndices, uint32_t aInitialBoneIndexOffset) const
 	{
-		std::vector<glm::uvec4> result;
+		size_t totalVertices = 0;
+		for (auto meshIndex : aMeshIndices) {
+			totalVertices += number_of_vertices_for_mesh(meshIndex);
+		}
+		std::vector<glm::uvec4> result(totalVertices);
+		size_t vertexOffset = 0;
 		uint32_t offset = aInitialBoneIndexOffset;
 		for (auto meshIndex : aMeshIndices) {
-			auto tmp = bone_indices_for_mesh(meshIndex, offset);
-			std::move(std::begin(tmp), std::end(tmp), std::back_inserter(result));
+			const auto n = number_of_vertices_for_mesh(meshIndex);
+			bone_indices_for_mesh_into(meshIndex, std::span<glm::uvec4>(result).subspan(vertexOffset, n), offset);
+			vertexOffset += n;
 			offset += num_bone_matrices(meshIndex);
 		}
 		return result;
 	}
 
-	std::vector<glm::uvec4> model_t::bone_indices_for_mesh_for_single_target_buffer(mesh_index_t aMeshIndex, const std::vector<mesh_index_t>& aMeshIndicesWithBonesInOrder) const
+	void model_t::bone_indices_for_mesh_for_single_target_buffer_into(mesh_index_t aMeshIndex, const std::vector<mesh_index_t>& aMeshIndicesWithBonesInOrder, std::span<glm::uvec4> aDestination) const
 	{
 		uint32_t offset = 0u;
 		for (auto mi : aMeshIndicesWithBonesInOrder) {
 			if (mi == aMeshIndex) {
-				return bone_indices_for_mesh(mi, offset);
+				bone_indices_for_mesh_into(mi, aDestination, offset);
+				return;
 			}
 			offset += num_bone_matrices(mi);
 		}
 		throw std::runtime_error("Invalid arguments to model_t::bone_indices_for_mesh_for_single_target_buffer: The list of aMeshIndicesWithBonesInOrder must contain the aMeshIndex.");
 	}
+
+	std::vector<glm::uvec4> model_t::bone_indices_for_mesh_for_single_target_buffer(mesh_index_t aMeshIndex, const std::vector<mesh_index_t>& aMeshIndicesWithBonesInOrder) const
+	{
+		std::vector<glm::uvec4> result(number_of_vertices_for_mesh(aMeshIndex));
+		bone_indices_for_mesh_for_single_target_buffer_into(aMeshIndex, aMeshIndicesWithBonesInOrder, result);
+		return result;
+	}
 	
 	int model_t::num_uv_components_for_mesh(mesh_index_t aMeshIndex, int aSet) const
 	{
@@ -1115,6 +1470,7 @@ namespace avk
 		auto addAnimatedNode = [&](aiNodeAnim* bChannel, aiNode* bNode, std::optional<size_t> bAnimatedParentIndex, const glm::mat4& bUnanimatedParentTransform){
 			auto& anode = result.mAnimationData.emplace_back();
 			mapNodeToAniNodeIndex[bNode] = result.mAnimationData.size() - 1;
+			anode.mNodeName = to_string(bNode->mName);
 
 			if (nullptr != bChannel) {
 				for (unsigned int i = 0; i < bChannel->mNumPositionKeys; ++i) {
@@ -1404,6 +1760,12 @@ namespace avk
 		}
 	}
 
+	const std::tuple<std::vector<glm::vec3>, std::vector<glm::vec3>>* model_t::calculated_tangent_space_for_mesh(mesh_index_t aMeshIndex) const
+	{
+		const auto it = mTangentsAndBitangents.find(aMeshIndex);
+		return mTangentsAndBitangents.end() == it ? nullptr : &it->second;
+	}
+
 	void model_t::calculate_tangent_space_for_mesh(mesh_index_t aMeshIndex, uint32_t aConfigSourceUV)
 	{
 		mTangentsAndBitangents[aMeshIndex] = std::make_tuple(std::vector<glm::vec3>{}, std::vector<glm::vec3>{});
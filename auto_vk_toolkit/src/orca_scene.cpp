@@ -17,7 +17,7 @@ namespace avk
 		return result;
 	}
 
-	avk::owning_resource<orca_scene_t> orca_scene_t::load_from_file(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags)
+	avk::owning_resource<orca_scene_t> orca_scene_t::load_from_file(const std::string& aPath, model_t::aiProcessFlagsType aAssimpFlags, bool aLoadModels)
 	{
 		std::ifstream stream(aPath, std::ifstream::in);
 		if (!stream.good() || !stream || stream.fail())
@@ -154,7 +154,9 @@ namespace avk
 		auto fsceneBasePath = avk::extract_base_path(result.mLoadPath);
 		for (auto& modelData : result.mModelData) {
 			modelData.mFullPathName = avk::combine_paths(fsceneBasePath, modelData.mFileName);
-			modelData.mLoadedModel = model_t::load_from_file(modelData.mFullPathName, aAssimpFlags);
+			if (aLoadModels) {
+				modelData.mLoadedModel = model_t::load_from_file(modelData.mFullPathName, aAssimpFlags);
+			}
 		}
 		
 		return result;
@@ -0,0 +1,108 @@
+#include "parallel_for.hpp"
+
+namespace avk
+{
+	parallel_for_pool& parallel_for_pool::instance()
+	{
+		static parallel_for_pool sPool{ parallel_for_max_threads() - 1 };
+		return sPool;
+	}
+
+	parallel_for_pool::parallel_for_pool(size_t aNumWorkers)
+	{
+		mWorkers.reserve(aNumWorkers);
+		for (size_t t = 0; t < aNumWorkers; ++t) {
+			mWorkers.emplace_back(&parallel_for_pool::worker_main, this, t + 1);
+		}
+	}
+
+	parallel_for_pool::~parallel_for_pool()
+	{
+		{
+			std::scoped_lock<std::mutex> guard(mMutex);
+			mStop = true;
+		}
+		mJobAvailable.notify_all();
+		for (auto& w : mWorkers) {
+			w.join();
+		}
+	}
+
+	void parallel_for_pool::job::work()
+	{
+		for (size_t i = mNextItem.fetch_add(1, std::memory_order_relaxed); i < mCount && !mFailed.load(std::memory_order_relaxed); i = mNextItem.fetch_add(1, std::memory_order_relaxed)) {
+			try {
+				(*mFunc)(i);
+			}
+			catch (...) {
+				std::scoped_lock<std::mutex> guard(mExceptionMutex);
+				if (!mFirstException) {
+					mFirstException = std::current_exception();
+				}
+				mFailed = true;
+			}
+		}
+	}
+
+	void parallel_for_pool::run(size_t aCount, const std::function<void(size_t)>& aFunc, size_t aMaxHelpers)
+	{
+		job j;
+		j.mCount = aCount;
+		j.mFunc = &aFunc;
+		const auto numHelpers = std::min(aMaxHelpers, mWorkers.size());
+		j.mHelpersLeft = numHelpers;
+
+		if (numHelpers > 0) {
+			{
+				std::scoped_lock<std::mutex> guard(mMutex);
+				mJobs.push_back(&j);
+			}
+			if (numHelpers == mWorkers.size()) {
+				mJobAvailable.notify_all();
+			}
+			else {
+				for (size_t h = 0; h < numHelpers; ++h) {
+					mJobAvailable.notify_one();
+				}
+			}
+		}
+
+		j.work();
+
+		{
+			// No further helpers may join, and the job must outlive all of those which have joined:
+			std::unique_lock<std::mutex> lk(mMutex);
+			mJobs.erase(std::remove(std::begin(mJobs), std::end(mJobs), &j), std::end(mJobs));
+			j.mHelpersDone.wait(lk, [&j] { return 0 == j.mActiveHelpers; });
+		}
+
+		if (j.mFirstException) {
+			std::rethrow_exception(j.mFirstException);
+		}
+	}
+
+	void parallel_for_pool::worker_main(size_t aThreadIndex)
+	{
+		set_cpu_profile_thread_name(std::format("parallel_for worker #{}", aThreadIndex));
+		std::unique_lock<std::mutex> lk(mMutex);
+		while (true) {
+			mJobAvailable.wait(lk, [this] { return mStop || !mJobs.empty(); });
+			if (mStop) {
+				return;
+			}
+			auto* j = mJobs.front();
+			if (0 == --j->mHelpersLeft) {
+				mJobs.pop_front();
+			}
+			++j->mActiveHelpers;
+
+			lk.unlock();
+			j->work();
+			lk.lock();
+
+			if (0 == --j->mActiveHelpers) {
+				j->mHelpersDone.notify_all();
+			}
+		}
+	}
+}
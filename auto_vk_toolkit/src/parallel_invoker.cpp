@@ -0,0 +1,166 @@
+#include "parallel_invoker.hpp"
+
+namespace avk
+{
+	parallel_invoker::parallel_invoker(size_t aMaxThreads)
+	{
+		const auto numThreads = std::max(size_t{ 1 }, aMaxThreads);
+		for (size_t t = 0; t < numThreads; ++t) {
+			mQueues.push_back(std::make_unique<work_queue>());
+		}
+		mWorkers.reserve(numThreads - 1);
+		for (size_t t = 1; t < numThreads; ++t) {
+			mWorkers.emplace_back(&parallel_invoker::worker_main, this, t);
+		}
+	}
+
+	parallel_invoker::~parallel_invoker()
+	{
+		{
+			std::scoped_lock<std::mutex> guard(mJobMutex);
+			mStop = true;
+		}
+		mJobStarted.notify_all();
+		for (auto& w : mWorkers) {
+			w.join();
+		}
+	}
+
+	void parallel_invoker::invoke_updates(const std::vector<invokee*>& elements)
+	{
+		// The elements are sorted by execution order => process one group of equal execution orders after the other:
+		size_t groupBegin = 0;
+		while (groupBegin < elements.size()) {
+			const auto executionOrder = elements[groupBegin]->execution_order();
+			auto groupEnd = groupBegin + 1;
+			while (groupEnd < elements.size() && elements[groupEnd]->execution_order() == executionOrder) {
+				++groupEnd;
+			}
+			run(groupEnd - groupBegin, [&elements, groupBegin](size_t i) {
+				auto* e = elements[groupBegin + i];
+				if (e->is_enabled()) {
+					AVK_PROFILE_SCOPE_ID(e->update_profile_name_id());
+					e->update();
+				}
+			});
+			groupBegin = groupEnd;
+		}
+	}
+
+	void parallel_invoker::invoke_renders(const std::vector<invokee*>& elements)
+	{
+		sequential_invoker{}.invoke_renders(elements);
+	}
+
+	void parallel_invoker::run(size_t aCount, std::function<void(size_t)> aFunc, size_t aNumItemsForCallingThread)
+	{
+		aNumItemsForCallingThread = std::min(aNumItemsForCallingThread, aCount);
+		if (mWorkers.empty() || aCount - aNumItemsForCallingThread <= 1) {
+			for (size_t i = 0; i < aCount; ++i) {
+				aFunc(i);
+			}
+			return;
+		}
+
+		// Distribute the items round-robin, s.t. every thread has work initially:
+		for (size_t i = aNumItemsForCallingThread; i < aCount; ++i) {
+			auto& q = *mQueues[i % mQueues.size()];
+			std::scoped_lock<std::mutex> guard(q.mMutex);
+			q.mItems.push_back(i);
+		}
+
+		{
+			std::scoped_lock<std::mutex> guard(mJobMutex);
+			mJobFunc = std::move(aFunc);
+			mJobFailed = false;
+			mJobException = nullptr;
+			mBusyWorkers = mWorkers.size();
+			++mJobGeneration;
+		}
+		mJobStarted.notify_all();
+
+		for (size_t i = 0; i < aNumItemsForCallingThread; ++i) {
+			invoke_item(i);
+		}
+		work(0);
+
+		std::unique_lock<std::mutex> lk(mJobMutex);
+		mJobFinished.wait(lk, [this] { return 0 == mBusyWorkers; });
+		mJobFunc = nullptr;
+		if (mJobException) {
+			std::rethrow_exception(std::exchange(mJobException, nullptr));
+		}
+	}
+
+	std::optional<size_t> parallel_invoker::take_item(size_t aThreadIndex)
+	{
+		{
+			auto& own = *mQueues[aThreadIndex];
+			std::scoped_lock<std::mutex> guard(own.mMutex);
+			if (!own.mItems.empty()) {
+				const auto item = own.mItems.back();
+				own.mItems.pop_back();
+				return item;
+			}
+		}
+		for (size_t offset = 1; offset < mQueues.size(); ++offset) {
+			auto& other = *mQueues[(aThreadIndex + offset) % mQueues.size()];
+			std::scoped_lock<std::mutex> guard(other.mMutex);
+			if (!other.mItems.empty()) {
+				const auto item = other.mItems.front();
+				other.mItems.pop_front();
+				return item;
+			}
+		}
+		return {};
+	}
+
+	void parallel_invoker::invoke_item(size_t aItem)
+	{
+		if (mJobFailed.load(std::memory_order_relaxed)) {
+			// Skip the remaining items after a failure:
+			return;
+		}
+		try {
+			mJobFunc(aItem);
+		}
+		catch (...) {
+			std::scoped_lock<std::mutex> guard(mJobMutex);
+			if (!mJobException) {
+				mJobException = std::current_exception();
+			}
+			mJobFailed = true;
+		}
+	}
+
+	void parallel_invoker::work(size_t aThreadIndex)
+	{
+		for (auto item = take_item(aThreadIndex); item.has_value(); item = take_item(aThreadIndex)) {
+			invoke_item(item.value());
+		}
+	}
+
+	void parallel_invoker::worker_main(size_t aThreadIndex)
+	{
+		set_cpu_profile_thread_name(std::format("parallel_invoker worker #{}", aThreadIndex));
+		uint64_t lastGeneration = 0;
+		while (true) {
+			{
+				std::unique_lock<std::mutex> lk(mJobMutex);
+				mJobStarted.wait(lk, [this, lastGeneration] { return mStop || mJobGeneration != lastGeneration; });
+				if (mStop) {
+					return;
+				}
+				lastGeneration = mJobGeneration;
+			}
+
+			work(aThreadIndex);
+
+			{
+				std::scoped_lock<std::mutex> guard(mJobMutex);
+				--mBusyWorkers;
+			}
+			mJobFinished.notify_one();
+		}
+	}
+}
@@ -0,0 +1,125 @@
+#include "task_graph_invoker.hpp"
+
+namespace avk
+{
+	task_graph_invoker::task_graph_invoker(size_t aMaxThreads, bool aOverlapFrames)
+		: mInvoker{ aMaxThreads }
+		, mOverlapFrames{ aOverlapFrames }
+	{ }
+
+	frame_task_graph::task_id task_graph_invoker::add_update_tasks(const std::vector<invokee*>& aElements, const std::function<void()>& aUpdatesDone)
+	{
+		std::vector<frame_task_graph::task_id> updateTasks;
+		for (auto* e : aElements) {
+			if (!e->is_enabled()) {
+				continue;
+			}
+			frame_task_access access;
+			e->declare_update_access(access);
+			// An invokee which does not declare its accesses could use anything, including thread-affine APIs like
+			// GLFW or ImGui => update it on the calling thread:
+			const bool onCallingThread = access.is_exclusive();
+			updateTasks.push_back(mGraph.add_task(e->name() + " update", [e]() {
+				AVK_PROFILE_SCOPE_ID(e->update_profile_name_id());
+				e->update();
+			}, std::move(access), onCallingThread));
+		}
+		// Does not access any resources, s.t. the render() tasks of the previous frame do not have to wait for it:
+		const auto updatesDone = mGraph.add_task("updates done", [&aUpdatesDone]() { aUpdatesDone(); }, frame_task_access{}.independent(), true);
+		for (auto t : updateTasks) {
+			mGraph.add_dependency(updatesDone, t);
+		}
+		return updatesDone;
+	}
+
+	void task_graph_invoker::add_render_tasks(const std::vector<invokee*>& aElements, std::optional<frame_task_graph::task_id> aUpdatesDone)
+	{
+		const auto syncBeforeRender = mGraph.add_task("sync before render", []() {
+			// Sync (wait for fences and so) per window BEFORE executing render callbacks
+			context().execute_for_each_window([](window* wnd) {
+				wnd->sync_before_render();
+			});
+			updater::prepare_for_current_frame();
+		}, frame_task_access{}.writes(sWindowsResource), true);
+		// All other render tasks are ordered after this one via sWindowsResource:
+		if (aUpdatesDone.has_value()) {
+			mGraph.add_dependency(syncBeforeRender, aUpdatesDone.value());
+		}
+
+		for (auto* e : aElements) {
+			frame_task_access access;
+			e->declare_render_access(access);
+			if (!access.is_exclusive()) {
+				access.writes(sWindowsResource);
+			}
+			mGraph.add_task(e->name() + " render", [e]() {
+				// Like the update zones, only enabled invokees are profiled:
+				AVK_PROFILE_SCOPE_ID(e->is_enabled() ? e->render_profile_name_id() : cpu_profile_no_name_id);
+				if (e->is_enabled()) {
+					// First, apply potential changes required by the updater of the invokee,
+					// if one really exist. It is important that those changes are applied
+					// before the next render call.
+					e->apply_recreation_updates();
+				}
+				if (e->is_render_enabled()) {
+					e->render();
+				}
+			}, std::move(access), true);
+		}
+
+		mGraph.add_task("render frame", []() {
+			context().execute_for_each_window([](window* wnd) {
+				wnd->render_frame();
+			});
+		}, frame_task_access{}.writes(sWindowsResource), true);
+	}
+
+	void task_graph_invoker::invoke_frame(const std::vector<invokee*>& aElements, timer_frame_type aFrameType, const std::function<void()>& aUpdatesDone, const std::function<void()>& aSwapInputBuffers)
+	{
+		mGraph.clear();
+
+		const bool isUpdateFrame = (aFrameType & timer_frame_type::update) == timer_frame_type::update;
+		const bool isRenderFrame = (aFrameType & timer_frame_type::render) == timer_frame_type::render;
+
+		if (mOverlapFrames) {
+			// The render tasks of the previous frame come first, s.t. conflicting update tasks wait for them:
+			if (mPendingRender.has_value()) {
+				// Invokees which have been added since have not been updated in the previous frame, and
+				// removed ones must not be rendered:
+				std::vector<invokee*> toBeRendered;
+				for (auto* e : aElements) {
+					if (std::find(std::begin(*mPendingRender), std::end(*mPendingRender), e) != std::end(*mPendingRender)) {
+						toBeRendered.push_back(e);
+					}
+				}
+				add_render_tasks(toBeRendered, {});
+			}
+			if (isUpdateFrame) {
+				add_update_tasks(aElements, aUpdatesDone);
+			}
+		}
+		else {
+			std::optional<frame_task_graph::task_id> updatesDone;
+			if (isUpdateFrame) {
+				updatesDone = add_update_tasks(aElements, aUpdatesDone);
+			}
+			if (isRenderFrame) {
+				add_render_tasks(aElements, updatesDone);
+			}
+		}
+
+		// Update and render tasks may read the current input buffer => swap it after all of them:
+		const auto numTasks = mGraph.number_of_tasks();
+		const auto swapInputBuffers = mGraph.add_task("swap input buffers", [&aSwapInputBuffers]() { aSwapInputBuffers(); }, frame_task_access{}.writes(sInputResource), true);
+		for (frame_task_graph::task_id t = 0; t < numTasks; ++t) {
+			mGraph.add_dependency(swapInputBuffers, t);
+		}
+
+		// If a task throws, the render tasks of this frame are not pending, but those of the previous frame are done:
+		mPendingRender.reset();
+		mGraph.execute(mInvoker);
+		if (mOverlapFrames && isRenderFrame) {
+			mPendingRender = aElements;
+		}
+	}
+}
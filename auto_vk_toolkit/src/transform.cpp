@@ -7,7 +7,8 @@ namespace avk
 	void transform::update_matrix_from_transforms()
 	{
 		mMatrix = matrix_from_transforms(mTranslation, mRotation, mScale);
-		mInverseMatrix = glm::inverse(mMatrix);
+		mInverseMatrixOutdated = true;
+		invalidate_global_matrices();
 	}
 	
 	void transform::update_transforms_from_matrix()
@@ -18,6 +19,40 @@ namespace avk
 		mScale = scale;
 	}
 
+	void transform::invalidate_global_matrices()
+	{
+		if (mGlobalMatrixOutdated.load(std::memory_order_relaxed)) {
+			// All child transforms are outdated already:
+			return;
+		}
+		mGlobalMatrixOutdated = true;
+		mInverseGlobalMatrixOutdated = true;
+		for (auto& child : mChilds) {
+			child->invalidate_global_matrices();
+		}
+	}
+
+	void transform::update_global_matrix_if_outdated() const
+	{
+		if (!mGlobalMatrixOutdated.load(std::memory_order_acquire)) {
+			return;
+		}
+		// Parents are locked while their children are locked, but never the other way round:
+		std::scoped_lock<std::mutex> guard(mCacheMutex);
+		if (!mGlobalMatrixOutdated.load(std::memory_order_relaxed)) {
+			return; // Another thread has been faster
+		}
+		if (mParent) {
+			mGlobalMatrix = mParent->global_transformation_matrix() * mMatrix;
+		}
+		else {
+			mGlobalMatrix = mMatrix;
+		}
+		mInverseGlobalMatrixOutdated.store(true, std::memory_order_relaxed);
+		++mGlobalVersion;
+		mGlobalMatrixOutdated.store(false, std::memory_order_release);
+	}
+
 	transform::transform(vec3 pTranslation, quat pRotation, vec3 pScale) noexcept
 		: mTranslation(pTranslation)
 		, mRotation(pRotation)
@@ -42,6 +77,7 @@ namespace avk
 	transform::transform(transform&& other) noexcept
 		: mMatrix{ std::move(other.mMatrix) }
 		, mInverseMatrix{ std::move(other.mInverseMatrix) }
+		, mInverseMatrixOutdated{ other.mInverseMatrixOutdated.load() }
 		, mTranslation{ std::move(other.mTranslation) }
 		, mRotation{ std::move(other.mRotation) }
 		, mScale{ std::move(other.mScale) }
@@ -59,6 +95,7 @@ namespace avk
 	transform::transform(const transform& other) noexcept
 		: mMatrix{ other.mMatrix }
 		, mInverseMatrix{ other.mInverseMatrix }
+		, mInverseMatrixOutdated{ other.mInverseMatrixOutdated.load() }
 		, mTranslation{ other.mTranslation }
 		, mRotation{ other.mRotation }
 		, mScale{ other.mScale }
@@ -76,6 +113,7 @@ namespace avk
 	{
 		mMatrix = std::move(other.mMatrix);
 		mInverseMatrix = std::move(other.mInverseMatrix);
+		mInverseMatrixOutdated = other.mInverseMatrixOutdated.load();
 		mTranslation = std::move(other.mTranslation);
 		mRotation = std::move(other.mRotation);
 		mScale = std::move(other.mScale);
@@ -87,6 +125,7 @@ namespace avk
 		}
 		other.mParent = nullptr;
 		other.mChilds.clear();
+		invalidate_global_matrices();
 		return *this;
 	}
 	
@@ -94,6 +133,7 @@ namespace avk
 	{
 		mMatrix = other.mMatrix;
 		mInverseMatrix = other.mInverseMatrix;
+		mInverseMatrixOutdated = other.mInverseMatrixOutdated.load();
 		mTranslation = other.mTranslation;
 		mRotation = other.mRotation;
 		mScale = other.mScale;
@@ -104,6 +144,7 @@ namespace avk
 			auto clonedChild = std::make_shared<transform>(*child);
 			attach_transform(shared_from_this(), child);
 		}
+		invalidate_global_matrices();
 		return *this;
 	}
 
@@ -134,8 +175,9 @@ namespace avk
 	void transform::set_matrix(const glm::mat4& aValue)
 	{
 		mMatrix = aValue;
-		mInverseMatrix = glm::inverse(mMatrix);
+		mInverseMatrixOutdated = true;
 		update_transforms_from_matrix();
+		invalidate_global_matrices();
 	}
 
 	glm::mat4 transform::local_transformation_matrix() const
@@ -145,22 +187,39 @@ namespace avk
 
 	glm::mat4 transform::inverse_local_transformation_matrix() const
 	{
+		if (mInverseMatrixOutdated.load(std::memory_order_acquire)) {
+			std::scoped_lock<std::mutex> guard(mCacheMutex);
+			if (mInverseMatrixOutdated.load(std::memory_order_relaxed)) {
+				mInverseMatrix = glm::inverse(mMatrix);
+				mInverseMatrixOutdated.store(false, std::memory_order_release);
+			}
+		}
 		return mInverseMatrix;
 	}
 	
 	glm::mat4 transform::global_transformation_matrix() const
 	{
-		if (mParent) {
-			return mParent->global_transformation_matrix() * mMatrix;
-		}
-		else {
-			return mMatrix;
-		}
+		update_global_matrix_if_outdated();
+		return mGlobalMatrix;
 	}
 
 	glm::mat4 transform::inverse_global_transformation_matrix() const
 	{
-		return glm::inverse(global_transformation_matrix());
+		update_global_matrix_if_outdated();
+		if (mInverseGlobalMatrixOutdated.load(std::memory_order_acquire)) {
+			std::scoped_lock<std::mutex> guard(mCacheMutex);
+			if (mInverseGlobalMatrixOutdated.load(std::memory_order_relaxed)) {
+				mInverseGlobalMatrix = glm::inverse(mGlobalMatrix);
+				mInverseGlobalMatrixOutdated.store(false, std::memory_order_release);
+			}
+		}
+		return mInverseGlobalMatrix;
+	}
+
+	uint64_t transform::global_transformation_version() const
+	{
+		update_global_matrix_if_outdated();
+		return mGlobalVersion;
 	}
 
 	void transform::look_at(const glm::vec3& aPosition)
@@ -213,6 +272,7 @@ namespace avk
 		}
 		pChild->mParent = pParent;
 		pParent->mChilds.push_back(pChild);
+		pChild->invalidate_global_matrices();
 	}
 
 	void detach_transform(transform::ptr pParent, transform::ptr pChild)
@@ -224,6 +284,7 @@ namespace avk
 			return;
 		}
 		pChild->mParent = nullptr;
+		pChild->invalidate_global_matrices();
 		pParent->mChilds.erase(std::remove(
 				std::begin(pParent->mChilds), std::end(pParent->mChilds),
 				pChild
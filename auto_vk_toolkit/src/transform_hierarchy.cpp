@@ -0,0 +1,285 @@
+#include "transform_hierarchy.hpp"
+
+namespace avk
+{
+	transform_hierarchy::handle transform_hierarchy::add(handle aParent, glm::vec3 aTranslation, glm::quat aRotation, glm::vec3 aScale)
+	{
+		const auto parentIndex = sNone == aParent ? sNone : index_of(aParent);
+
+		handle h;
+		if (!mFreeHandles.empty()) {
+			h = mFreeHandles.back();
+			mFreeHandles.pop_back();
+		}
+		else {
+			h = static_cast<handle>(mIndexOfHandle.size());
+			mIndexOfHandle.push_back(sNone);
+		}
+
+		// Append the new node. If it has a parent, the depth-first order is restored by the next update:
+		const auto index = static_cast<uint32_t>(mTranslations.size());
+		mTranslations.push_back(aTranslation);
+		mRotations.push_back(aRotation);
+		mScales.push_back(aScale);
+		mGlobalMatrices.emplace_back(1.f);
+		mParentIndices.push_back(parentIndex);
+		mSubtreeSizes.push_back(1);
+		mDirty.push_back(1);
+		mRemoved.push_back(0);
+		mHandleAtIndex.push_back(h);
+		mIndexOfHandle[h] = index;
+		++mNumNodes;
+		mStructureChanged = true;
+		return h;
+	}
+
+	transform_hierarchy::handle transform_hierarchy::add(handle aParent, const transform& aTransform)
+	{
+		return add(aParent, aTransform.translation(), aTransform.rotation(), aTransform.scale());
+	}
+
+	void transform_hierarchy::remove(handle aNode)
+	{
+		const auto index = index_of(aNode);
+		mRemoved[index] = 1;
+		mHandleAtIndex[index] = sNone;
+		mIndexOfHandle[aNode] = sNone;
+		mFreeHandles.push_back(aNode);
+		--mNumNodes;
+		mStructureChanged = true;
+	}
+
+	void transform_hierarchy::set_parent(handle aNode, handle aParent)
+	{
+		const auto index = index_of(aNode);
+		const auto parentIndex = sNone == aParent ? sNone : index_of(aParent);
+		for (auto i = parentIndex; sNone != i; i = mParentIndices[i]) {
+			if (i == index) {
+				throw avk::runtime_error(std::format("Node {} can not become a child of node {}, since that is the node itself or one of its descendants.", aNode, aParent));
+			}
+		}
+		mParentIndices[index] = parentIndex;
+		mark_dirty(index);
+		mStructureChanged = true;
+	}
+
+	transform_hierarchy::handle transform_hierarchy::parent(handle aNode) const
+	{
+		const auto parentIndex = mParentIndices[index_of(aNode)];
+		return sNone == parentIndex ? sNone : mHandleAtIndex[parentIndex];
+	}
+
+	bool transform_hierarchy::contains(handle aNode) const
+	{
+		return aNode < mIndexOfHandle.size() && sNone != mIndexOfHandle[aNode];
+	}
+
+	void transform_hierarchy::set_translation(handle aNode, const glm::vec3& aValue)
+	{
+		const auto index = index_of(aNode);
+		mTranslations[index] = aValue;
+		mark_dirty(index);
+	}
+
+	void transform_hierarchy::set_rotation(handle aNode, const glm::quat& aValue)
+	{
+		const auto index = index_of(aNode);
+		mRotations[index] = aValue;
+		mark_dirty(index);
+	}
+
+	void transform_hierarchy::set_scale(handle aNode, const glm::vec3& aValue)
+	{
+		const auto index = index_of(aNode);
+		mScales[index] = aValue;
+		mark_dirty(index);
+	}
+
+	void transform_hierarchy::set_matrix(handle aNode, const glm::mat4& aValue)
+	{
+		const auto index = index_of(aNode);
+		std::tie(mTranslations[index], mRotations[index], mScales[index]) = transforms_from_matrix(aValue);
+		mark_dirty(index);
+	}
+
+	glm::mat4 transform_hierarchy::local_transformation_matrix(handle aNode) const
+	{
+		const auto index = index_of(aNode);
+		return matrix_from_transforms(mTranslations[index], mRotations[index], mScales[index]);
+	}
+
+	void transform_hierarchy::apply_structural_changes()
+	{
+		const auto n = static_cast<uint32_t>(mTranslations.size());
+
+		// Gather the children of every node in compressed form, keeping siblings in their current order:
+		std::vector<uint32_t> childrenBegin(n + 1, 0);
+		for (uint32_t i = 0; i < n; ++i) {
+			if (sNone != mParentIndices[i]) {
+				++childrenBegin[mParentIndices[i] + 1];
+			}
+		}
+		for (uint32_t i = 0; i < n; ++i) {
+			childrenBegin[i + 1] += childrenBegin[i];
+		}
+		std::vector<uint32_t> children(childrenBegin[n]);
+		{
+			auto insertAt = childrenBegin;
+			for (uint32_t i = 0; i < n; ++i) {
+				if (sNone != mParentIndices[i]) {
+					children[insertAt[mParentIndices[i]]++] = i;
+				}
+			}
+		}
+
+		// Depth-first traversal from all roots. Removed nodes are not entered, which drops their descendants, too:
+		std::vector<uint32_t> newToOld;
+		newToOld.reserve(mNumNodes);
+		std::vector<uint32_t> stack;
+		for (uint32_t root = 0; root < n; ++root) {
+			if (sNone != mParentIndices[root] || 0 != mRemoved[root]) {
+				continue;
+			}
+			stack.push_back(root);
+			while (!stack.empty()) {
+				const auto i = stack.back();
+				stack.pop_back();
+				newToOld.push_back(i);
+				// Push in reverse, s.t. the first child is visited first:
+				for (auto c = childrenBegin[i + 1]; c > childrenBegin[i]; --c) {
+					if (0 == mRemoved[children[c - 1]]) {
+						stack.push_back(children[c - 1]);
+					}
+				}
+			}
+		}
+
+		std::vector<uint32_t> oldToNew(n, sNone);
+		for (uint32_t i = 0; i < static_cast<uint32_t>(newToOld.size()); ++i) {
+			oldToNew[newToOld[i]] = i;
+		}
+
+		// Nodes which have not been reached are descendants of removed nodes => invalidate their handles:
+		for (uint32_t i = 0; i < n; ++i) {
+			if (sNone == oldToNew[i] && 0 == mRemoved[i]) {
+				mIndexOfHandle[mHandleAtIndex[i]] = sNone;
+				mFreeHandles.push_back(mHandleAtIndex[i]);
+			}
+		}
+
+		auto reorder = [&newToOld](auto& aValues) {
+			std::remove_reference_t<decltype(aValues)> reordered;
+			reordered.reserve(newToOld.size());
+			for (auto i : newToOld) {
+				reordered.push_back(aValues[i]);
+			}
+			aValues = std::move(reordered);
+		};
+		reorder(mTranslations);
+		reorder(mRotations);
+		reorder(mScales);
+		reorder(mGlobalMatrices);
+		reorder(mDirty);
+		reorder(mHandleAtIndex);
+		reorder(mParentIndices);
+		for (auto& p : mParentIndices) {
+			if (sNone != p) {
+				p = oldToNew[p];
+			}
+		}
+		mRemoved.assign(newToOld.size(), 0);
+		for (uint32_t i = 0; i < static_cast<uint32_t>(newToOld.size()); ++i) {
+			mIndexOfHandle[mHandleAtIndex[i]] = i;
+		}
+
+		// Every parent is stored before its children => accumulate the subtree sizes backwards:
+		mSubtreeSizes.assign(newToOld.size(), 1);
+		for (auto i = static_cast<uint32_t>(newToOld.size()); i > 0; --i) {
+			if (sNone != mParentIndices[i - 1]) {
+				mSubtreeSizes[mParentIndices[i - 1]] += mSubtreeSizes[i - 1];
+			}
+		}
+
+		mNumNodes = newToOld.size();
+		mTasksBuiltForThreads = 0;
+	}
+
+	void transform_hierarchy::build_tasks(size_t aMaxThreads)
+	{
+		mSequentialNodes.clear();
+		mTasks.clear();
+
+		// Several tasks per thread for load balancing, since only dirty nodes cause work:
+		const auto n = static_cast<uint32_t>(mTranslations.size());
+		const auto maxNodesPerTask = static_cast<uint32_t>(std::max(sMinNodesPerTask, n / (aMaxThreads * 4)));
+		uint32_t i = 0;
+		while (i < n) {
+			if (mSubtreeSizes[i] <= maxNodesPerTask) {
+				// Merge with the previous task if they are adjacent, which happens for many small subtrees:
+				if (!mTasks.empty() && mTasks.back().second == i && mTasks.back().second - mTasks.back().first + mSubtreeSizes[i] <= maxNodesPerTask) {
+					mTasks.back().second += mSubtreeSizes[i];
+				}
+				else {
+					mTasks.emplace_back(i, i + mSubtreeSizes[i]);
+				}
+				i += mSubtreeSizes[i];
+			}
+			else {
+				// Too large => update this node before all tasks, and split its subtree:
+				mSequentialNodes.push_back(i);
+				++i;
+			}
+		}
+		mTasksBuiltForThreads = aMaxThreads;
+	}
+
+	size_t transform_hierarchy::update_range(uint32_t aBegin, uint32_t aEnd)
+	{
+		size_t numUpdated = 0;
+		for (auto i = aBegin; i < aEnd; ++i) {
+			const auto p = mParentIndices[i];
+			if (sNone != p && 0 != mDirty[p]) {
+				mDirty[i] = 1;
+			}
+			if (0 == mDirty[i]) {
+				continue;
+			}
+			const auto local = matrix_from_transforms(mTranslations[i], mRotations[i], mScales[i]);
+			mGlobalMatrices[i] = sNone == p ? local : mGlobalMatrices[p] * local;
+			++numUpdated;
+		}
+		return numUpdated;
+	}
+
+	size_t transform_hierarchy::update(size_t aMaxThreads)
+	{
+		if (mStructureChanged) {
+			apply_structural_changes();
+			mStructureChanged = false;
+		}
+
+		const auto n = static_cast<uint32_t>(mTranslations.size());
+		const auto numThreads = std::min(std::max(size_t{ 1 }, aMaxThreads), (static_cast<size_t>(n) + sMinNodesPerTask - 1) / sMinNodesPerTask);
+		size_t numUpdated = 0;
+		if (numThreads <= 1) {
+			numUpdated = update_range(0, n);
+		}
+		else {
+			if (mTasksBuiltForThreads != numThreads) {
+				build_tasks(numThreads);
+			}
+			// The sequential nodes are the ancestors of all tasks' subtrees => they must be updated first:
+			for (auto i : mSequentialNodes) {
+				numUpdated += update_range(i, i + 1);
+			}
+			std::atomic<size_t> numUpdatedByTasks{ 0 };
+			parallel_for(mTasks.size(), [this, &numUpdatedByTasks](size_t t) {
+				numUpdatedByTasks.fetch_add(update_range(mTasks[t].first, mTasks[t].second), std::memory_order_relaxed);
+			}, numThreads);
+			numUpdated += numUpdatedByTasks.load();
+		}
+
+		std::fill(std::begin(mDirty), std::end(mDirty), uint8_t{ 0 });
+		return numUpdated;
+	}
+}
@@ -367,55 +367,63 @@ namespace avk
 
 		// Get the next image from the swap chain, GPU -> GPU sync from previous present to the following acquire
 		auto imgAvailableSem = image_available_semaphore_for_frame();
+		uint32_t imageIndex = 0;
+		const auto result = acquire_swap_chain_image(swap_chain(), imgAvailableSem.get(), imageIndex);
+		complete_swap_chain_image_acquisition(result, imageIndex, std::move(imgAvailableSem));
+	}
 
-		// Update previous image index before getting a new image index for the current frame:
-		mPreviousFrameImageIndex = mCurrentFrameImageIndex;
-
+	vk::Result window::acquire_swap_chain_image(vk::SwapchainKHR aSwapChain, const avk::semaphore_t& aImageAvailableSemaphore, uint32_t& aImageIndex)
+	{
+		AVK_PROFILE_SCOPE("window::acquire_next_image");
 		try
 		{
-			auto result = context().device().acquireNextImageKHR(
-				swap_chain(), // the swap chain from which we wish to acquire an image
+			return context().device().acquireNextImageKHR(
+				aSwapChain, // the swap chain from which we wish to acquire an image
 				// At this point, I have to rant about the `timeout` parameter:
 				// The spec says: "timeout specifies how long the function waits, in nanoseconds, if no image is available."
 				// HOWEVER, don't think that a numeric_limit<int64_t>::max() will wait for nine quintillion nanoseconds!
 				//    No, instead it will return instantly, yielding an invalid swap chain image index. OMG, WTF?!
 				// Long story short: make sure to pass the UNSINGEDint64_t's maximum value, since only that will disable the timeout.
 				std::numeric_limits<uint64_t>::max(), // a timeout in nanoseconds for an image to become available. Using the maximum value of a 64 bit unsigned integer disables the timeout. [1]
-				imgAvailableSem->handle(), // The next two parameters specify synchronization objects that are to be signaled when the presentation engine is finished using the image [1]
+				aImageAvailableSemaphore.handle(), // The next two parameters specify synchronization objects that are to be signaled when the presentation engine is finished using the image [1]
 				nullptr,
-				&mCurrentFrameImageIndex); // a variable to output the index of the swap chain image that has become available. The index refers to the VkImage in our swapChainImages array. We're going to use that index to pick the right command buffer. [1]
-			if (vk::Result::eSuboptimalKHR == result) {
-				LOG_INFO("Swap chain is suboptimal in acquire_next_swap_chain_image_and_prepare_semaphores. Going to recreate it...");
-				mResourceRecreationDeterminator.set_recreation_required_for(recreation_determinator::reason::suboptimal_swap_chain);
+				&aImageIndex); // a variable to output the index of the swap chain image that has become available. The index refers to the VkImage in our swapChainImages array. We're going to use that index to pick the right command buffer. [1]
+		}
+		catch (const vk::OutOfDateKHRError&) {
+			return vk::Result::eErrorOutOfDateKHR;
+		}
+	}
 
-				// Workaround for binary semaphores:
-				// Since the semaphore is in a wait state right now, we'll have to wait for it until we can use it again.
-				auto fen = context().create_fence();
-				vk::PipelineStageFlags waitStage = vk::PipelineStageFlagBits::eAllCommands;
-				mActivePresentationQueue->handle().submit({ // TODO: This works, but is arguably not the greatest of all solutions... => Can it be done better with Timeline Semaphores? (Test on AMD!)
-					vk::SubmitInfo{}
-						.setCommandBufferCount(0u)
-						.setWaitSemaphoreCount(1u)
-						.setPWaitSemaphores(imgAvailableSem->handle_addr())
-						.setPWaitDstStageMask(&waitStage)
-				}, fen->handle());
-				fen->wait_until_signalled();
-
-				acquire_next_swap_chain_image_and_prepare_semaphores();
-				return;
-			}
+	void window::complete_swap_chain_image_acquisition(vk::Result aResult, uint32_t aImageIndex, avk::semaphore aImageAvailableSemaphore)
+	{
+		if (vk::Result::eSuboptimalKHR == aResult) {
+			LOG_INFO("Swap chain is suboptimal in acquire_next_swap_chain_image_and_prepare_semaphores. Going to recreate it...");
+			mResourceRecreationDeterminator.set_recreation_required_for(recreation_determinator::reason::suboptimal_swap_chain);
+
+			// Workaround for binary semaphores:
+			// Since the semaphore is in a wait state right now, we'll have to wait for it until we can use it again.
+			wait_for_semaphore_on_presentation_queue(aImageAvailableSemaphore.get());
+
+			acquire_next_swap_chain_image_and_prepare_semaphores();
+			return;
 		}
-		catch (vk::OutOfDateKHRError omg) {
-			LOG_INFO(std::format("Swap chain out of date in acquire_next_swap_chain_image_and_prepare_semaphores. Reason[{}] in frame#{}. Going to recreate it...", omg.what(), current_frame()));
+		if (vk::Result::eErrorOutOfDateKHR == aResult) {
+			LOG_INFO(std::format("Swap chain out of date in acquire_next_swap_chain_image_and_prepare_semaphores in frame#{}. Going to recreate it...", current_frame()));
 			mResourceRecreationDeterminator.set_recreation_required_for(recreation_determinator::reason::invalid_swap_chain);
 			acquire_next_swap_chain_image_and_prepare_semaphores();
 			return;
 		}
+		if (vk::Result::eSuccess != aResult) {
+			throw avk::runtime_error(std::format("Acquiring the next swap chain image failed with {} in frame#{}.", vk::to_string(aResult), current_frame()));
+		}
+
+		// Update previous image index before setting the image index for the current frame:
+		mPreviousFrameImageIndex = mCurrentFrameImageIndex;
+		mCurrentFrameImageIndex = aImageIndex;
 
 		// It could be that the image index that has been returned is currently in flight.
 		// There's no guarantee that we'll always get a nice cycling through the indices.
 		// => Must handle this case!
-		assert(current_image_index() == mCurrentFrameImageIndex);
 		if (mImagesInFlightFenceIndices[current_image_index()] >= 0) {
 			LOG_DEBUG_VERBOSE(std::format("Frame #{}: Have to issue an extra fence-wait because swap chain returned image[{}] but fence[{}] is currently in use.", current_frame(), mCurrentFrameImageIndex, mImagesInFlightFenceIndices[current_image_index()]));
 			auto& xf = mFramesInFlightFences[mImagesInFlightFenceIndices[current_image_index()]];
@@ -424,7 +432,7 @@ namespace avk
 		}
 
 		// Set the image available semaphore to be consumed:
-		mCurrentFrameImageAvailableSemaphore = imgAvailableSem;
+		mCurrentFrameImageAvailableSemaphore = std::move(aImageAvailableSemaphore);
 
 		// Set the fence to be used:
 		mCurrentFrameFinishedFence = current_fence();
@@ -432,21 +440,38 @@ namespace avk
 
 	void window::sync_before_render()
 	{
+		AVK_PROFILE_SCOPE("window::sync_before_render");
+
+		// Pick up the image which has been acquired on the helper thread after the previous frame, if any.
+		// Its fence has already been waited on before the acquire => the wait below returns immediately.
+		const auto earlyAcquire = mPipelinedAcquire ? mPipelinedAcquire->finish() : std::optional<pipelined_acquire::result>{};
+
 		// Wait for the fence before proceeding, GPU -> CPU synchronization via fence
 		const auto ci = current_in_flight_index();
 		auto cf = current_fence();
 		assert(cf->handle() == mFramesInFlightFences[current_in_flight_index()]->handle());
-		cf->wait_until_signalled();
+		const auto fenceWaitBeginNs = cpu_profile_now_ns();
+		{
+			AVK_PROFILE_SCOPE("window::wait_for_fence");
+			cf->wait_until_signalled();
+		}
 		cf->reset();
+		mFenceWaitMs = earlyAcquire.has_value()
+			? static_cast<double>(earlyAcquire->mAcquireBeginNs - earlyAcquire->mFenceWaitBeginNs) * 1e-6
+			: static_cast<double>(cpu_profile_now_ns() - fenceWaitBeginNs) * 1e-6;
+
+		// The frame which has used this fence before is done => its GPU zones can be read back without stalling:
+		if (mGpuProfiler) {
+			mGpuProfiler->begin_frame(static_cast<size_t>(ci), static_cast<size_t>(number_of_frames_in_flight()), nullptr != mActivePresentationQueue ? mActivePresentationQueue->family_index() : 0u);
+		}
 
 		// Keep house with the in-flight images:
-		//   However, we don't know which index this fence had been mapped to => we have to search
-		for (auto& mapping : mImagesInFlightFenceIndices) {
-			if (ci == mapping) {
-				mapping = -1;
-				break;
-			}
+		//   The image which has been presented with this fence is no longer in flight, unless it has been presented with another fence since
+		auto& imageIndex = mFencesInFlightImageIndices[ci];
+		if (imageIndex >= 0 && ci == mImagesInFlightFenceIndices[imageIndex]) {
+			mImagesInFlightFenceIndices[imageIndex] = -1;
 		}
+		imageIndex = -1;
 
 		// At this point we are certain that the frame which has used the current fence before is done.
 		//  => Clean up the resources of that previous frame!
@@ -454,11 +479,24 @@ namespace avk
 		auto commandBuffersToBeFreed 	= clean_up_resources_for_frame(current_frame());
 		//clean_up_outdated_swapchain_resources_for_frame(current_frame());
 
-		acquire_next_swap_chain_image_and_prepare_semaphores();
+		mCurrentFrameAcquiredEarly = earlyAcquire.has_value();
+		if (earlyAcquire.has_value()) {
+			mAcquireBeginNs = earlyAcquire->mAcquireBeginNs;
+			update_active_presentation_queue();
+			complete_swap_chain_image_acquisition(earlyAcquire->mResult, earlyAcquire->mImageIndex, image_available_semaphore_for_frame());
+		}
+		else {
+			mAcquireBeginNs = cpu_profile_now_ns();
+			acquire_next_swap_chain_image_and_prepare_semaphores();
+		}
+		mAcquireEndNs = earlyAcquire.has_value() && vk::Result::eSuccess == earlyAcquire->mResult ? earlyAcquire->mAcquireEndNs : cpu_profile_now_ns();
 	}
 
 	void window::render_frame()
 	{
+		AVK_PROFILE_SCOPE("window::render_frame");
+		const auto submitNs = cpu_profile_now_ns();
+
 		const auto fenceIndex = static_cast<int>(current_in_flight_index());
 
 		// EXTERN -> WAIT
@@ -522,10 +560,14 @@ namespace avk
 				.setPSwapchains(&swap_chain())
 				.setPImageIndices(&mCurrentFrameImageIndex)
 				.setPResults(nullptr);
-			auto result = mActivePresentationQueue->handle().presentKHR(presentInfo);
+			auto result = [&]() {
+				AVK_PROFILE_SCOPE("window::present");
+				return mActivePresentationQueue->handle().presentKHR(presentInfo);
+			}();
 			
 			// Submitted => store the image index for extra reuse-safety:
 			mImagesInFlightFenceIndices[mCurrentFrameImageIndex] = fenceIndex;
+			mFencesInFlightImageIndices[fenceIndex] = static_cast<int>(mCurrentFrameImageIndex);
 
 			if (vk::Result::eSuboptimalKHR == result) {
 				LOG_INFO("Swap chain is suboptimal in render_frame. Going to recreate it...");
@@ -540,8 +582,164 @@ namespace avk
 			// swap chain will be recreated in the next frame
 		}
 
+		const auto presentNs = cpu_profile_now_ns();
+		if (mRecentFrameLatencies.size() >= WINDOW_FRAME_LATENCY_HISTORY_LENGTH) {
+			mRecentFrameLatencies.pop_front();
+		}
+		mRecentFrameLatencies.push_back(frame_latency{
+			current_frame(),
+			mFenceWaitMs,
+			static_cast<double>(mAcquireEndNs - mAcquireBeginNs) * 1e-6,
+			static_cast<double>(submitNs - mAcquireEndNs) * 1e-6,
+			static_cast<double>(presentNs - submitNs) * 1e-6,
+			mCurrentFrameAcquiredEarly
+		});
+
 		// increment frame counter
 		++mCurrentFrame;
+
+		// Acquire the next frame's image in the background, unless the swap chain or the presentation queue are about to change:
+		if (mPipelinedAcquireEnabled && !mResourceRecreationDeterminator.is_any_recreation_necessary() && !mPresentationQueueGetter) {
+			mPipelinedAcquire->start(current_fence(), image_available_semaphore_for_frame(), swap_chain());
+		}
+	}
+
+	void window::wait_for_semaphore_on_presentation_queue(const avk::semaphore_t& aSemaphore)
+	{
+		auto fen = context().create_fence();
+		vk::PipelineStageFlags waitStage = vk::PipelineStageFlagBits::eAllCommands;
+		mActivePresentationQueue->handle().submit({ // TODO: This works, but is arguably not the greatest of all solutions... => Can it be done better with Timeline Semaphores? (Test on AMD!)
+			vk::SubmitInfo{}
+				.setCommandBufferCount(0u)
+				.setWaitSemaphoreCount(1u)
+				.setPWaitSemaphores(aSemaphore.handle_addr())
+				.setPWaitDstStageMask(&waitStage)
+		}, fen->handle());
+		fen->wait_until_signalled();
+	}
+
+	void window::finish_pending_pipelined_acquire() noexcept
+	{
+		if (!mPipelinedAcquire) {
+			return;
+		}
+		try {
+			auto pending = mPipelinedAcquire->finish();
+			// Unless the acquire has failed, the semaphore has a signal operation pending, which must not outlive the semaphore:
+			if (pending.has_value() && (vk::Result::eSuccess == pending->mResult || vk::Result::eSuboptimalKHR == pending->mResult)) {
+				wait_for_semaphore_on_presentation_queue(pending->mImageAvailableSemaphore.value().get());
+			}
+		}
+		catch (const std::exception& e) {
+			LOG_ERROR(std::format("Finishing the pending swap chain image acquire failed: {}", e.what()));
+		}
+		catch (...) {
+			LOG_ERROR("Finishing the pending swap chain image acquire failed.");
+		}
+	}
+
+	void window::enable_pipelined_acquire(bool aEnable)
+	{
+		if (aEnable && !mPipelinedAcquire) {
+			mPipelinedAcquire = std::make_unique<pipelined_acquire>();
+		}
+		mPipelinedAcquireEnabled = aEnable;
+	}
+
+	window::pipelined_acquire::pipelined_acquire()
+	{
+		mThread = std::thread([this]() { worker_main(); });
+	}
+
+	window::pipelined_acquire::~pipelined_acquire()
+	{
+		{
+			std::scoped_lock<std::mutex> guard(mMutex);
+			mStop = true;
+		}
+		mCondVar.notify_all();
+		// A pending acquire is finished first, since it waits for a fence which the GPU will signal for sure:
+		mThread.join();
+	}
+
+	void window::pipelined_acquire::start(avk::fence aFence, avk::semaphore aImageAvailableSemaphore, vk::SwapchainKHR aSwapChain)
+	{
+		{
+			std::scoped_lock<std::mutex> guard(mMutex);
+			assert(!mStarted && !mResult.has_value());
+			mFence = std::move(aFence);
+			mImageAvailableSemaphore = std::move(aImageAvailableSemaphore);
+			mSwapChain = aSwapChain;
+			mStarted = true;
+		}
+		mCondVar.notify_all();
+	}
+
+	std::optional<window::pipelined_acquire::result> window::pipelined_acquire::finish()
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+		if (!mStarted) {
+			return {};
+		}
+		mCondVar.wait(lock, [this]() { return mResult.has_value() || nullptr != mException; });
+		mStarted = false;
+		if (nullptr != mException) {
+			std::rethrow_exception(std::exchange(mException, nullptr));
+		}
+		return std::exchange(mResult, std::nullopt);
+	}
+
+	void window::pipelined_acquire::worker_main()
+	{
+		set_cpu_profile_thread_name("swap chain acquire");
+		std::unique_lock<std::mutex> lock(mMutex);
+		while (true) {
+			mCondVar.wait(lock, [this]() { return mStop || (mStarted && !mResult.has_value() && nullptr == mException && mFence.has_value()); });
+			if (!mFence.has_value()) {
+				return; // Stopped, and nothing left to acquire
+			}
+			auto fence = std::move(mFence.value());
+			auto semaphore = std::move(mImageAvailableSemaphore.value());
+			const auto swapChain = mSwapChain;
+			mFence.reset();
+			mImageAvailableSemaphore.reset();
+			lock.unlock();
+
+			result r{ vk::Result::eSuccess, 0u, cpu_profile_now_ns(), 0, 0 };
+			std::exception_ptr exception;
+			try {
+				{
+					// The semaphore may only be signalled again after the frame which has waited on it before is done:
+					AVK_PROFILE_SCOPE("window::wait_for_fence");
+					fence->wait_until_signalled();
+				}
+				r.mAcquireBeginNs = cpu_profile_now_ns();
+				r.mResult = acquire_swap_chain_image(swapChain, semaphore.get(), r.mImageIndex);
+				r.mAcquireEndNs = cpu_profile_now_ns();
+				r.mImageAvailableSemaphore = std::move(semaphore);
+			}
+			catch (...) {
+				// Handed over to finish(), which rethrows it on the render thread:
+				exception = std::current_exception();
+			}
+
+			lock.lock();
+			if (nullptr != exception) {
+				mException = std::move(exception);
+			}
+			else {
+				mResult = std::move(r);
+			}
+			mCondVar.notify_all();
+		}
+	}
+
+	gpu_profiler& window::enable_gpu_profiling(uint32_t aMaxZonesPerFrame)
+	{
+		if (!mGpuProfiler) {
+			mGpuProfiler = std::make_unique<gpu_profiler>(aMaxZonesPerFrame);
+		}
+		return *mGpuProfiler;
 	}
 
 	void window::set_queue_family_ownership(std::vector<uint32_t> aQueueFamilies)
@@ -627,6 +825,7 @@ namespace avk
 			mImagesInFlightFenceIndices.push_back(-1);
 		}
 		assert(mImagesInFlightFenceIndices.size() == imagesInFlight);
+		mFencesInFlightImageIndices.assign(static_cast<size_t>(framesInFlight), -1);
 		
 		// when updating, the current fence must be unsignaled.
 		if (aCreationMode == window::swapchain_creation_mode::update_existing_swapchain) {
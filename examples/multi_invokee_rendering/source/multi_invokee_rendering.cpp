@@ -3,7 +3,7 @@
 #include "configure_and_compose.hpp"
 #include "imgui_manager.hpp"
 #include "invokee.hpp"
-#include "sequential_invoker.hpp"
+#include "task_graph_invoker.hpp"
 
 #include "vk_convenience_functions.hpp"
 
@@ -55,6 +55,9 @@ public:
 			avk::push_constant_binding_data{ avk::shader_type::vertex, 0, sizeof(unsigned int) }
 		);
 
+		// Look up the name of the GPU zone only once instead of every frame:
+		mRenderPassProfileNameId = avk::cpu_profile_name_id(name(), "::render_pass");
+
 		// set up updater
 		// we want to use an updater, so create one:
 		mUpdater.emplace();
@@ -66,10 +69,23 @@ public:
 		.update(mPipeline);
 	}
 
+	void declare_update_access(avk::frame_task_access& aAccess) const override
+	{
+		// update() only reads the input, s.t. the task_graph_invoker may invoke it on any thread, concurrently
+		// with the other invokees' update() calls and with the render() calls of the previous frame:
+		aAccess.reads(avk::task_graph_invoker::sInputResource);
+	}
+
+	void declare_render_access(avk::frame_task_access& aAccess) const override
+	{
+		// render() only accesses this invokee's own members, besides the window:
+		aAccess.independent();
+	}
+
 	void update() override
 	{
 		// On Esc pressed,
-		if (avk::input().key_pressed(avk::key_code::escape) || avk::context().main_window()->should_be_closed()) {
+		if (avk::input().key_pressed(avk::key_code::escape)) {
 			// stop the current composition:
 			avk::current_composition()->stop();
 		}
@@ -79,6 +95,11 @@ public:
 	{
 		auto mainWnd = avk::context().main_window();
 
+		// Windows may only be accessed by tasks which access task_graph_invoker::sWindowsResource, like all render() calls:
+		if (mainWnd->should_be_closed()) {
+			avk::current_composition()->stop();
+		}
+
 		// need handling the case where previous invokees had been disabled (or this is the first invokee on the list)
 		bool firstInvokeeInChain = !mainWnd->has_consumed_current_image_available_semaphore();
 
@@ -88,15 +109,21 @@ public:
 		// Create a command buffer and render into the *current* swap chain image:
 		auto cmdBfr = commandPool->alloc_command_buffer(vk::CommandBufferUsageFlagBits::eOneTimeSubmit);
 
+		auto renderPass = avk::command::render_pass(
+			firstInvokeeInChain ? mClearRenderPass.as_reference() : mLoadRenderPass.as_reference(), 
+			avk::context().main_window()->current_backbuffer_reference(), {
+				avk::command::bind_pipeline(mPipeline.as_reference()),
+				avk::command::draw(3u, 1u, 0u, 0u)
+			}
+		);
+
+		// If GPU profiling is enabled, measure the GPU time of the render pass, which is shown in imgui_manager's profiler overlay:
+		auto* gpuProfiler = mainWnd->get_gpu_profiler();
 		auto commands = avk::context().record({
 			avk::command::push_constants(mPipeline->layout(), mTrianglePart, avk::shader_type::vertex),
-			avk::command::render_pass(
-				firstInvokeeInChain ? mClearRenderPass.as_reference() : mLoadRenderPass.as_reference(), 
-				avk::context().main_window()->current_backbuffer_reference(), {
-					avk::command::bind_pipeline(mPipeline.as_reference()),
-					avk::command::draw(3u, 1u, 0u, 0u)
-				}
-			)
+			nullptr != gpuProfiler
+				? gpuProfiler->zone(mRenderPassProfileNameId, { std::move(renderPass) })
+				: std::move(renderPass)
 		});
 
 		if (firstInvokeeInChain) {
@@ -122,6 +149,7 @@ private: // v== Member variables ==v
 	avk::renderpass mClearRenderPass;
 	avk::renderpass mLoadRenderPass;
 	avk::graphics_pipeline mPipeline;
+	uint32_t mRenderPassProfileNameId = 0;
 	
 
 }; // draw_a_triangle_app
@@ -136,6 +164,7 @@ int main() // <== Starting point ==
 		mainWnd->enable_resizing(true);
 		mainWnd->set_presentaton_mode(avk::presentation_mode::mailbox);
 		mainWnd->set_number_of_concurrent_frames(3u);
+		mainWnd->enable_gpu_profiling();
 		mainWnd->open();
 
 		auto& singleQueue = avk::context().create_queue({}, avk::queue_selection_preference::versatile_queue, mainWnd);
@@ -149,6 +178,8 @@ int main() // <== Starting point ==
 				
 		// Create another element for drawing the UI with ImGui
 		auto ui = avk::imgui_manager(singleQueue);
+		// Show the CPU timings of every invokee's update() and render():
+		ui.set_profiler_overlay_enabled(true);
 		
 		auto apps = std::vector<multi_invokee_rendering_app*>{ &app1, &app2, &app3 };
 		ui.add_callback([&apps]() {	
@@ -193,32 +224,13 @@ int main() // <== Starting point ==
 		);
 
 		// Create an invoker object, which defines the way how invokees/elements are invoked
-		// (In this case, just sequentially in their execution order):
-		avk::sequential_invoker invoker;
+		// (In this case, as a task graph per frame, which is derived from the resources that the invokees declare to access.
+		//  The apps' update() calls of a frame run concurrently with the render() calls of the previous frame, while
+		//  the imgui_manager, which does not declare anything, is invoked on the main thread in its execution order):
+		avk::task_graph_invoker invoker;
 
 		// With everything configured, let us start our render loop:
-		composition.start_render_loop(
-			// Callback in the case of update:
-			[&invoker](const std::vector<avk::invokee*>& aToBeInvoked) {
-				// Call all the update() callbacks:
-				invoker.invoke_updates(aToBeInvoked);
-			},
-			// Callback in the case of render:
-			[&invoker](const std::vector<avk::invokee*>& aToBeInvoked) {
-				// Sync (wait for fences and so) per window BEFORE executing render callbacks
-				avk::context().execute_for_each_window([](avk::window* wnd) {
-					wnd->sync_before_render();
-				});
-
-				// Call all the render() callbacks:
-				invoker.invoke_renders(aToBeInvoked);
-
-				// Render per window:
-				avk::context().execute_for_each_window([](avk::window* wnd) {
-					wnd->render_frame();
-				});
-			}
-		); // This is a blocking call, which loops until avk::current_composition()->stop(); has been called (see update())
+		composition.start_render_loop(invoker); // This is a blocking call, which loops until avk::current_composition()->stop(); has been called (see update() and render())
 	
 		result = EXIT_SUCCESS;		
 	}
@@ -16,6 +16,8 @@
 #include "vk_convenience_functions.hpp"
 
 #define USE_SERIALIZER 1
+// Read existing cache files via a memory mapping instead of a file stream. Toggle to compare load times:
+#define USE_MEMORY_MAPPED_CACHE 1
 
 class orca_loader_app : public avk::invokee
 {
@@ -226,7 +228,13 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 		// If a cache file exists, i.e. the scene was serialized during a previous load, initialize the serializer in deserialize mode,
 		// else initialize the serializer in serialize mode to create the cache file while processing the scene.
 		auto serializer = avk::serializer(cacheFilePath, avk::does_cache_file_exist(cacheFilePath) ?
-			avk::serializer::mode::deserialize : avk::serializer::mode::serialize);
+			avk::serializer::mode::deserialize : avk::serializer::mode::serialize,
+#if USE_MEMORY_MAPPED_CACHE
+			avk::serializer::read_strategy::memory_mapped
+#else
+			avk::serializer::read_strategy::stream
+#endif
+		);
 
 		auto start = avk::context().get_time();
 		auto startPart = start;
@@ -365,7 +373,8 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 
 		auto end = avk::context().get_time();
 		auto diff = end - start;
-		LOG_INFO(std::format("load_orca_scene_cached took {} in total", diff));
+		LOG_INFO(std::format("load_orca_scene_cached took {} in total ({})", diff,
+			serializer.mode() == avk::serializer::mode::serialize ? "serialized" : serializer.is_memory_mapped() ? "deserialized from memory mapped cache" : "deserialized from streamed cache"));
 
 		auto swapChainFormat = avk::context().main_window()->swap_chain_image_format();
 		// Create our rasterization graphics pipeline with the required configuration:
@@ -11,6 +11,11 @@
 #include "quake_camera.hpp"
 #include "vk_convenience_functions.hpp"
 
+// Divide meshes into meshlets with avk::spatial_meshlets_divider (1), or with avk::basic_meshlets_divider (0):
+#define USE_SPATIAL_MESHLETS_DIVIDER 1
+// Additionally divide every mesh with both dividers, and log their meshlet counts, vertex fill, and division times:
+#define BENCHMARK_MESHLET_DIVIDERS 0
+
 class static_meshlets_app : public avk::invokee
 {
 	static constexpr size_t sNumVertices = 64;
@@ -105,6 +110,36 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 		}
 	}
 
+	/** Divides the given geometry with both, avk::basic_meshlets_divider and avk::spatial_meshlets_divider,
+	 *  and logs the number of meshlets, their average vertex fill, and how long each division took.
+	 *  @param aMeshName			The name of the mesh, used for logging.
+	 *	@param aData				The loaded positions and indices of the mesh.
+	 *	@param aModel				The model the mesh belongs to.
+	 *	@param aMeshIndex			The index of the mesh.
+	 */
+	static void log_meshlet_dividers_comparison(const std::string& aMeshName, const loaded_data_for_draw_call& aData, const avk::model_t& aModel, avk::mesh_index_t aMeshIndex) {
+		auto measure = [&](const char* aDividerName, auto aDivide) {
+			const auto begin = std::chrono::steady_clock::now();
+			const auto meshlets = aDivide();
+			const auto end = std::chrono::steady_clock::now();
+
+			size_t numVertices = 0;
+			for (const auto& ml : meshlets) {
+				numVertices += ml.mVertexCount;
+			}
+			const double averageFill = meshlets.empty() ? 0.0 : static_cast<double>(numVertices) / static_cast<double>(meshlets.size() * sNumVertices);
+			LOG_INFO(std::format("Mesh '{}' divided by {}: {} meshlets, average vertex fill {:.1f}%, took {:.2f} ms",
+				aMeshName, aDividerName, meshlets.size(), 100.0 * averageFill, std::chrono::duration<double, std::milli>(end - begin).count()));
+		};
+
+		measure("basic_meshlets_divider", [&]() {
+			return avk::basic_meshlets_divider(aData.mIndices, aModel, aMeshIndex, sNumVertices, sNumIndices);
+		});
+		measure("spatial_meshlets_divider", [&]() {
+			return avk::spatial_meshlets_divider(aData.mPositions, aData.mIndices, aModel, aMeshIndex, sNumVertices, sNumIndices);
+		});
+	}
+
 	void initialize() override
 	{
 		// use helper functions to create ImGui elements
@@ -171,8 +206,17 @@ public: // v== avk::invokee overrides which will be invoked by the framework ==v
 				// create selection for the meshlets
 				auto meshletSelection = avk::make_models_and_mesh_indices_selection(curModel, meshIndex);
 
+#if BENCHMARK_MESHLET_DIVIDERS
+				log_meshlet_dividers_comparison(meshname, drawCallData, curModel.get(), meshIndex);
+#endif
+
+#if USE_SPATIAL_MESHLETS_DIVIDER
+				auto cpuMeshlets = avk::divide_into_meshlets(meshletSelection, avk::spatial_meshlets_divider);
+				avk::serializer serializer("direct_spatial_meshlets-" + meshname + "-" + std::to_string(mpos) + ".cache");
+#else
 				auto cpuMeshlets = avk::divide_into_meshlets(meshletSelection);
 				avk::serializer serializer("direct_meshlets-" + meshname + "-" + std::to_string(mpos) + ".cache");
+#endif
 				auto [gpuMeshlets, _] = avk::convert_for_gpu_usage_cached<avk::meshlet_gpu_data<sNumVertices, sNumIndices>>(serializer, cpuMeshlets);
 
 				serializer.flush();